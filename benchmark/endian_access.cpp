@@ -0,0 +1,96 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2021 Aleksei Moskvin <alalmoskvin@gmail.com>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <nil/marshalling/processing/access.hpp>
+
+using namespace nil::marshalling;
+
+static const std::size_t Count = 1U << 20;
+
+template<typename TFunc>
+void measure(const std::string &name, std::size_t iterations, TFunc &&func) {
+    std::size_t checksum = 0U;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0U; i < iterations; ++i) {
+        checksum += func(i);
+    }
+    auto finish = std::chrono::steady_clock::now();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+    std::cout << "    " << name << ": " << static_cast<double>(elapsed) / static_cast<double>(iterations)
+              << " ns/op (checksum " << checksum << ")" << std::endl;
+}
+
+template<typename T, typename TEndian>
+void run_benchmark(const std::string &name) {
+    static const std::size_t Size = sizeof(T);
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
+    std::vector<std::uint8_t> buf(Count * Size);
+
+    std::cout << name << ":" << std::endl;
+
+    std::uint8_t *wordIter = &buf[0];
+    measure("word write", Count, [&](std::size_t i) -> std::size_t {
+        processing::write_data<Size>(static_cast<T>(i), wordIter, TEndian());
+        return 0U;
+    });
+
+    const std::uint8_t *wordReadIter = &buf[0];
+    measure("word read", Count, [&](std::size_t) -> std::size_t {
+        return static_cast<std::size_t>(
+            static_cast<unsigned_type>(processing::read_data<T, Size>(wordReadIter, TEndian())));
+    });
+
+    std::uint8_t *byteIter = &buf[0];
+    measure("byte loop write", Count, [&](std::size_t i) -> std::size_t {
+        processing::detail::write<TEndian>(static_cast<T>(i), Size, byteIter);
+        return 0U;
+    });
+
+    const std::uint8_t *byteReadIter = &buf[0];
+    measure("byte loop read", Count, [&](std::size_t) -> std::size_t {
+        return static_cast<std::size_t>(
+            static_cast<unsigned_type>(processing::detail::read<TEndian, T>(Size, byteReadIter)));
+    });
+}
+
+int main() {
+    run_benchmark<std::uint16_t, endian::big_endian>("uint16 big endian");
+    run_benchmark<std::uint16_t, endian::little_endian>("uint16 little endian");
+    run_benchmark<std::uint32_t, endian::big_endian>("uint32 big endian");
+    run_benchmark<std::uint32_t, endian::little_endian>("uint32 little endian");
+    run_benchmark<std::uint64_t, endian::big_endian>("uint64 big endian");
+    run_benchmark<std::uint64_t, endian::little_endian>("uint64 little endian");
+    return 0;
+}
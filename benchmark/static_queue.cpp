@@ -0,0 +1,179 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2021 Aleksei Moskvin <alalmoskvin@gmail.com>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <nil/marshalling/container/static_queue.hpp>
+#include <nil/marshalling/container/static_spsc_queue.hpp>
+
+using namespace nil::marshalling;
+
+static const std::size_t Capacity = 1024U;
+static const std::size_t BlockSize = 64U;
+static const std::size_t ItemsCount = 1U << 24;
+
+using value_type = std::uint32_t;
+
+// Pinning is best effort, the measurement is still valid on a single core.
+void pin_current_thread(unsigned cpu) {
+#ifdef __linux__
+    auto cpusCount = std::max(1U, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % cpusCount, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    static_cast<void>(cpu);
+#endif
+}
+
+template<typename TPush, typename TPop>
+void measure(const std::string &name, TPush &&push, TPop &&pop) {
+    std::size_t checksum = 0U;
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread producer([&]() {
+        pin_current_thread(0U);
+        value_type buf[BlockSize];
+        std::size_t sent = 0U;
+        while (sent < ItemsCount) {
+            auto count = std::min(BlockSize, ItemsCount - sent);
+            for (std::size_t i = 0U; i < count; ++i) {
+                buf[i] = static_cast<value_type>(sent + i);
+            }
+
+            std::size_t pushed = 0U;
+            while (pushed < count) {
+                auto result = push(&buf[pushed], &buf[count]);
+                if (result == 0U) {
+                    std::this_thread::yield();
+                }
+                pushed += result;
+            }
+            sent += count;
+        }
+    });
+
+    pin_current_thread(1U);
+    value_type buf[BlockSize];
+    std::size_t received = 0U;
+    while (received < ItemsCount) {
+        auto count = pop(&buf[0], BlockSize);
+        if (count == 0U) {
+            std::this_thread::yield();
+        }
+
+        for (std::size_t i = 0U; i < count; ++i) {
+            checksum += buf[i];
+        }
+        received += count;
+    }
+    producer.join();
+
+    auto finish = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+    std::cout << "    " << name << ": " << static_cast<double>(elapsed) / static_cast<double>(ItemsCount)
+              << " ns/item (checksum " << checksum << ")" << std::endl;
+}
+
+void run_spsc_queue() {
+    std::cout << "container::static_spsc_queue:" << std::endl;
+
+    container::static_spsc_queue<value_type, Capacity> queue;
+    measure(
+        "single",
+        [&](const value_type *from, const value_type *) -> std::size_t {
+            return queue.push_back(*from) ? 1U : 0U;
+        },
+        [&](value_type *out, std::size_t) -> std::size_t { return queue.pop_front(*out) ? 1U : 0U; });
+
+    measure(
+        "bulk",
+        [&](const value_type *from, const value_type *to) -> std::size_t { return queue.push_back(from, to); },
+        [&](value_type *out, std::size_t count) -> std::size_t { return queue.pop_front(out, count); });
+}
+
+void run_locked_queue() {
+    std::cout << "std::mutex + container::static_queue:" << std::endl;
+
+    container::static_queue<value_type, Capacity> queue;
+    std::mutex lock;
+    measure(
+        "single",
+        [&](const value_type *from, const value_type *) -> std::size_t {
+            std::lock_guard<std::mutex> guard(lock);
+            if (queue.full()) {
+                return 0U;
+            }
+            queue.push_back(*from);
+            return 1U;
+        },
+        [&](value_type *out, std::size_t) -> std::size_t {
+            std::lock_guard<std::mutex> guard(lock);
+            if (queue.empty()) {
+                return 0U;
+            }
+            *out = queue.front();
+            queue.pop_front();
+            return 1U;
+        });
+
+    measure(
+        "bulk",
+        [&](const value_type *from, const value_type *to) -> std::size_t {
+            std::lock_guard<std::mutex> guard(lock);
+            auto count = std::min(static_cast<std::size_t>(to - from), queue.capacity() - queue.size());
+            queue.push_back(from, from + count);
+            return count;
+        },
+        [&](value_type *out, std::size_t count) -> std::size_t {
+            std::lock_guard<std::mutex> guard(lock);
+            count = std::min(count, queue.size());
+            auto one = queue.arrayOne();
+            auto firstCount = std::min(count, static_cast<std::size_t>(one.second - one.first));
+            std::copy(one.first, one.first + firstCount, out);
+            std::copy(queue.arrayTwo().first, queue.arrayTwo().first + (count - firstCount), out + firstCount);
+            queue.pop_front(count);
+            return count;
+        });
+}
+
+int main() {
+    run_spsc_queue();
+    run_locked_queue();
+    return 0;
+}
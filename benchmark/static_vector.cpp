@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2021 Aleksei Moskvin <alalmoskvin@gmail.com>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/container/static_vector.hpp>
+
+#include <nil/marshalling/container/static_vector.hpp>
+
+using namespace nil::marshalling;
+
+static const std::size_t Capacity = 4096U;
+static const std::size_t BlockSize = 1024U;
+
+template<typename TFunc>
+void measure(const std::string &name, std::size_t iterations, TFunc &&func) {
+    std::size_t checksum = 0U;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0U; i < iterations; ++i) {
+        checksum += func(i);
+    }
+    auto finish = std::chrono::steady_clock::now();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+    std::cout << "    " << name << ": " << static_cast<double>(elapsed) / static_cast<double>(iterations)
+              << " ns/op (checksum " << checksum << ")" << std::endl;
+}
+
+template<typename TVec>
+void run_benchmark(const std::string &name, std::size_t iterations) {
+    using value_type = typename TVec::value_type;
+
+    std::vector<value_type> src(BlockSize);
+    for (std::size_t i = 0U; i < src.size(); ++i) {
+        src[i] = static_cast<value_type>(i * 13U);
+    }
+
+    std::cout << name << ":" << std::endl;
+
+    TVec vec;
+    measure("assign", iterations, [&](std::size_t i) -> std::size_t {
+        vec.assign(src.data(), src.data() + src.size());
+        return static_cast<std::size_t>(vec[i % BlockSize]);
+    });
+
+    measure("copy", iterations, [&](std::size_t i) -> std::size_t {
+        TVec copy(vec);
+        return static_cast<std::size_t>(copy[i % BlockSize]);
+    });
+
+    measure("insert middle", iterations, [&](std::size_t i) -> std::size_t {
+        vec.assign(src.data(), src.data() + src.size());
+        vec.insert(vec.begin() + (BlockSize / 2U), src.data(), src.data() + src.size());
+        return static_cast<std::size_t>(vec[i % vec.size()]);
+    });
+
+    measure("erase front", iterations, [&](std::size_t i) -> std::size_t {
+        vec.assign(src.data(), src.data() + src.size());
+        vec.erase(vec.begin(), vec.begin() + 16);
+        return static_cast<std::size_t>(vec[i % vec.size()]);
+    });
+
+    measure("resize", iterations, [&](std::size_t i) -> std::size_t {
+        vec.clear();
+        vec.resize(BlockSize);
+        return static_cast<std::size_t>(vec[i % BlockSize]);
+    });
+}
+
+template<typename T>
+using std_vector = std::vector<T>;
+
+template<typename T>
+struct reserved_vector : public std::vector<T> {
+    reserved_vector() {
+        this->reserve(Capacity);
+    }
+};
+
+template<typename T>
+void run_all(const std::string &type_name, std::size_t iterations) {
+    run_benchmark<container::static_vector<T, Capacity>>("container::static_vector<" + type_name + ">", iterations);
+    run_benchmark<boost::container::static_vector<T, Capacity>>("boost::container::static_vector<" + type_name + ">",
+                                                                iterations);
+    run_benchmark<reserved_vector<T>>("std::vector<" + type_name + ">", iterations);
+}
+
+int main() {
+    static const std::size_t Iterations = 200000U;
+
+    run_all<std::uint8_t>("std::uint8_t", Iterations);
+    run_all<std::uint32_t>("std::uint32_t", Iterations);
+    return 0;
+}
@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2021 Aleksei Moskvin <alalmoskvin@gmail.com>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/variant.hpp>
+
+using namespace nil::marshalling;
+
+using benchmark_field_base = field_type<option::big_endian>;
+
+template<std::size_t TIdx>
+using member_field = types::integral<benchmark_field_base, std::uint32_t, option::default_num_value<TIdx>>;
+
+template<std::size_t TCount, typename... TMembers>
+struct members_builder : public members_builder<TCount - 1, member_field<TCount - 1>, TMembers...> { };
+
+template<typename... TMembers>
+struct members_builder<0U, TMembers...> {
+    using type = std::tuple<TMembers...>;
+};
+
+template<std::size_t TCount>
+using variant_field = types::variant<benchmark_field_base, typename members_builder<TCount>::type>;
+
+template<typename TField, std::size_t TIdx>
+struct variants_filler {
+    static void fill(std::vector<TField> &fields) {
+        variants_filler<TField, TIdx - 1>::fill(fields);
+        fields.emplace_back();
+        fields.back().template init_field<TIdx - 1>();
+    }
+};
+
+template<typename TField>
+struct variants_filler<TField, 0U> {
+    static void fill(std::vector<TField> &) {
+    }
+};
+
+template<std::size_t TCount>
+void run_benchmark(std::size_t iterations) {
+    using variant_type = variant_field<TCount>;
+
+    std::vector<variant_type> fields;
+    fields.reserve(TCount);
+    variants_filler<variant_type, TCount>::fill(fields);
+
+    std::vector<std::uint8_t> buf(sizeof(std::uint32_t));
+    std::size_t checksum = 0U;
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0U; i < iterations; ++i) {
+        // Walk members with a stride to keep the active index unpredictable
+        auto &field = fields[(i * 7U) % TCount];
+        auto iter = buf.begin();
+        checksum += field.length();
+        checksum += static_cast<std::size_t>(field.write(iter, buf.size()));
+        checksum += static_cast<std::size_t>(field.valid());
+        checksum += buf[3];
+    }
+    auto finish = std::chrono::steady_clock::now();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+    std::cout << TCount << " members: " << static_cast<double>(elapsed) / static_cast<double>(iterations)
+              << " ns/op (checksum " << checksum << ")" << std::endl;
+}
+
+int main() {
+    static const std::size_t Iterations = 10000000U;
+
+    run_benchmark<4>(Iterations);
+    run_benchmark<16>(Iterations);
+    run_benchmark<64>(Iterations);
+    return 0;
+}
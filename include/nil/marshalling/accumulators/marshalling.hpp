@@ -0,0 +1,192 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_ACCUMULATORS_MARSHALLING_HPP
+#define MARSHALLING_ACCUMULATORS_MARSHALLING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/extractor.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/mpl/always.hpp>
+
+#include <nil/detail/type_traits.hpp>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/type_traits.hpp>
+#include <nil/marshalling/detail/incremental_reader.hpp>
+
+#include <nil/marshalling/accumulators/parameters/buffer_length.hpp>
+#include <nil/marshalling/accumulators/parameters/expected_status.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace accumulators {
+            namespace impl {
+                /// @brief Resumable decoder of the marshalling field.
+                /// @details Every sample is a chunk of serialized data: either a range of bytes or an
+                ///     iterator accompanied by @ref buffer_length parameter. Chunks are decoded as they
+                ///     arrive, only the incomplete trailing part of a fixed length field (or of a field
+                ///     not supporting incremental decoding) is kept in between the calls.
+                ///     Passing @ref expected_status equal to status_type::success marks the chunk as
+                ///     the last one, which finalizes sequences without size information.
+                template<typename TypeToProcess>
+                struct marshalling_impl : boost::accumulators::accumulator_base {
+                protected:
+                    using reader_type = nil::marshalling::detail::incremental_reader<TypeToProcess>;
+
+                public:
+                    using result_type = TypeToProcess;
+
+                    template<typename Args>
+                    marshalling_impl(const Args &) : leftover_(0U) {
+                    }
+
+                    template<typename ArgumentPack>
+                    void operator()(const ArgumentPack &args) {
+                        resolve_type(args[boost::accumulators::sample], args[buffer_length | std::size_t()],
+                                     args[expected_status | status_type::not_enough_data]);
+                    }
+
+                    result_type result(boost::accumulators::dont_care) const {
+                        return reader_.field();
+                    }
+
+                    /// @brief Current decoding status.
+                    status_type status() const {
+                        return reader_.status();
+                    }
+
+                    /// @brief Number of bytes consumed by the field so far.
+                    std::size_t consumed() const {
+                        return reader_.consumed();
+                    }
+
+                    /// @brief Number of bytes received after the field has been completed.
+                    std::size_t leftover() const {
+                        return leftover_;
+                    }
+
+                protected:
+                    template<typename TRange>
+                    typename std::enable_if<nil::detail::is_range<TRange>::value>::type
+                        resolve_type(const TRange &chunk, std::size_t, status_type expected) {
+                        process_range(chunk, expected == status_type::success,
+                                      std::integral_constant<bool, has_member_function_data<const TRange>::value>());
+                    }
+
+                    template<typename InputIterator>
+                    typename std::enable_if<!nil::detail::is_range<InputIterator>::value>::type
+                        resolve_type(InputIterator first, std::size_t len, status_type expected) {
+                        process_iterator(first, len, expected == status_type::success,
+                                         std::is_pointer<InputIterator>());
+                    }
+
+                    template<typename TRange>
+                    void process_range(const TRange &chunk, bool last, std::true_type) {
+                        process(reinterpret_cast<const std::uint8_t *>(chunk.data()),
+                                static_cast<std::size_t>(std::distance(std::begin(chunk), std::end(chunk))), last);
+                    }
+
+                    template<typename TRange>
+                    void process_range(const TRange &chunk, bool last, std::false_type) {
+                        std::vector<std::uint8_t> buf(std::begin(chunk), std::end(chunk));
+                        process(buf.data(), buf.size(), last);
+                    }
+
+                    template<typename InputIterator>
+                    void process_iterator(InputIterator first, std::size_t len, bool last, std::true_type) {
+                        static_assert(sizeof(typename std::iterator_traits<InputIterator>::value_type) == 1U,
+                                      "Chunk must consist of bytes");
+                        process(reinterpret_cast<const std::uint8_t *>(first), len, last);
+                    }
+
+                    template<typename InputIterator>
+                    void process_iterator(InputIterator first, std::size_t len, bool last, std::false_type) {
+                        std::vector<std::uint8_t> buf(len);
+                        std::copy_n(first, len, buf.begin());
+                        process(buf.data(), buf.size(), last);
+                    }
+
+                    void process(const std::uint8_t *iter, std::size_t len, bool last) {
+                        reader_.feed(iter, len, last);
+                        leftover_ += len;
+                    }
+
+                    reader_type reader_;
+                    std::size_t leftover_;
+                };
+            }    // namespace impl
+
+            namespace tag {
+                template<typename TypeToProcess>
+                struct marshalling : boost::accumulators::depends_on<> {
+                    /// INTERNAL ONLY
+                    ///
+
+                    typedef boost::mpl::always<accumulators::impl::marshalling_impl<TypeToProcess>> impl;
+                };
+            }    // namespace tag
+
+            namespace extract {
+                template<typename TypeToProcess, typename AccumulatorSet>
+                typename boost::mpl::apply<AccumulatorSet, tag::marshalling<TypeToProcess>>::type::result_type
+                    marshalling(const AccumulatorSet &acc) {
+                    return boost::accumulators::extract_result<tag::marshalling<TypeToProcess>>(acc);
+                }
+            }    // namespace extract
+
+            /// @brief Current decoding status of the accumulator.
+            /// @return status_type::success when the field is complete,
+            ///     status_type::not_enough_data when more data is expected, error status otherwise.
+            template<typename TypeToProcess, typename AccumulatorSet>
+            status_type status(const AccumulatorSet &acc) {
+                return boost::accumulators::find_accumulator<tag::marshalling<TypeToProcess>>(acc).status();
+            }
+
+            /// @brief Number of bytes the accumulated field consumed so far.
+            template<typename TypeToProcess, typename AccumulatorSet>
+            std::size_t consumed(const AccumulatorSet &acc) {
+                return boost::accumulators::find_accumulator<tag::marshalling<TypeToProcess>>(acc).consumed();
+            }
+
+            /// @brief Number of bytes received after the field has been completed.
+            template<typename TypeToProcess, typename AccumulatorSet>
+            std::size_t leftover(const AccumulatorSet &acc) {
+                return boost::accumulators::find_accumulator<tag::marshalling<TypeToProcess>>(acc).leftover();
+            }
+
+            using extract::marshalling;
+        }    // namespace accumulators
+    }        // namespace marshalling
+}    // namespace nil
+
+#endif    // MARSHALLING_ACCUMULATORS_MARSHALLING_HPP
@@ -27,7 +27,13 @@
 #ifndef MARSHALLING_REPACK_NEW_HPP
 #define MARSHALLING_REPACK_NEW_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
 #include <nil/marshalling/detail/repack_value.hpp>
+#include <nil/marshalling/detail/buffer_pack.hpp>
 
 namespace nil {
     namespace marshalling {
@@ -284,6 +290,276 @@ namespace nil {
             std::move(result.cbegin(), result.cend(), out);
             return status;
         }
+
+        /*!
+         * @brief Pack value directly into the caller provided byte buffer without
+         * any intermediate allocation. The required length is computed up front
+         * and nothing is written if the buffer is too small.
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam TOutputEndian
+         * @tparam TInputEndian
+         * @tparam TInput
+         * @tparam TOutput
+         *
+         * @param val
+         * @param out Pointer to the beginning of the output buffer.
+         * @param len Length of the output buffer.
+         * @param written Number of bytes written.
+         *
+         * @return status_type::buffer_overflow if the buffer is too small,
+         * status of the write operation otherwise.
+         */
+        template<typename TOutputEndian = option::big_endian, typename TInputEndian = option::big_endian,
+                 typename TInput, typename TOutput>
+        typename std::enable_if<!nil::detail::is_range<TInput>::value && detail::is_byte_output<TOutput>::value,
+                                status_type>::type
+            pack(const TInput &val, TOutput *out, std::size_t len, std::size_t &written) {
+            return detail::value_buffer_pack<TOutputEndian>(val, out, len, written);
+        }
+
+        /*!
+         * @brief Pack range of fixed length values directly into the caller
+         * provided byte buffer without any intermediate allocation.
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam TOutputEndian
+         * @tparam TInputEndian
+         * @tparam SinglePassRange
+         * @tparam TOutput
+         *
+         * @param rng_input
+         * @param out Pointer to the beginning of the output buffer.
+         * @param len Length of the output buffer.
+         * @param written Number of bytes written.
+         *
+         * @return status_type::buffer_overflow if the buffer is too small,
+         * status of the write operation otherwise.
+         */
+        template<typename TOutputEndian = option::big_endian, typename TInputEndian = option::big_endian,
+                 typename SinglePassRange, typename TOutput>
+        typename std::enable_if<nil::detail::is_range<SinglePassRange>::value && detail::is_byte_output<TOutput>::value,
+                                status_type>::type
+            pack(const SinglePassRange &rng_input, TOutput *out, std::size_t len, std::size_t &written) {
+            BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SinglePassRange>));
+            return detail::range_buffer_pack<TOutputEndian>(
+                std::begin(rng_input), static_cast<std::size_t>(std::distance(std::begin(rng_input), std::end(rng_input))),
+                out, len, written);
+        }
+
+        /*!
+         * @brief Pack sequence of fixed length values directly into the caller
+         * provided byte buffer without any intermediate allocation.
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam TOutputEndian
+         * @tparam TInputEndian
+         * @tparam InputIterator
+         * @tparam TOutput
+         *
+         * @param first
+         * @param last
+         * @param out Pointer to the beginning of the output buffer.
+         * @param len Length of the output buffer.
+         * @param written Number of bytes written.
+         *
+         * @return status_type::buffer_overflow if the buffer is too small,
+         * status of the write operation otherwise.
+         */
+        template<typename TOutputEndian = option::big_endian, typename TInputEndian = option::big_endian,
+                 typename InputIterator, typename TOutput>
+        typename std::enable_if<nil::detail::is_iterator<InputIterator>::value && detail::is_byte_output<TOutput>::value,
+                                status_type>::type
+            pack(InputIterator first, InputIterator last, TOutput *out, std::size_t len, std::size_t &written) {
+            BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<InputIterator>));
+            return detail::range_buffer_pack<TOutputEndian>(
+                first, static_cast<std::size_t>(std::distance(first, last)), out, len, written);
+        }
+
+        /*!
+         * @brief Pack range of fixed length values directly into the caller
+         * provided byte buffer splitting the work between several threads.
+         * Ranges shorter than the policy threshold are packed serially.
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam TOutputEndian
+         * @tparam TInputEndian
+         * @tparam SinglePassRange
+         * @tparam TOutput
+         *
+         * @param policy Parallel processing policy.
+         * @param rng_input
+         * @param out Pointer to the beginning of the output buffer.
+         * @param len Length of the output buffer.
+         * @param written Number of bytes written.
+         *
+         * @return status_type::buffer_overflow if the buffer is too small,
+         * status of the write operation otherwise.
+         */
+        template<typename TOutputEndian = option::big_endian, typename TInputEndian = option::big_endian,
+                 typename SinglePassRange, typename TOutput>
+        typename std::enable_if<nil::detail::is_range<SinglePassRange>::value && detail::is_byte_output<TOutput>::value,
+                                status_type>::type
+            pack(const parallel_policy &policy, const SinglePassRange &rng_input, TOutput *out, std::size_t len,
+                 std::size_t &written) {
+            BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SinglePassRange>));
+            return detail::range_buffer_pack<TOutputEndian>(
+                policy, std::begin(rng_input),
+                static_cast<std::size_t>(std::distance(std::begin(rng_input), std::end(rng_input))), out, len,
+                written);
+        }
+
+        /*!
+         * @brief Pack range of bytes into the caller provided buffer of fixed length
+         * values splitting the work between several threads. Ranges shorter than
+         * the policy threshold are packed serially.
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam TOutputEndian
+         * @tparam TInputEndian
+         * @tparam SinglePassRange
+         * @tparam TOutput
+         *
+         * @param policy Parallel processing policy.
+         * @param rng_input Random access range of bytes.
+         * @param out Pointer to the beginning of the output buffer.
+         * @param count Number of values the output buffer can hold.
+         * @param read Number of values decoded.
+         *
+         * @return status_type::buffer_overflow if the buffer is too small,
+         * status_type::not_enough_data if the input ends with incomplete value.
+         */
+        template<typename TOutputEndian = option::big_endian, typename TInputEndian = option::big_endian,
+                 typename SinglePassRange, typename TOutput>
+        typename std::enable_if<nil::detail::is_range<SinglePassRange>::value && !detail::is_byte_output<TOutput>::value
+                                    && nil::marshalling::is_supported_representation_type<
+                                        typename SinglePassRange::value_type>::value,
+                                status_type>::type
+            pack(const parallel_policy &policy, const SinglePassRange &rng_input, TOutput *out, std::size_t count,
+                 std::size_t &read) {
+            BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SinglePassRange>));
+            return detail::range_values_pack<TOutputEndian>(
+                policy, std::begin(rng_input),
+                static_cast<std::size_t>(std::distance(std::begin(rng_input), std::end(rng_input))), out, count,
+                read);
+        }
+
+        /*!
+         * @brief Maximal length of the serialized value of the type. Both marshalling
+         * types and types compatible with them are supported.
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam T
+         *
+         * @return Maximal serialization length in bytes.
+         */
+        template<typename T>
+        constexpr std::size_t max_packed_size() {
+            return detail::packed_type<T>::type::max_length();
+        }
+
+        /*!
+         * @brief Exact length of the serialized value of the type, available at compile
+         * time for the types with fixed serialization length only.
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam T
+         *
+         * @return Serialization length in bytes.
+         */
+        template<typename T>
+        constexpr typename std::enable_if<detail::has_fixed_packed_size<T>::value, std::size_t>::type packed_size() {
+            return max_packed_size<T>();
+        }
+
+        /*!
+         * @brief Exact length of the serialized marshalling value.
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam TInput
+         *
+         * @param val
+         *
+         * @return Serialization length in bytes.
+         */
+        template<typename TInput>
+        typename std::enable_if<is_marshalling_type<TInput>::value, std::size_t>::type
+            packed_size(const TInput &val) {
+            return val.length();
+        }
+
+        /*!
+         * @brief Exact length of the serialized value, which is not a range.
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam TInput
+         *
+         * @return Serialization length in bytes.
+         */
+        template<typename TInput>
+        constexpr typename std::enable_if<!is_marshalling_type<TInput>::value && !nil::detail::is_range<TInput>::value,
+                                          std::size_t>::type
+            packed_size(const TInput &) {
+            return packed_size<TInput>();
+        }
+
+        /*!
+         * @brief Exact length of the serialized range of values.
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam SinglePassRange
+         *
+         * @param rng_input
+         *
+         * @return Serialization length in bytes.
+         */
+        template<typename SinglePassRange>
+        typename std::enable_if<!is_marshalling_type<SinglePassRange>::value
+                                    && nil::detail::is_range<SinglePassRange>::value,
+                                std::size_t>::type
+            packed_size(const SinglePassRange &rng_input) {
+            using value_type = typename std::iterator_traits<decltype(std::begin(rng_input))>::value_type;
+            return static_cast<std::size_t>(std::distance(std::begin(rng_input), std::end(rng_input)))
+                   * packed_size<value_type>();
+        }
+
+        /*!
+         * @brief Pack value into the std::array allocated on stack, which is long enough
+         * to contain the longest possible serialization of the value.
+         * The actual serialization length can be retrieved with packed_size().
+         *
+         * @ingroup marshalling_algorithms
+         *
+         * @tparam TOutputEndian
+         * @tparam TInputEndian
+         * @tparam TInput Marshalling type or a type with fixed serialization length.
+         *
+         * @param val
+         * @param status
+         *
+         * @return std::array containing serialized value.
+         */
+        template<typename TOutputEndian = option::big_endian, typename TInputEndian = option::big_endian,
+                 typename TInput>
+        std::array<std::uint8_t, max_packed_size<TInput>()> pack_to_static(const TInput &val, status_type &status) {
+            static_assert(is_marshalling_type<TInput>::value || detail::has_fixed_packed_size<TInput>::value,
+                          "The serialization length of the type must be fixed");
+
+            std::array<std::uint8_t, max_packed_size<TInput>()> result = {};
+            std::size_t written = 0U;
+            status = pack<TOutputEndian, TInputEndian>(val, result.data(), result.size(), written);
+            return result;
+        }
     }    // namespace marshalling
 }    // namespace nil
 
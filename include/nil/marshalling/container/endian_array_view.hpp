@@ -0,0 +1,428 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_ENDIAN_ARRAY_VIEW_HPP
+#define MARSHALLING_ENDIAN_ARRAY_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/endian/conversion.hpp>
+
+#include <nil/marshalling/assert_type.hpp>
+#include <nil/marshalling/processing/detail/access.hpp>
+#include <nil/marshalling/processing/detail/bulk_access.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace container {
+
+            /// @brief Read only view on the serialized sequence of fixed width arithmetic values.
+            /// @details Similar to @ref array_view, but the viewed area contains the values in their
+            ///     serialized form, i.e. with the byte order defined by TEndian. No value is converted
+            ///     when the view is created, the conversion to the host byte order happens every time
+            ///     the element is accessed. As the result the elements are returned by value,
+            ///     not by reference.
+            /// @tparam T Type of the element, either the arithmetic type itself or the field type
+            ///     constructible from it.
+            /// @tparam TEndian Endianness of the viewed values, either
+            ///     nil::marshalling::endian::big_endian or nil::marshalling::endian::little_endian.
+            /// @tparam TValue Arithmetic type of the serialized value.
+            /// @headerfile "marshalling/container/endian_array_view.hpp"
+            template<typename T, typename TEndian, typename TValue = T>
+            class endian_array_view {
+                static_assert(std::is_arithmetic<TValue>::value, "The viewed values must be of arithmetic type");
+                static_assert((sizeof(TValue) == 1U) || (sizeof(TValue) == 2U) || (sizeof(TValue) == 4U)
+                                  || (sizeof(TValue) == 8U),
+                              "Only native word sizes are supported");
+
+                using word_type = typename processing::detail::size_to_type_helper<sizeof(TValue)>::type;
+
+            public:
+                /// @brief Type of the stored elements.
+                using value_type = T;
+
+                /// @brief Arithmetic type of the serialized values.
+                using raw_value_type = TValue;
+
+                /// @brief Endianness of the serialized values.
+                using endian_type = TEndian;
+
+                /// @brief Reference to the element, the elements are returned by value.
+                using reference = T;
+
+                /// @brief Const reference to the element, the elements are returned by value.
+                using const_reference = T;
+
+                /// @brief Type used for size information.
+                using size_type = std::size_t;
+
+                /// @brief Pointer to the viewed bytes.
+                using const_pointer = const std::uint8_t *;
+
+                /// @brief Random access iterator, decoding the element on dereference.
+                class const_iterator {
+                public:
+                    using iterator_category = std::random_access_iterator_tag;
+                    using value_type = T;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = void;
+                    using reference = T;
+
+                    const_iterator() noexcept = default;
+
+                    explicit const_iterator(const_pointer pos) noexcept : pos_(pos) {
+                    }
+
+                    reference operator*() const {
+                        return decode(pos_);
+                    }
+
+                    reference operator[](difference_type diff) const {
+                        return decode(pos_ + (diff * static_cast<difference_type>(sizeof(TValue))));
+                    }
+
+                    const_iterator &operator++() {
+                        pos_ += sizeof(TValue);
+                        return *this;
+                    }
+
+                    const_iterator operator++(int) {
+                        const_iterator copy(*this);
+                        ++(*this);
+                        return copy;
+                    }
+
+                    const_iterator &operator--() {
+                        pos_ -= sizeof(TValue);
+                        return *this;
+                    }
+
+                    const_iterator operator--(int) {
+                        const_iterator copy(*this);
+                        --(*this);
+                        return copy;
+                    }
+
+                    const_iterator &operator+=(difference_type diff) {
+                        pos_ += diff * static_cast<difference_type>(sizeof(TValue));
+                        return *this;
+                    }
+
+                    const_iterator &operator-=(difference_type diff) {
+                        pos_ -= diff * static_cast<difference_type>(sizeof(TValue));
+                        return *this;
+                    }
+
+                    const_iterator operator+(difference_type diff) const {
+                        const_iterator copy(*this);
+                        copy += diff;
+                        return copy;
+                    }
+
+                    friend const_iterator operator+(difference_type diff, const const_iterator &iter) {
+                        return iter + diff;
+                    }
+
+                    const_iterator operator-(difference_type diff) const {
+                        const_iterator copy(*this);
+                        copy -= diff;
+                        return copy;
+                    }
+
+                    difference_type operator-(const const_iterator &other) const {
+                        return (pos_ - other.pos_) / static_cast<difference_type>(sizeof(TValue));
+                    }
+
+                    bool operator==(const const_iterator &other) const {
+                        return pos_ == other.pos_;
+                    }
+
+                    bool operator!=(const const_iterator &other) const {
+                        return pos_ != other.pos_;
+                    }
+
+                    bool operator<(const const_iterator &other) const {
+                        return pos_ < other.pos_;
+                    }
+
+                    bool operator<=(const const_iterator &other) const {
+                        return pos_ <= other.pos_;
+                    }
+
+                    bool operator>(const const_iterator &other) const {
+                        return pos_ > other.pos_;
+                    }
+
+                    bool operator>=(const const_iterator &other) const {
+                        return pos_ >= other.pos_;
+                    }
+
+                    /// @brief Get pointer to the serialized bytes of the referenced element.
+                    const_pointer raw() const noexcept {
+                        return pos_;
+                    }
+
+                private:
+                    const_pointer pos_ = nullptr;
+                };
+
+                /// @brief Same as const_iterator, the view is read only.
+                using iterator = const_iterator;
+
+                /// @brief Const reverse iterator.
+                using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+                /// @brief Same as const_reverse_iterator, the view is read only.
+                using reverse_iterator = const_reverse_iterator;
+
+                /// @brief Default constructor, creates an empty view.
+                endian_array_view() noexcept = default;
+
+                /// @brief Copy constructor.
+                endian_array_view(const endian_array_view &) noexcept = default;
+
+                /// @brief Constructor.
+                /// @param[in] data Pointer to the first byte of the serialized values.
+                /// @param[in] len Number of the viewed values (not bytes).
+                endian_array_view(const_pointer data, size_type len) noexcept : data_(data), len_(len) {
+                }
+
+                /// @brief Destructor.
+                ~endian_array_view() noexcept = default;
+
+                /// @brief Copy assignment.
+                endian_array_view &operator=(const endian_array_view &) = default;
+
+                /// @brief Iterator to the first element.
+                const_iterator begin() const noexcept {
+                    return const_iterator(data_);
+                }
+
+                /// @brief Same as begin().
+                const_iterator cbegin() const noexcept {
+                    return begin();
+                }
+
+                /// @brief Iterator to the element following the last one.
+                const_iterator end() const noexcept {
+                    return const_iterator(data_ + raw_length());
+                }
+
+                /// @brief Same as end().
+                const_iterator cend() const noexcept {
+                    return end();
+                }
+
+                /// @brief Reverse iterator to the last element.
+                const_reverse_iterator rbegin() const noexcept {
+                    return const_reverse_iterator(end());
+                }
+
+                /// @brief Same as rbegin().
+                const_reverse_iterator crbegin() const noexcept {
+                    return rbegin();
+                }
+
+                /// @brief Reverse iterator to the element preceding the first one.
+                const_reverse_iterator rend() const noexcept {
+                    return const_reverse_iterator(begin());
+                }
+
+                /// @brief Same as rend().
+                const_reverse_iterator crend() const noexcept {
+                    return rend();
+                }
+
+                /// @brief Decode the element at specified position.
+                /// @details No range check is performed.
+                const_reference operator[](size_type pos) const {
+                    return decode(data_ + (pos * sizeof(TValue)));
+                }
+
+                /// @brief Decode the element at specified position.
+                /// @details Same as operator[], but checks the range with
+                ///     @ref MARSHALLING_ASSERT() macro.
+                const_reference at(size_type pos) const {
+                    MARSHALLING_ASSERT(pos < len_);
+                    return operator[](pos);
+                }
+
+                /// @brief Decode the first element.
+                /// @pre The view is not empty.
+                const_reference front() const {
+                    MARSHALLING_ASSERT(!empty());
+                    return operator[](0U);
+                }
+
+                /// @brief Decode the last element.
+                /// @pre The view is not empty.
+                const_reference back() const {
+                    MARSHALLING_ASSERT(!empty());
+                    return operator[](len_ - 1U);
+                }
+
+                /// @brief Decode several elements in a single pass.
+                /// @details Uses the same block conversion as the bulk read of the values.
+                /// @param[out] values Pointer to the area receiving the values in host byte order.
+                /// @param[in] count Number of values to decode.
+                /// @param[in] pos Position of the first value to decode.
+                /// @return Number of decoded values.
+                size_type copy(TValue *values, size_type count, size_type pos = 0U) const {
+                    MARSHALLING_ASSERT(pos <= len_);
+                    count = std::min(count, len_ - pos);
+                    processing::detail::bulk_word_access<TEndian, sizeof(TValue)>::convert(
+                        data_ + (pos * sizeof(TValue)), reinterpret_cast<std::uint8_t *>(values), count);
+                    return count;
+                }
+
+                /// @brief Number of the viewed elements.
+                size_type size() const noexcept {
+                    return len_;
+                }
+
+                /// @brief Same as size().
+                size_type length() const noexcept {
+                    return size();
+                }
+
+                /// @brief Check whether the view is empty.
+                bool empty() const noexcept {
+                    return len_ == 0U;
+                }
+
+                /// @brief Pointer to the serialized bytes of the first element.
+                const_pointer raw_data() const noexcept {
+                    return data_;
+                }
+
+                /// @brief Number of the viewed bytes.
+                size_type raw_length() const noexcept {
+                    return len_ * sizeof(TValue);
+                }
+
+                /// @brief Narrow the view by moving its start forward.
+                void remove_prefix(size_type n) {
+                    MARSHALLING_ASSERT(n <= len_);
+                    data_ += n * sizeof(TValue);
+                    len_ -= n;
+                }
+
+                /// @brief Narrow the view by moving its end backward.
+                void remove_suffix(size_type n) {
+                    MARSHALLING_ASSERT(n <= len_);
+                    len_ -= n;
+                }
+
+                /// @brief Swap contents of two views.
+                void swap(endian_array_view &other) noexcept {
+                    std::swap(data_, other.data_);
+                    std::swap(len_, other.len_);
+                }
+
+            private:
+                static T decode(const_pointer pos) {
+                    word_type word;
+                    std::memcpy(&word, pos, sizeof(word));
+                    word = boost::endian::conditional_reverse<processing::detail::endian_order<TEndian>::value,
+                                                              boost::endian::order::native>(word);
+                    TValue value;
+                    std::memcpy(&value, &word, sizeof(value));
+                    return T(value);
+                }
+
+                const_pointer data_ = nullptr;
+                size_type len_ = 0;
+            };
+
+            /// @brief Lexicographical compare between the views.
+            /// @related endian_array_view
+            template<typename T, typename TEndian, typename TValue>
+            bool operator<(const endian_array_view<T, TEndian, TValue> &view1,
+                           const endian_array_view<T, TEndian, TValue> &view2) {
+                return std::lexicographical_compare(view1.begin(), view1.end(), view2.begin(), view2.end());
+            }
+
+            /// @brief Lexicographical compare between the views.
+            /// @related endian_array_view
+            template<typename T, typename TEndian, typename TValue>
+            bool operator<=(const endian_array_view<T, TEndian, TValue> &view1,
+                            const endian_array_view<T, TEndian, TValue> &view2) {
+                return !(view2 < view1);
+            }
+
+            /// @brief Lexicographical compare between the views.
+            /// @related endian_array_view
+            template<typename T, typename TEndian, typename TValue>
+            bool operator>(const endian_array_view<T, TEndian, TValue> &view1,
+                           const endian_array_view<T, TEndian, TValue> &view2) {
+                return (view2 < view1);
+            }
+
+            /// @brief Lexicographical compare between the views.
+            /// @related endian_array_view
+            template<typename T, typename TEndian, typename TValue>
+            bool operator>=(const endian_array_view<T, TEndian, TValue> &view1,
+                            const endian_array_view<T, TEndian, TValue> &view2) {
+                return !(view1 < view2);
+            }
+
+            /// @brief Equality compare between the views.
+            /// @details Compares the decoded values, not the viewed bytes.
+            /// @related endian_array_view
+            template<typename T, typename TEndian, typename TValue>
+            bool operator==(const endian_array_view<T, TEndian, TValue> &view1,
+                            const endian_array_view<T, TEndian, TValue> &view2) {
+                return (view1.size() == view2.size()) && std::equal(view1.begin(), view1.end(), view2.begin());
+            }
+
+            /// @brief Inequality compare between the views.
+            /// @related endian_array_view
+            template<typename T, typename TEndian, typename TValue>
+            bool operator!=(const endian_array_view<T, TEndian, TValue> &view1,
+                            const endian_array_view<T, TEndian, TValue> &view2) {
+                return !(view1 == view2);
+            }
+
+        }    // namespace container
+    }    // namespace marshalling
+}    // namespace nil
+
+namespace std {
+
+    /// @brief Specializes the std::swap algorithm.
+    /// @related nil::marshalling::container::endian_array_view
+    template<typename T, typename TEndian, typename TValue>
+    void swap(nil::marshalling::container::endian_array_view<T, TEndian, TValue> &view1,
+              nil::marshalling::container::endian_array_view<T, TEndian, TValue> &view2) {
+        view1.swap(view2);
+    }
+
+}    // namespace std
+#endif    // MARSHALLING_ENDIAN_ARRAY_VIEW_HPP
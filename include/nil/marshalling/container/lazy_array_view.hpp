@@ -0,0 +1,471 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_LAZY_ARRAY_VIEW_HPP
+#define MARSHALLING_LAZY_ARRAY_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nil/marshalling/assert_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace container {
+
+            namespace detail {
+
+                template<typename T, bool TCached>
+                struct lazy_array_view_cache {
+                    std::map<std::size_t, T> elements_;
+                };
+
+                template<typename T>
+                struct lazy_array_view_cache<T, false> { };
+
+            }    // namespace detail
+
+            /// @brief View on the serialized sequence of fixed length fields, which are
+            ///     decoded on demand.
+            /// @details The view doesn't decode anything when created, it just remembers
+            ///     the location of the serialized data. Since every element has the same
+            ///     serialization length, the element at any position is located and decoded
+            ///     only when it is accessed. When TCached is @b true, the elements can be
+            ///     updated using @ref modify(), the decoded copy is kept in the view and
+            ///     replaces the original one on every subsequent access. When the view is
+            ///     written, the untouched elements are copied as raw bytes, only the
+            ///     cached ones are serialized again. The const access never modifies
+            ///     the view, so it is safe to read the same view from multiple threads.
+            /// @tparam T Type of the element field, must have fixed serialization length
+            ///     and its read must not fail on the valid length of the data.
+            /// @tparam TCached Enable cache of the decoded (modified) elements.
+            /// @headerfile "marshalling/container/lazy_array_view.hpp"
+            template<typename T, bool TCached = false>
+            class lazy_array_view : private detail::lazy_array_view_cache<T, TCached> {
+                using cache_base_type = detail::lazy_array_view_cache<T, TCached>;
+
+            public:
+                /// @brief Type of the stored elements.
+                using value_type = T;
+
+                /// @brief Reference to the element, the elements are returned by value.
+                using reference = T;
+
+                /// @brief Const reference to the element, the elements are returned by value.
+                using const_reference = T;
+
+                /// @brief Type used for size information.
+                using size_type = std::size_t;
+
+                /// @brief Pointer to the viewed bytes.
+                using const_pointer = const std::uint8_t *;
+
+                /// @brief Random access iterator, decoding the element on dereference.
+                class const_iterator {
+                public:
+                    using iterator_category = std::random_access_iterator_tag;
+                    using value_type = T;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = void;
+                    using reference = T;
+
+                    const_iterator() noexcept = default;
+
+                    const_iterator(const lazy_array_view *view, size_type idx) noexcept : view_(view), idx_(idx) {
+                    }
+
+                    reference operator*() const {
+                        return (*view_)[idx_];
+                    }
+
+                    reference operator[](difference_type diff) const {
+                        return (*view_)[static_cast<size_type>(static_cast<difference_type>(idx_) + diff)];
+                    }
+
+                    const_iterator &operator++() {
+                        ++idx_;
+                        return *this;
+                    }
+
+                    const_iterator operator++(int) {
+                        const_iterator copy(*this);
+                        ++idx_;
+                        return copy;
+                    }
+
+                    const_iterator &operator--() {
+                        --idx_;
+                        return *this;
+                    }
+
+                    const_iterator operator--(int) {
+                        const_iterator copy(*this);
+                        --idx_;
+                        return copy;
+                    }
+
+                    const_iterator &operator+=(difference_type diff) {
+                        idx_ = static_cast<size_type>(static_cast<difference_type>(idx_) + diff);
+                        return *this;
+                    }
+
+                    const_iterator &operator-=(difference_type diff) {
+                        return (*this) += (-diff);
+                    }
+
+                    const_iterator operator+(difference_type diff) const {
+                        const_iterator copy(*this);
+                        copy += diff;
+                        return copy;
+                    }
+
+                    friend const_iterator operator+(difference_type diff, const const_iterator &iter) {
+                        return iter + diff;
+                    }
+
+                    const_iterator operator-(difference_type diff) const {
+                        const_iterator copy(*this);
+                        copy -= diff;
+                        return copy;
+                    }
+
+                    difference_type operator-(const const_iterator &other) const {
+                        return static_cast<difference_type>(idx_) - static_cast<difference_type>(other.idx_);
+                    }
+
+                    bool operator==(const const_iterator &other) const {
+                        return (view_ == other.view_) && (idx_ == other.idx_);
+                    }
+
+                    bool operator!=(const const_iterator &other) const {
+                        return !(*this == other);
+                    }
+
+                    bool operator<(const const_iterator &other) const {
+                        return idx_ < other.idx_;
+                    }
+
+                    bool operator<=(const const_iterator &other) const {
+                        return idx_ <= other.idx_;
+                    }
+
+                    bool operator>(const const_iterator &other) const {
+                        return idx_ > other.idx_;
+                    }
+
+                    bool operator>=(const const_iterator &other) const {
+                        return idx_ >= other.idx_;
+                    }
+
+                private:
+                    const lazy_array_view *view_ = nullptr;
+                    size_type idx_ = 0U;
+                };
+
+                /// @brief Same as const_iterator, the elements are updated using @ref modify().
+                using iterator = const_iterator;
+
+                /// @brief Const reverse iterator.
+                using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+                /// @brief Same as const_reverse_iterator.
+                using reverse_iterator = const_reverse_iterator;
+
+                /// @brief Default constructor, creates an empty view.
+                lazy_array_view() = default;
+
+                /// @brief Constructor.
+                /// @param[in] data Pointer to the first byte of the serialized elements.
+                /// @param[in] len Number of the viewed elements (not bytes).
+                lazy_array_view(const_pointer data, size_type len) : data_(data), len_(len) {
+                }
+
+                /// @brief Serialization length of a single element.
+                static constexpr size_type element_length() {
+                    return T::max_length();
+                }
+
+                /// @brief Iterator to the first element.
+                const_iterator begin() const noexcept {
+                    return const_iterator(this, 0U);
+                }
+
+                /// @brief Same as begin().
+                const_iterator cbegin() const noexcept {
+                    return begin();
+                }
+
+                /// @brief Iterator to the element following the last one.
+                const_iterator end() const noexcept {
+                    return const_iterator(this, len_);
+                }
+
+                /// @brief Same as end().
+                const_iterator cend() const noexcept {
+                    return end();
+                }
+
+                /// @brief Reverse iterator to the last element.
+                const_reverse_iterator rbegin() const noexcept {
+                    return const_reverse_iterator(end());
+                }
+
+                /// @brief Same as rbegin().
+                const_reverse_iterator crbegin() const noexcept {
+                    return rbegin();
+                }
+
+                /// @brief Reverse iterator to the element preceding the first one.
+                const_reverse_iterator rend() const noexcept {
+                    return const_reverse_iterator(begin());
+                }
+
+                /// @brief Same as rend().
+                const_reverse_iterator crend() const noexcept {
+                    return rend();
+                }
+
+                /// @brief Get the element at specified position.
+                /// @details Returns the cached copy of the element if such exists,
+                ///     decodes the element from the viewed data otherwise.
+                ///     No range check is performed.
+                const_reference operator[](size_type pos) const {
+                    return get(pos, cache_tag());
+                }
+
+                /// @brief Get the element at specified position.
+                /// @details Same as operator[], but checks the range with
+                ///     @ref MARSHALLING_ASSERT() macro.
+                const_reference at(size_type pos) const {
+                    MARSHALLING_ASSERT(pos < len_);
+                    return operator[](pos);
+                }
+
+                /// @brief Get the first element.
+                /// @pre The view is not empty.
+                const_reference front() const {
+                    MARSHALLING_ASSERT(!empty());
+                    return operator[](0U);
+                }
+
+                /// @brief Get the last element.
+                /// @pre The view is not empty.
+                const_reference back() const {
+                    MARSHALLING_ASSERT(!empty());
+                    return operator[](len_ - 1U);
+                }
+
+                /// @brief Get access to the cached copy of the element for update.
+                /// @details The element is decoded and put into the cache on the first
+                ///     access. Available only when TCached is @b true.
+                /// @pre pos < size()
+                T &modify(size_type pos) {
+                    static_assert(TCached, "The cache of the decoded elements is disabled");
+                    MARSHALLING_ASSERT(pos < len_);
+                    auto iter = this->elements_.find(pos);
+                    if (iter == this->elements_.end()) {
+                        iter = this->elements_.insert(std::make_pair(pos, decode(pos))).first;
+                    }
+                    return iter->second;
+                }
+
+                /// @brief Number of the cached elements.
+                size_type cached_count() const {
+                    return cached_count_internal(cache_tag());
+                }
+
+                /// @brief Drop all the cached elements, discarding their updates.
+                void clear_cache() {
+                    clear_cache_internal(cache_tag());
+                }
+
+                /// @brief Decode all the elements.
+                /// @return Vector of all the elements, the cached ones included.
+                std::vector<T> materialize() const {
+                    return std::vector<T>(begin(), end());
+                }
+
+                /// @brief Write first count elements into the output area.
+                /// @details The bytes of the elements, that are not cached, are copied
+                ///     as is, the cached ones are serialized.
+                /// @pre count <= size()
+                template<typename TIter>
+                void write(size_type count, TIter &iter) const {
+                    MARSHALLING_ASSERT(count <= len_);
+                    write_internal(count, iter, cache_tag());
+                }
+
+                /// @brief Number of the viewed elements.
+                size_type size() const noexcept {
+                    return len_;
+                }
+
+                /// @brief Same as size().
+                size_type length() const noexcept {
+                    return size();
+                }
+
+                /// @brief Check whether the view is empty.
+                bool empty() const noexcept {
+                    return len_ == 0U;
+                }
+
+                /// @brief Pointer to the serialized bytes of the first element.
+                const_pointer raw_data() const noexcept {
+                    return data_;
+                }
+
+                /// @brief Number of the viewed bytes.
+                size_type raw_length() const noexcept {
+                    return len_ * element_length();
+                }
+
+            private:
+                struct cached_tag { };
+                struct not_cached_tag { };
+
+                using cache_tag = typename std::conditional<TCached, cached_tag, not_cached_tag>::type;
+
+                T decode(size_type pos) const {
+                    T elem;
+                    const_pointer iter = data_ + (pos * element_length());
+                    // The length of the data is checked when the view is created, and the elements,
+                    // which can fail the read on their own, are rejected by array_list.
+                    status_type es = elem.read(iter, element_length());
+                    static_cast<void>(es);
+                    MARSHALLING_ASSERT(es == status_type::success);
+                    return elem;
+                }
+
+                T get(size_type pos, not_cached_tag) const {
+                    return decode(pos);
+                }
+
+                T get(size_type pos, cached_tag) const {
+                    auto iter = this->elements_.find(pos);
+                    if (iter != this->elements_.end()) {
+                        return iter->second;
+                    }
+                    return decode(pos);
+                }
+
+                static constexpr size_type cached_count_internal(not_cached_tag) {
+                    return 0U;
+                }
+
+                size_type cached_count_internal(cached_tag) const {
+                    return this->elements_.size();
+                }
+
+                static void clear_cache_internal(not_cached_tag) {
+                }
+
+                void clear_cache_internal(cached_tag) {
+                    this->elements_.clear();
+                }
+
+                template<typename TIter>
+                void write_raw(size_type from, size_type to, TIter &iter) const {
+                    iter = std::copy(data_ + (from * element_length()), data_ + (to * element_length()), iter);
+                }
+
+                template<typename TIter>
+                void write_internal(size_type count, TIter &iter, not_cached_tag) const {
+                    write_raw(0U, count, iter);
+                }
+
+                template<typename TIter>
+                void write_internal(size_type count, TIter &iter, cached_tag) const {
+                    size_type written = 0U;
+                    for (auto &elem : this->elements_) {
+                        if (count <= elem.first) {
+                            break;
+                        }
+
+                        write_raw(written, elem.first, iter);
+                        elem.second.write_no_status(iter);
+                        written = elem.first + 1U;
+                    }
+                    write_raw(written, count, iter);
+                }
+
+                const_pointer data_ = nullptr;
+                size_type len_ = 0;
+            };
+
+            /// @brief Lexicographical compare between the views.
+            /// @related lazy_array_view
+            template<typename T, bool TCached>
+            bool operator<(const lazy_array_view<T, TCached> &view1, const lazy_array_view<T, TCached> &view2) {
+                return std::lexicographical_compare(view1.begin(), view1.end(), view2.begin(), view2.end());
+            }
+
+            /// @brief Lexicographical compare between the views.
+            /// @related lazy_array_view
+            template<typename T, bool TCached>
+            bool operator<=(const lazy_array_view<T, TCached> &view1, const lazy_array_view<T, TCached> &view2) {
+                return !(view2 < view1);
+            }
+
+            /// @brief Lexicographical compare between the views.
+            /// @related lazy_array_view
+            template<typename T, bool TCached>
+            bool operator>(const lazy_array_view<T, TCached> &view1, const lazy_array_view<T, TCached> &view2) {
+                return (view2 < view1);
+            }
+
+            /// @brief Lexicographical compare between the views.
+            /// @related lazy_array_view
+            template<typename T, bool TCached>
+            bool operator>=(const lazy_array_view<T, TCached> &view1, const lazy_array_view<T, TCached> &view2) {
+                return !(view1 < view2);
+            }
+
+            /// @brief Equality compare between the views.
+            /// @details Compares the decoded elements, not the viewed bytes.
+            /// @related lazy_array_view
+            template<typename T, bool TCached>
+            bool operator==(const lazy_array_view<T, TCached> &view1, const lazy_array_view<T, TCached> &view2) {
+                return (view1.size() == view2.size()) && std::equal(view1.begin(), view1.end(), view2.begin());
+            }
+
+            /// @brief Inequality compare between the views.
+            /// @related lazy_array_view
+            template<typename T, bool TCached>
+            bool operator!=(const lazy_array_view<T, TCached> &view1, const lazy_array_view<T, TCached> &view2) {
+                return !(view1 == view2);
+            }
+
+        }    // namespace container
+    }    // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_LAZY_ARRAY_VIEW_HPP
@@ -0,0 +1,395 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+/// @file nil/marshalling/container/memory_resource.hpp
+/// This file contains memory resources and the allocator used by the fields
+/// defined with @ref nil::marshalling::option::memory_resource_storage option.
+
+#ifndef MARSHALLING_MEMORY_RESOURCE_HPP
+#define MARSHALLING_MEMORY_RESOURCE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if (__cplusplus >= 201703L) && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+#endif
+
+#include <nil/marshalling/assert_type.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace container {
+
+#ifdef __cpp_lib_memory_resource
+
+            /// @brief Abstract memory resource, same as std::pmr::memory_resource when it is available.
+            using memory_resource = std::pmr::memory_resource;
+
+            /// @brief Memory resource allocating from a monotonically growing arena.
+            using monotonic_buffer_resource = std::pmr::monotonic_buffer_resource;
+
+            /// @brief Get memory resource using global operator new and operator delete.
+            inline memory_resource *new_delete_resource() noexcept {
+                return std::pmr::new_delete_resource();
+            }
+
+#else    // #ifdef __cpp_lib_memory_resource
+
+            /// @brief Abstract memory resource.
+            /// @details Provides the same interface as std::pmr::memory_resource, which
+            ///     is not available prior to C++17.
+            class memory_resource {
+                static const std::size_t max_align = alignof(std::max_align_t);
+
+            public:
+                virtual ~memory_resource() = default;
+
+                /// @brief Allocate @b bytes of storage aligned to @b alignment.
+                void *allocate(std::size_t bytes, std::size_t alignment = max_align) {
+                    return do_allocate(bytes, alignment);
+                }
+
+                /// @brief Deallocate storage previously returned by allocate().
+                void deallocate(void *p, std::size_t bytes, std::size_t alignment = max_align) {
+                    do_deallocate(p, bytes, alignment);
+                }
+
+                /// @brief Check whether memory allocated from this resource can be
+                ///     deallocated by @b other and vice versa.
+                bool is_equal(const memory_resource &other) const noexcept {
+                    return do_is_equal(other);
+                }
+
+            private:
+                virtual void *do_allocate(std::size_t bytes, std::size_t alignment) = 0;
+                virtual void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) = 0;
+                virtual bool do_is_equal(const memory_resource &other) const noexcept = 0;
+            };
+
+            /// @brief Equality comparison of memory resources.
+            inline bool operator==(const memory_resource &resource1, const memory_resource &resource2) noexcept {
+                return (&resource1 == &resource2) || resource1.is_equal(resource2);
+            }
+
+            /// @brief Inequality comparison of memory resources.
+            inline bool operator!=(const memory_resource &resource1, const memory_resource &resource2) noexcept {
+                return !(resource1 == resource2);
+            }
+
+            namespace detail {
+
+                class new_delete_memory_resource : public memory_resource {
+                    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+                        MARSHALLING_ASSERT(alignment <= alignof(std::max_align_t));
+                        static_cast<void>(alignment);
+                        return ::operator new(bytes);
+                    }
+
+                    void do_deallocate(void *p, std::size_t, std::size_t) override {
+                        ::operator delete(p);
+                    }
+
+                    bool do_is_equal(const memory_resource &other) const noexcept override {
+                        return this == &other;
+                    }
+                };
+
+            }    // namespace detail
+
+            /// @brief Get memory resource using global operator new and operator delete.
+            inline memory_resource *new_delete_resource() noexcept {
+                static detail::new_delete_memory_resource resource;
+                return &resource;
+            }
+
+            /// @brief Memory resource allocating from a monotonically growing arena.
+            /// @details Provides the same interface as std::pmr::monotonic_buffer_resource.
+            ///     Allocation bumps a pointer inside the current block, deallocation does
+            ///     nothing. When the current block is exhausted, the next one, twice as big,
+            ///     is requested from the upstream resource. All the blocks are returned
+            ///     to the upstream resource by release() or destructor.
+            class monotonic_buffer_resource : public memory_resource {
+                struct block_header {
+                    block_header *prev_;
+                    std::size_t size_;
+                };
+
+                static const std::size_t default_block_size = 1024U;
+
+            public:
+                /// @brief Constructor, the blocks are allocated from @ref new_delete_resource().
+                monotonic_buffer_resource() : monotonic_buffer_resource(new_delete_resource()) {
+                }
+
+                /// @brief Constructor, the blocks are allocated from @b upstream resource.
+                explicit monotonic_buffer_resource(memory_resource *upstream) :
+                    monotonic_buffer_resource(default_block_size, upstream) {
+                }
+
+                /// @brief Constructor, the first block allocated from @b upstream resource
+                ///     is at least @b initial_size bytes long.
+                explicit monotonic_buffer_resource(std::size_t initial_size,
+                                                   memory_resource *upstream = new_delete_resource()) :
+                    upstream_(upstream),
+                    initialBuf_(nullptr), initialSize_(0U), initialNextSize_(std::max(initial_size, std::size_t(1U))),
+                    current_(nullptr), left_(0U), nextSize_(initialNextSize_), blocks_(nullptr) {
+                }
+
+                /// @brief Constructor, allocations are served from the provided buffer first.
+                monotonic_buffer_resource(void *buffer, std::size_t buffer_size,
+                                          memory_resource *upstream = new_delete_resource()) :
+                    upstream_(upstream),
+                    initialBuf_(buffer), initialSize_(buffer_size),
+                    initialNextSize_(std::max(buffer_size * 2U, std::size_t(default_block_size))), current_(buffer),
+                    left_(buffer_size), nextSize_(initialNextSize_), blocks_(nullptr) {
+                }
+
+                monotonic_buffer_resource(const monotonic_buffer_resource &) = delete;
+
+                monotonic_buffer_resource &operator=(const monotonic_buffer_resource &) = delete;
+
+                /// @brief Destructor, returns all the allocated blocks to the upstream resource.
+                ~monotonic_buffer_resource() override {
+                    release();
+                }
+
+                /// @brief Return all the allocated blocks to the upstream resource.
+                /// @details The memory allocated from this resource becomes invalid.
+                void release() {
+                    while (blocks_ != nullptr) {
+                        auto *prev = blocks_->prev_;
+                        upstream_->deallocate(blocks_, blocks_->size_, alignof(std::max_align_t));
+                        blocks_ = prev;
+                    }
+
+                    current_ = initialBuf_;
+                    left_ = initialSize_;
+                    nextSize_ = initialNextSize_;
+                }
+
+                /// @brief Get upstream resource.
+                memory_resource *upstream_resource() const {
+                    return upstream_;
+                }
+
+            private:
+                void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+                    auto *result = std::align(alignment, bytes, current_, left_);
+                    if (result == nullptr) {
+                        add_block(bytes + alignment);
+                        result = std::align(alignment, bytes, current_, left_);
+                        MARSHALLING_ASSERT(result != nullptr);
+                    }
+
+                    current_ = static_cast<std::uint8_t *>(current_) + bytes;
+                    left_ -= bytes;
+                    return result;
+                }
+
+                void do_deallocate(void *, std::size_t, std::size_t) override {
+                }
+
+                bool do_is_equal(const memory_resource &other) const noexcept override {
+                    return this == &other;
+                }
+
+                void add_block(std::size_t required) {
+                    auto size = std::max(nextSize_, required + sizeof(block_header));
+                    auto *block = static_cast<block_header *>(upstream_->allocate(size, alignof(std::max_align_t)));
+                    block->prev_ = blocks_;
+                    block->size_ = size;
+                    blocks_ = block;
+
+                    current_ = block + 1;
+                    left_ = size - sizeof(block_header);
+                    nextSize_ = size * 2U;
+                }
+
+                memory_resource *upstream_;
+                void *initialBuf_;
+                std::size_t initialSize_;
+                std::size_t initialNextSize_;
+                void *current_;
+                std::size_t left_;
+                std::size_t nextSize_;
+                block_header *blocks_;
+            };
+
+#endif    // #ifdef __cpp_lib_memory_resource
+
+            /// @brief Select memory resource used by the @ref resource_allocator objects
+            ///     created by the current thread during the lifetime of this object.
+            /// @details The fields defined with @ref nil::marshalling::option::memory_resource_storage
+            ///     option re-create their storage with the selected resource when they are read,
+            ///     so all such fields of a message (including the ones nested in bundles and lists)
+            ///     read while the scope is active allocate from the same resource, regardless of
+            ///     where the message has been created.
+            ///     For example, with an arena:
+            ///     @code
+            ///     nil::marshalling::container::monotonic_buffer_resource arena;
+            ///     nil::marshalling::container::memory_resource_scope scope(arena);
+            ///     Message msg;
+            ///     msg.read(iter, len);
+            ///     @endcode
+            ///     The fields must be destroyed before the resource is released.
+            ///     Scopes can be nested, the destructor restores the previously selected resource.
+            class memory_resource_scope {
+            public:
+                /// @brief Constructor, selects @b resource for the current thread.
+                explicit memory_resource_scope(memory_resource &resource) : prev_(current_ref()) {
+                    current_ref() = &resource;
+                }
+
+                memory_resource_scope(const memory_resource_scope &) = delete;
+
+                memory_resource_scope &operator=(const memory_resource_scope &) = delete;
+
+                /// @brief Destructor, restores previously selected resource.
+                ~memory_resource_scope() {
+                    current_ref() = prev_;
+                }
+
+                /// @brief Get resource selected for the current thread.
+                /// @return Resource of the innermost active scope or @ref new_delete_resource()
+                ///     if there is none.
+                static memory_resource *current() noexcept {
+                    auto *resource = current_ref();
+                    if (resource == nullptr) {
+                        return new_delete_resource();
+                    }
+                    return resource;
+                }
+
+            private:
+                static memory_resource *&current_ref() noexcept {
+                    static thread_local memory_resource *resource = nullptr;
+                    return resource;
+                }
+
+                memory_resource *prev_;
+            };
+
+            /// @brief Allocator using @ref memory_resource.
+            /// @details Similar to std::pmr::polymorphic_allocator, but default constructed
+            ///     allocator (as well as the one used by copy constructed container) uses
+            ///     the resource selected by @ref memory_resource_scope for the current thread.
+            ///     Unlike std::pmr::polymorphic_allocator, the allocator follows the storage on
+            ///     move assignment and swap, so the storage can be re-created from another resource
+            ///     by assignment, while copy assignment keeps the resource of the target.
+            /// @tparam T Type of allocated objects.
+            template<typename T>
+            class resource_allocator {
+                template<typename U>
+                friend class resource_allocator;
+
+            public:
+                /// @brief Type of allocated objects.
+                using value_type = T;
+
+                /// @brief The target of copy assignment keeps its resource.
+                using propagate_on_container_copy_assignment = std::false_type;
+
+                /// @brief The target of move assignment takes over the resource of the source.
+                using propagate_on_container_move_assignment = std::true_type;
+
+                /// @brief The resources are swapped together with the storage.
+                using propagate_on_container_swap = std::true_type;
+
+                /// @brief The allocators using different resources are not interchangeable.
+                using is_always_equal = std::false_type;
+
+                /// @brief Constructor, uses @ref memory_resource_scope::current() resource.
+                resource_allocator() noexcept : resource_(memory_resource_scope::current()) {
+                }
+
+                /// @brief Constructor, uses provided resource.
+                resource_allocator(memory_resource *resource) noexcept : resource_(resource) {
+                    MARSHALLING_ASSERT(resource != nullptr);
+                }
+
+                /// @brief Converting constructor.
+                template<typename U>
+                resource_allocator(const resource_allocator<U> &other) noexcept : resource_(other.resource_) {
+                }
+
+                /// @brief Allocate storage for @b count objects.
+                T *allocate(std::size_t count) {
+                    return static_cast<T *>(resource_->allocate(count * sizeof(T), alignof(T)));
+                }
+
+                /// @brief Deallocate storage previously returned by allocate().
+                void deallocate(T *p, std::size_t count) {
+                    resource_->deallocate(p, count * sizeof(T), alignof(T));
+                }
+
+                /// @brief Allocator for the copy constructed container, uses
+                ///     @ref memory_resource_scope::current() resource.
+                resource_allocator select_on_container_copy_construction() const {
+                    return resource_allocator();
+                }
+
+                /// @brief Get used memory resource.
+                memory_resource *resource() const noexcept {
+                    return resource_;
+                }
+
+            private:
+                memory_resource *resource_;
+            };
+
+            /// @brief Equality comparison of allocators.
+            /// @related resource_allocator
+            template<typename T, typename U>
+            bool operator==(const resource_allocator<T> &alloc1, const resource_allocator<U> &alloc2) noexcept {
+                return *alloc1.resource() == *alloc2.resource();
+            }
+
+            /// @brief Inequality comparison of allocators.
+            /// @related resource_allocator
+            template<typename T, typename U>
+            bool operator!=(const resource_allocator<T> &alloc1, const resource_allocator<U> &alloc2) noexcept {
+                return !(alloc1 == alloc2);
+            }
+
+            /// @brief Vector allocating from @ref memory_resource.
+            template<typename T>
+            using resource_vector = std::vector<T, resource_allocator<T>>;
+
+            /// @brief String allocating from @ref memory_resource.
+            using resource_string = std::basic_string<char, std::char_traits<char>, resource_allocator<char>>;
+
+        }    // namespace container
+    }    // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_MEMORY_RESOURCE_HPP
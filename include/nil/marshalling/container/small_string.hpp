@@ -0,0 +1,746 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_SMALL_STRING_HPP
+#define MARSHALLING_SMALL_STRING_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <initializer_list>
+
+#include <nil/marshalling/assert_type.hpp>
+#include <nil/marshalling/container/small_vector.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace container {
+
+            /// @brief Replacement to <a href="http://en.cppreference.com/w/cpp/string/basic_string">std::string</a>
+            ///     with configurable length of the string stored without dynamic memory allocation.
+            /// @details Strings of up to TSize characters are stored inside the object itself,
+            ///     the longer ones are moved to the heap. Provides the most frequently used part
+            ///     of the <a href="http://en.cppreference.com/w/cpp/string/basic_string">std::string</a>
+            ///     interface.
+            /// @tparam TSize Number of characters stored without dynamic memory allocation
+            ///     (not including the terminating '\0').
+            /// @tparam TChar Type of the single character.
+            /// @headerfile "marshalling/container/small_string.hpp"
+            template<std::size_t TSize, typename TChar = char>
+            class small_string {
+                using vector_type = small_vector<TChar, TSize + 1>;
+
+            public:
+                /// @brief Type of single character.
+                using value_type = TChar;
+
+                /// @brief Type used for size information.
+                using size_type = std::size_t;
+
+                /// @brief Type used in pointer arithmetics.
+                using difference_type = std::ptrdiff_t;
+
+                /// @brief Reference to single character.
+                using reference = value_type &;
+
+                /// @brief Const reference to single character.
+                using const_reference = const value_type &;
+
+                /// @brief Pointer to single character.
+                using pointer = value_type *;
+
+                /// @brief Const pointer to single character.
+                using const_pointer = const value_type *;
+
+                /// @brief Type of the iterator.
+                using iterator = pointer;
+
+                /// @brief Type of the const iterator.
+                using const_iterator = const_pointer;
+
+                /// @brief Type of the reverse iterator.
+                using reverse_iterator = std::reverse_iterator<iterator>;
+
+                /// @brief Type of the const reverse iterator.
+                using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+                /// @brief Same as std::string::npos.
+                static const size_type npos = static_cast<size_type>(-1);
+
+                /// @brief Default constructor.
+                small_string() {
+                    end_string();
+                }
+
+                /// @brief Constructor.
+                small_string(size_type count, value_type ch) : small_string() {
+                    assign(count, ch);
+                }
+
+                /// @brief Constructor.
+                small_string(const small_string &other, size_type pos, size_type count = npos) : small_string() {
+                    assign(other, pos, count);
+                }
+
+                /// @brief Constructor.
+                small_string(const_pointer str, size_type count) : small_string() {
+                    assign(str, count);
+                }
+
+                /// @brief Constructor.
+                small_string(const_pointer str) : small_string() {
+                    assign(str);
+                }
+
+                /// @brief Constructor.
+                template<typename TIter, typename = typename std::enable_if<!std::is_integral<TIter>::value>::type>
+                small_string(TIter first, TIter last) : small_string() {
+                    assign(first, last);
+                }
+
+                /// @brief Copy constructor.
+                small_string(const small_string &other) = default;
+
+                /// @brief Move constructor.
+                small_string(small_string &&other) : vec_(std::move(other.vec_)) {
+                    other.end_string();
+                }
+
+                /// @brief Constructor.
+                small_string(std::initializer_list<value_type> init) : small_string(init.begin(), init.end()) {
+                }
+
+                /// @brief Copy assignment.
+                small_string &operator=(const small_string &other) = default;
+
+                /// @brief Move assignment.
+                small_string &operator=(small_string &&other) {
+                    if (&other != this) {
+                        vec_ = std::move(other.vec_);
+                        other.end_string();
+                    }
+                    return *this;
+                }
+
+                /// @brief Assignment.
+                small_string &operator=(const_pointer str) {
+                    return assign(str);
+                }
+
+                /// @brief Assignment.
+                small_string &operator=(value_type ch) {
+                    return assign(1U, ch);
+                }
+
+                /// @brief Assignment.
+                small_string &operator=(std::initializer_list<value_type> init) {
+                    return assign(init.begin(), init.end());
+                }
+
+                /// @brief Assign characters to a string.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+                small_string &assign(size_type count, value_type ch) {
+                    vec_.assign(count, ch);
+                    end_string();
+                    return *this;
+                }
+
+                /// @brief Assign characters to a string.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+                small_string &assign(const small_string &other) {
+                    if (&other != this) {
+                        *this = other;
+                    }
+                    return *this;
+                }
+
+                /// @brief Assign characters to a string.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+                small_string &assign(const small_string &other, size_type pos, size_type count = npos) {
+                    MARSHALLING_ASSERT(pos <= other.size());
+                    auto countLimit = std::min(count, other.size() - pos);
+                    if (&other == this) {
+                        erase(pos + countLimit);
+                        erase(0U, pos);
+                        return *this;
+                    }
+                    return assign(other.data() + pos, countLimit);
+                }
+
+                /// @brief Assign characters to a string.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+                small_string &assign(const_pointer str, size_type count) {
+                    if ((data() <= str) && (str <= (data() + size()))) {
+                        auto pos = static_cast<size_type>(str - data());
+                        erase(pos + count);
+                        return erase(0U, pos);
+                    }
+
+                    vec_.clear();
+                    vec_.reserve(count + 1U);
+                    vec_.assign(str, str + count);
+                    end_string();
+                    return *this;
+                }
+
+                /// @brief Assign characters to a string.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+                small_string &assign(const_pointer str) {
+                    return assign(str, length_of(str));
+                }
+
+                /// @brief Assign characters to a string.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+                template<typename TIter, typename = typename std::enable_if<!std::is_integral<TIter>::value>::type>
+                small_string &assign(TIter first, TIter last) {
+                    vec_.assign(first, last);
+                    end_string();
+                    return *this;
+                }
+
+                /// @brief Access specified character with bounds checking.
+                /// @details The bounds check is performed with MARSHALLING_ASSERT() macro, which means
+                ///     it is performed only in DEBUG mode compilation.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/at">Reference</a>
+                reference at(size_type pos) {
+                    MARSHALLING_ASSERT(pos < size());
+                    return vec_[pos];
+                }
+
+                /// @brief Access specified character with bounds checking.
+                /// @details The bounds check is performed with MARSHALLING_ASSERT() macro, which means
+                ///     it is performed only in DEBUG mode compilation.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/at">Reference</a>
+                const_reference at(size_type pos) const {
+                    MARSHALLING_ASSERT(pos < size());
+                    return vec_[pos];
+                }
+
+                /// @brief Access specified character without bounds checking.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_at">Reference</a>
+                reference operator[](size_type pos) {
+                    return vec_[pos];
+                }
+
+                /// @brief Access specified character without bounds checking.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_at">Reference</a>
+                const_reference operator[](size_type pos) const {
+                    return vec_[pos];
+                }
+
+                /// @brief Accesses the first character.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/front">Reference</a>
+                /// @pre The string is not empty.
+                reference front() {
+                    MARSHALLING_ASSERT(!empty());
+                    return vec_.front();
+                }
+
+                /// @brief Accesses the first character.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/front">Reference</a>
+                /// @pre The string is not empty.
+                const_reference front() const {
+                    MARSHALLING_ASSERT(!empty());
+                    return vec_.front();
+                }
+
+                /// @brief Accesses the last character.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/back">Reference</a>
+                /// @pre The string is not empty.
+                reference back() {
+                    MARSHALLING_ASSERT(!empty());
+                    return vec_[size() - 1U];
+                }
+
+                /// @brief Accesses the last character.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/back">Reference</a>
+                /// @pre The string is not empty.
+                const_reference back() const {
+                    MARSHALLING_ASSERT(!empty());
+                    return vec_[size() - 1U];
+                }
+
+                /// @brief Returns a pointer to the first character of a string.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/data">Reference</a>
+                const_pointer data() const {
+                    return vec_.data();
+                }
+
+                /// @brief Returns a pointer to the first character of a string.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/data">Reference</a>
+                pointer data() {
+                    return vec_.data();
+                }
+
+                /// @brief Returns a non-modifiable standard C character array version of the string.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/c_str">Reference</a>
+                const_pointer c_str() const {
+                    return vec_.data();
+                }
+
+                /// @brief Returns an iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/begin">Reference</a>
+                iterator begin() {
+                    return vec_.begin();
+                }
+
+                /// @brief Returns an iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/begin">Reference</a>
+                const_iterator begin() const {
+                    return cbegin();
+                }
+
+                /// @brief Returns an iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/begin">Reference</a>
+                const_iterator cbegin() const {
+                    return vec_.cbegin();
+                }
+
+                /// @brief Returns an iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/end">Reference</a>
+                iterator end() {
+                    return begin() + size();
+                }
+
+                /// @brief Returns an iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/end">Reference</a>
+                const_iterator end() const {
+                    return cend();
+                }
+
+                /// @brief Returns an iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/end">Reference</a>
+                const_iterator cend() const {
+                    return cbegin() + size();
+                }
+
+                /// @brief Returns a reverse iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rbegin">Reference</a>
+                reverse_iterator rbegin() {
+                    return reverse_iterator(end());
+                }
+
+                /// @brief Returns a reverse iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rbegin">Reference</a>
+                const_reverse_iterator rbegin() const {
+                    return crbegin();
+                }
+
+                /// @brief Returns a reverse iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rbegin">Reference</a>
+                const_reverse_iterator crbegin() const {
+                    return const_reverse_iterator(cend());
+                }
+
+                /// @brief Returns a reverse iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rend">Reference</a>
+                reverse_iterator rend() {
+                    return reverse_iterator(begin());
+                }
+
+                /// @brief Returns a reverse iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rend">Reference</a>
+                const_reverse_iterator rend() const {
+                    return crend();
+                }
+
+                /// @brief Returns a reverse iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rend">Reference</a>
+                const_reverse_iterator crend() const {
+                    return const_reverse_iterator(cbegin());
+                }
+
+                /// @brief Checks whether the string is empty.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/empty">Reference</a>
+                bool empty() const {
+                    return size() == 0U;
+                }
+
+                /// @brief Returns the number of characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/size">Reference</a>
+                size_type size() const {
+                    MARSHALLING_ASSERT(!vec_.empty());
+                    return vec_.size() - 1U;
+                }
+
+                /// @brief Returns the number of characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/length">Reference</a>
+                size_type length() const {
+                    return size();
+                }
+
+                /// @brief Returns the maximum number of characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/max_size">Reference</a>
+                size_type max_size() const {
+                    return vec_.max_size() - 1U;
+                }
+
+                /// @brief Reserves storage.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/reserve">Reference</a>
+                void reserve(size_type new_cap) {
+                    vec_.reserve(new_cap + 1U);
+                }
+
+                /// @brief Returns the number of characters that can be held in currently allocated storage.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/capacity">Reference</a>
+                size_type capacity() const {
+                    return vec_.capacity() - 1U;
+                }
+
+                /// @brief Reduces memory usage by freeing unused memory.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/shrink_to_fit">Reference</a>
+                void shrink_to_fit() {
+                    vec_.shrink_to_fit();
+                }
+
+                /// @brief Checks whether the characters are stored inside the object itself.
+                bool inlined() const {
+                    return vec_.inlined();
+                }
+
+                /// @brief Clears the contents.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/clear">Reference</a>
+                void clear() {
+                    vec_.clear();
+                    end_string();
+                }
+
+                /// @brief Inserts characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+                small_string &insert(size_type idx, size_type count, value_type ch) {
+                    MARSHALLING_ASSERT(idx <= size());
+                    vec_.insert(vec_.begin() + idx, count, ch);
+                    return *this;
+                }
+
+                /// @brief Inserts characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+                small_string &insert(size_type idx, const_pointer str) {
+                    return insert(idx, str, length_of(str));
+                }
+
+                /// @brief Inserts characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+                small_string &insert(size_type idx, const_pointer str, size_type count) {
+                    MARSHALLING_ASSERT(idx <= size());
+                    small_string copy(str, count);
+                    vec_.insert(vec_.begin() + idx, copy.begin(), copy.end());
+                    return *this;
+                }
+
+                /// @brief Inserts characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+                small_string &insert(size_type idx, const small_string &str) {
+                    return insert(idx, str.data(), str.size());
+                }
+
+                /// @brief Inserts characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+                iterator insert(const_iterator pos, value_type ch) {
+                    return vec_.insert(pos, ch);
+                }
+
+                /// @brief Inserts characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+                iterator insert(const_iterator pos, size_type count, value_type ch) {
+                    return vec_.insert(pos, count, ch);
+                }
+
+                /// @brief Inserts characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+                template<typename TIter, typename = typename std::enable_if<!std::is_integral<TIter>::value>::type>
+                iterator insert(const_iterator pos, TIter first, TIter last) {
+                    return vec_.insert(pos, first, last);
+                }
+
+                /// @brief Removes characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/erase">Reference</a>
+                small_string &erase(size_type idx = 0U, size_type count = npos) {
+                    MARSHALLING_ASSERT(idx <= size());
+                    auto countLimit = std::min(count, size() - idx);
+                    vec_.erase(vec_.begin() + idx, vec_.begin() + idx + countLimit);
+                    return *this;
+                }
+
+                /// @brief Removes characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/erase">Reference</a>
+                iterator erase(const_iterator pos) {
+                    return vec_.erase(pos);
+                }
+
+                /// @brief Removes characters.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/erase">Reference</a>
+                iterator erase(const_iterator first, const_iterator last) {
+                    return vec_.erase(first, last);
+                }
+
+                /// @brief Appends a character to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/push_back">Reference</a>
+                void push_back(value_type ch) {
+                    vec_.back() = ch;
+                    end_string();
+                }
+
+                /// @brief Removes the last character.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/pop_back">Reference</a>
+                /// @pre The string is not empty.
+                void pop_back() {
+                    MARSHALLING_ASSERT(!empty());
+                    vec_.pop_back();
+                    vec_.back() = value_type();
+                }
+
+                /// @brief Appends characters to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+                small_string &append(size_type count, value_type ch) {
+                    return insert(size(), count, ch);
+                }
+
+                /// @brief Appends characters to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+                small_string &append(const small_string &str) {
+                    return append(str.data(), str.size());
+                }
+
+                /// @brief Appends characters to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+                small_string &append(const_pointer str, size_type count) {
+                    return insert(size(), str, count);
+                }
+
+                /// @brief Appends characters to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+                small_string &append(const_pointer str) {
+                    return append(str, length_of(str));
+                }
+
+                /// @brief Appends characters to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+                template<typename TIter, typename = typename std::enable_if<!std::is_integral<TIter>::value>::type>
+                small_string &append(TIter first, TIter last) {
+                    insert(end(), first, last);
+                    return *this;
+                }
+
+                /// @brief Appends characters to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D">Reference</a>
+                small_string &operator+=(const small_string &str) {
+                    return append(str);
+                }
+
+                /// @brief Appends characters to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D">Reference</a>
+                small_string &operator+=(value_type ch) {
+                    push_back(ch);
+                    return *this;
+                }
+
+                /// @brief Appends characters to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D">Reference</a>
+                small_string &operator+=(const_pointer str) {
+                    return append(str);
+                }
+
+                /// @brief Compares two strings.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/compare">Reference</a>
+                template<std::size_t TOtherSize>
+                int compare(const small_string<TOtherSize, TChar> &str) const {
+                    return compare(str.data(), str.size());
+                }
+
+                /// @brief Compares two strings.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/compare">Reference</a>
+                int compare(const_pointer str) const {
+                    return compare(str, length_of(str));
+                }
+
+                /// @brief Compares two strings.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/compare">Reference</a>
+                int compare(const_pointer str, size_type count) const {
+                    auto minCount = std::min(size(), count);
+                    for (size_type idx = 0U; idx < minCount; ++idx) {
+                        if (vec_[idx] != str[idx]) {
+                            return (vec_[idx] < str[idx]) ? -1 : 1;
+                        }
+                    }
+
+                    if (size() == count) {
+                        return 0;
+                    }
+                    return (size() < count) ? -1 : 1;
+                }
+
+                /// @brief Finds the first occurrence of the character.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/find">Reference</a>
+                size_type find(value_type ch, size_type pos = 0U) const {
+                    if (size() <= pos) {
+                        return npos;
+                    }
+
+                    auto iter = std::find(cbegin() + pos, cend(), ch);
+                    if (iter == cend()) {
+                        return npos;
+                    }
+                    return static_cast<size_type>(iter - cbegin());
+                }
+
+                /// @brief Returns a substring.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/substr">Reference</a>
+                small_string substr(size_type pos = 0U, size_type count = npos) const {
+                    return small_string(*this, pos, count);
+                }
+
+                /// @brief Changes the number of characters stored.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/resize">Reference</a>
+                void resize(size_type count) {
+                    resize(count, value_type());
+                }
+
+                /// @brief Changes the number of characters stored.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/resize">Reference</a>
+                void resize(size_type count, value_type ch) {
+                    if (count <= size()) {
+                        erase(count);
+                        return;
+                    }
+                    append(count - size(), ch);
+                }
+
+                /// @brief Swaps the contents.
+                /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/swap">Reference</a>
+                void swap(small_string &other) {
+                    vec_.swap(other.vec_);
+                }
+
+            private:
+                static size_type length_of(const_pointer str) {
+                    return static_cast<size_type>(std::char_traits<TChar>::length(str));
+                }
+
+                void end_string() {
+                    vec_.push_back(value_type());
+                }
+
+                vector_type vec_;
+            };
+
+            /// @brief Lexicographical compare between the strings.
+            /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+            /// @related small_string
+            template<std::size_t TSize1, std::size_t TSize2, typename TChar>
+            bool operator<(const small_string<TSize1, TChar> &str1, const small_string<TSize2, TChar> &str2) {
+                return str1.compare(str2) < 0;
+            }
+
+            /// @brief Lexicographical compare between the strings.
+            /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+            /// @related small_string
+            template<std::size_t TSize1, std::size_t TSize2, typename TChar>
+            bool operator<=(const small_string<TSize1, TChar> &str1, const small_string<TSize2, TChar> &str2) {
+                return str1.compare(str2) <= 0;
+            }
+
+            /// @brief Lexicographical compare between the strings.
+            /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+            /// @related small_string
+            template<std::size_t TSize1, std::size_t TSize2, typename TChar>
+            bool operator>(const small_string<TSize1, TChar> &str1, const small_string<TSize2, TChar> &str2) {
+                return str1.compare(str2) > 0;
+            }
+
+            /// @brief Lexicographical compare between the strings.
+            /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+            /// @related small_string
+            template<std::size_t TSize1, std::size_t TSize2, typename TChar>
+            bool operator>=(const small_string<TSize1, TChar> &str1, const small_string<TSize2, TChar> &str2) {
+                return str1.compare(str2) >= 0;
+            }
+
+            /// @brief Equality compare between the strings.
+            /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+            /// @related small_string
+            template<std::size_t TSize1, std::size_t TSize2, typename TChar>
+            bool operator==(const small_string<TSize1, TChar> &str1, const small_string<TSize2, TChar> &str2) {
+                return (str1.size() == str2.size()) && std::equal(str1.begin(), str1.end(), str2.begin());
+            }
+
+            /// @brief Inequality compare between the strings.
+            /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+            /// @related small_string
+            template<std::size_t TSize1, std::size_t TSize2, typename TChar>
+            bool operator!=(const small_string<TSize1, TChar> &str1, const small_string<TSize2, TChar> &str2) {
+                return !(str1 == str2);
+            }
+
+            /// @brief Equality compare between the strings.
+            /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+            /// @related small_string
+            template<std::size_t TSize1, typename TChar>
+            bool operator==(const small_string<TSize1, TChar> &str1, const TChar *str2) {
+                return str1.compare(str2) == 0;
+            }
+
+            /// @brief Equality compare between the strings.
+            /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+            /// @related small_string
+            template<std::size_t TSize1, typename TChar>
+            bool operator==(const TChar *str1, const small_string<TSize1, TChar> &str2) {
+                return str2 == str1;
+            }
+
+            /// @brief Inequality compare between the strings.
+            /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+            /// @related small_string
+            template<std::size_t TSize1, typename TChar>
+            bool operator!=(const small_string<TSize1, TChar> &str1, const TChar *str2) {
+                return !(str1 == str2);
+            }
+
+            /// @brief Inequality compare between the strings.
+            /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+            /// @related small_string
+            template<std::size_t TSize1, typename TChar>
+            bool operator!=(const TChar *str1, const small_string<TSize1, TChar> &str2) {
+                return !(str2 == str1);
+            }
+
+        }    // namespace container
+    }    // namespace marshalling
+}    // namespace nil
+
+namespace std {
+
+    /// @brief Specializes the std::swap algorithm.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/swap2">Reference</a>
+    /// @related nil::marshalling::container::small_string
+    template<std::size_t TSize, typename TChar>
+    void swap(nil::marshalling::container::small_string<TSize, TChar> &str1,
+              nil::marshalling::container::small_string<TSize, TChar> &str2) {
+        str1.swap(str2);
+    }
+
+}    // namespace std
+#endif    // MARSHALLING_SMALL_STRING_HPP
@@ -0,0 +1,781 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_SMALL_VECTOR_HPP
+#define MARSHALLING_SMALL_VECTOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <nil/marshalling/assert_type.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace container {
+
+            /// @brief Replacement to <a href="http://en.cppreference.com/w/cpp/container/vector">std::vector</a>
+            ///     which keeps small number of elements inside the object itself.
+            /// @details Up to TSize elements are stored in the internal buffer, so no dynamic
+            ///     memory allocation is performed. When more elements are required, all of them
+            ///     are moved to the storage allocated on the heap, which grows the same way
+            ///     as the one of std::vector. Provides almost the same interface as
+            ///     <a href="http://en.cppreference.com/w/cpp/container/vector">std::vector</a>.
+            /// @tparam T Type of the stored elements.
+            /// @tparam TSize Number of elements stored without dynamic memory allocation.
+            /// @headerfile "marshalling/container/small_vector.hpp"
+            template<typename T, std::size_t TSize>
+            class small_vector {
+                static_assert(0U < TSize, "Inline capacity must be greater than 0");
+
+                template<typename U, std::size_t TOtherSize>
+                friend class small_vector;
+
+                struct trivial_copy_tag { };
+                struct generic_copy_tag { };
+
+                using copy_tag = typename std::conditional<std::is_trivially_copyable<T>::value, trivial_copy_tag,
+                                                           generic_copy_tag>::type;
+
+                template<typename TIter>
+                using range_copy_tag = typename std::conditional<
+                    std::is_trivially_copyable<T>::value && std::is_pointer<TIter>::value
+                        && std::is_same<typename std::remove_cv<typename std::remove_pointer<TIter>::type>::type,
+                                        T>::value,
+                    trivial_copy_tag,
+                    generic_copy_tag>::type;
+
+                template<typename TIter>
+                using enable_if_iterator = typename std::enable_if<!std::is_integral<TIter>::value>::type;
+
+                using storage_type = typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type;
+                using allocator_type = std::allocator<T>;
+
+            public:
+                /// @brief Type of single element.
+                using value_type = T;
+
+                /// @brief Type used for size information
+                using size_type = std::size_t;
+
+                /// @brief Type used in pointer arithmetics
+                using difference_type = std::ptrdiff_t;
+
+                /// @brief Reference to single element
+                using reference = value_type &;
+
+                /// @brief Const reference to single element
+                using const_reference = const value_type &;
+
+                /// @brief Pointer to single element
+                using pointer = value_type *;
+
+                /// @brief Const pointer to single element
+                using const_pointer = const value_type *;
+
+                /// @brief Type of the iterator.
+                using iterator = pointer;
+
+                /// @brief Type of the const iterator
+                using const_iterator = const_pointer;
+
+                /// @brief Type of the reverse iterator
+                using reverse_iterator = std::reverse_iterator<iterator>;
+
+                /// @brief Type of the const reverse iterator
+                using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+                /// @brief Default constructor.
+                small_vector() : data_(inline_data()), size_(0U), capacity_(TSize) {
+                }
+
+                /// @brief Constructor
+                small_vector(size_type count, const T &value) : small_vector() {
+                    assign(count, value);
+                }
+
+                /// @brief Constructor
+                explicit small_vector(size_type count) : small_vector() {
+                    resize(count);
+                }
+
+                /// @brief Constructor
+                template<typename TIter, typename = enable_if_iterator<TIter>>
+                small_vector(TIter from, TIter to) : small_vector() {
+                    assign(from, to);
+                }
+
+                /// @brief Copy constructor
+                small_vector(const small_vector &other) : small_vector() {
+                    assign(other.begin(), other.end());
+                }
+
+                /// @brief Copy constructor
+                template<std::size_t TOtherSize>
+                small_vector(const small_vector<T, TOtherSize> &other) : small_vector() {
+                    assign(other.begin(), other.end());
+                }
+
+                /// @brief Move constructor
+                /// @details Takes over the heap storage of the other vector, the elements
+                ///     stored in the internal buffer are moved one by one.
+                small_vector(small_vector &&other) noexcept(std::is_nothrow_move_constructible<T>::value) :
+                    small_vector() {
+                    move_from(other);
+                }
+
+                /// @brief Constructor
+                small_vector(std::initializer_list<value_type> init) : small_vector() {
+                    assign(init.begin(), init.end());
+                }
+
+                /// @brief Destructor
+                ~small_vector() {
+                    clear();
+                    release();
+                }
+
+                /// @brief Copy assignement
+                small_vector &operator=(const small_vector &other) {
+                    if (&other != this) {
+                        assign(other.begin(), other.end());
+                    }
+                    return *this;
+                }
+
+                /// @brief Copy assignement
+                template<std::size_t TOtherSize>
+                small_vector &operator=(const small_vector<T, TOtherSize> &other) {
+                    assign(other.begin(), other.end());
+                    return *this;
+                }
+
+                /// @brief Move assignement
+                /// @details The elements are only ever move constructed, never move assigned.
+                small_vector &operator=(small_vector &&other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+                    if (&other != this) {
+                        clear();
+                        move_from(other);
+                    }
+                    return *this;
+                }
+
+                /// @brief Copy assignement
+                small_vector &operator=(std::initializer_list<value_type> init) {
+                    assign(init.begin(), init.end());
+                    return *this;
+                }
+
+                /// @brief Assigns values to the container.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/assign">Reference</a>
+                void assign(size_type count, const T &value) {
+                    value_type copy(value);
+                    clear();
+                    resize(count, copy);
+                }
+
+                /// @brief Assigns values to the container.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/assign">Reference</a>
+                template<typename TIter, typename = enable_if_iterator<TIter>>
+                void assign(TIter from, TIter to) {
+                    clear();
+                    append_range(from, to, range_copy_tag<TIter>());
+                }
+
+                /// @brief Assigns values to the container.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/assign">Reference</a>
+                void assign(std::initializer_list<value_type> init) {
+                    assign(init.begin(), init.end());
+                }
+
+                /// @brief Access specified element with bounds checking.
+                /// @details The bounds check is performed with MARSHALLING_ASSERT() macro, which means
+                ///     it is performed only in DEBUG mode compilation. In case NDEBUG
+                ///     symbol is defined (RELEASE mode compilation), this call is equivalent
+                ///     to operator[]().
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/at">Reference</a>
+                reference at(size_type pos) {
+                    MARSHALLING_ASSERT(pos < size_);
+                    return data_[pos];
+                }
+
+                /// @brief Access specified element with bounds checking.
+                /// @details The bounds check is performed with MARSHALLING_ASSERT() macro, which means
+                ///     it is performed only in DEBUG mode compilation. In case NDEBUG
+                ///     symbol is defined (RELEASE mode compilation), this call is equivalent
+                ///     to operator[]().
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/at">Reference</a>
+                const_reference at(size_type pos) const {
+                    MARSHALLING_ASSERT(pos < size_);
+                    return data_[pos];
+                }
+
+                /// @brief Access specified element without bounds checking.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_at">Reference</a>
+                reference operator[](size_type pos) {
+                    return data_[pos];
+                }
+
+                /// @brief Access specified element without bounds checking.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_at">Reference</a>
+                const_reference operator[](size_type pos) const {
+                    return data_[pos];
+                }
+
+                /// @brief Access the first element.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/front">Reference</a>
+                /// @pre The vector is not empty.
+                reference front() {
+                    MARSHALLING_ASSERT(!empty());
+                    return data_[0];
+                }
+
+                /// @brief Access the first element.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/front">Reference</a>
+                /// @pre The vector is not empty.
+                const_reference front() const {
+                    MARSHALLING_ASSERT(!empty());
+                    return data_[0];
+                }
+
+                /// @brief Access the last element.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/back">Reference</a>
+                /// @pre The vector is not empty.
+                reference back() {
+                    MARSHALLING_ASSERT(!empty());
+                    return data_[size_ - 1];
+                }
+
+                /// @brief Access the last element.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/back">Reference</a>
+                /// @pre The vector is not empty.
+                const_reference back() const {
+                    MARSHALLING_ASSERT(!empty());
+                    return data_[size_ - 1];
+                }
+
+                /// @brief Direct access to the underlying array.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/data">Reference</a>
+                pointer data() {
+                    return data_;
+                }
+
+                /// @brief Direct access to the underlying array.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/data">Reference</a>
+                const_pointer data() const {
+                    return data_;
+                }
+
+                /// @brief Returns an iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/begin">Reference</a>
+                iterator begin() {
+                    return data_;
+                }
+
+                /// @brief Returns an iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/begin">Reference</a>
+                const_iterator begin() const {
+                    return cbegin();
+                }
+
+                /// @brief Returns an iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/begin">Reference</a>
+                const_iterator cbegin() const {
+                    return data_;
+                }
+
+                /// @brief Returns an iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/end">Reference</a>
+                iterator end() {
+                    return data_ + size_;
+                }
+
+                /// @brief Returns an iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/end">Reference</a>
+                const_iterator end() const {
+                    return cend();
+                }
+
+                /// @brief Returns an iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/end">Reference</a>
+                const_iterator cend() const {
+                    return data_ + size_;
+                }
+
+                /// @brief Returns a reverse iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rbegin">Reference</a>
+                reverse_iterator rbegin() {
+                    return reverse_iterator(end());
+                }
+
+                /// @brief Returns a reverse iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rbegin">Reference</a>
+                const_reverse_iterator rbegin() const {
+                    return crbegin();
+                }
+
+                /// @brief Returns a reverse iterator to the beginning.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rbegin">Reference</a>
+                const_reverse_iterator crbegin() const {
+                    return const_reverse_iterator(cend());
+                }
+
+                /// @brief Returns a reverse iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rend">Reference</a>
+                reverse_iterator rend() {
+                    return reverse_iterator(begin());
+                }
+
+                /// @brief Returns a reverse iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rend">Reference</a>
+                const_reverse_iterator rend() const {
+                    return crend();
+                }
+
+                /// @brief Returns a reverse iterator to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rend">Reference</a>
+                const_reverse_iterator crend() const {
+                    return const_reverse_iterator(cbegin());
+                }
+
+                /// @brief Checks whether the container is empty.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/empty">Reference</a>
+                bool empty() const {
+                    return size_ == 0U;
+                }
+
+                /// @brief Returns the number of elements.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/size">Reference</a>
+                size_type size() const {
+                    return size_;
+                }
+
+                /// @brief Returns the maximum possible number of elements.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/max_size">Reference</a>
+                size_type max_size() const {
+                    return std::allocator_traits<allocator_type>::max_size(allocator_type());
+                }
+
+                /// @brief Reserves storage.
+                /// @details Moves the elements to the heap if @b new_cap exceeds current capacity.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/reserve">Reference</a>
+                void reserve(size_type new_cap) {
+                    if (capacity_ < new_cap) {
+                        reallocate(new_cap);
+                    }
+                }
+
+                /// @brief Returns the number of elements that can be held in currently allocated storage.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/capacity">Reference</a>
+                size_type capacity() const {
+                    return capacity_;
+                }
+
+                /// @brief Reduces memory usage by freeing unused memory.
+                /// @details Moves the elements back to the internal buffer if they fit.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/shrink_to_fit">Reference</a>
+                void shrink_to_fit() {
+                    if (inlined() || (size_ == capacity_)) {
+                        return;
+                    }
+
+                    if (TSize < size_) {
+                        reallocate(size_);
+                        return;
+                    }
+
+                    auto *heapData = data_;
+                    auto heapCapacity = capacity_;
+                    relocate(heapData, size_, inline_data(), copy_tag());
+                    allocator_type().deallocate(heapData, heapCapacity);
+                    data_ = inline_data();
+                    capacity_ = TSize;
+                }
+
+                /// @brief Checks whether the elements are stored in the internal buffer.
+                bool inlined() const {
+                    return data_ == inline_data();
+                }
+
+                /// @brief Clears the contents.
+                /// @details Keeps the allocated storage.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/clear">Reference</a>
+                void clear() {
+                    destruct(data_, size_, std::is_trivially_destructible<value_type>());
+                    size_ = 0U;
+                }
+
+                /// @brief Inserts elements.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+                iterator insert(const_iterator iter, const T &value) {
+                    return emplace(iter, value);
+                }
+
+                /// @brief Inserts elements.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+                iterator insert(const_iterator iter, T &&value) {
+                    return emplace(iter, std::move(value));
+                }
+
+                /// @brief Inserts elements.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+                iterator insert(const_iterator iter, size_type count, const T &value) {
+                    auto idx = static_cast<size_type>(iter - cbegin());
+                    auto oldSize = size_;
+                    resize(size_ + count, value);
+                    std::rotate(begin() + idx, begin() + oldSize, end());
+                    return begin() + idx;
+                }
+
+                /// @brief Inserts elements.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+                template<typename TIter, typename = enable_if_iterator<TIter>>
+                iterator insert(const_iterator iter, TIter from, TIter to) {
+                    auto idx = static_cast<size_type>(iter - cbegin());
+                    auto oldSize = size_;
+                    append_range(from, to, generic_copy_tag());
+                    std::rotate(begin() + idx, begin() + oldSize, end());
+                    return begin() + idx;
+                }
+
+                /// @brief Inserts elements.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+                iterator insert(const_iterator iter, std::initializer_list<value_type> init) {
+                    return insert(iter, init.begin(), init.end());
+                }
+
+                /// @brief Constructs elements in place.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/emplace">Reference</a>
+                template<typename... TArgs>
+                iterator emplace(const_iterator iter, TArgs &&...args) {
+                    auto idx = static_cast<size_type>(iter - cbegin());
+                    emplace_back(std::forward<TArgs>(args)...);
+                    std::rotate(begin() + idx, end() - 1, end());
+                    return begin() + idx;
+                }
+
+                /// @brief Erases elements.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/erase">Reference</a>
+                iterator erase(const_iterator iter) {
+                    return erase(iter, iter + 1);
+                }
+
+                /// @brief Erases elements.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/erase">Reference</a>
+                iterator erase(const_iterator from, const_iterator to) {
+                    auto idx = static_cast<size_type>(from - cbegin());
+                    auto count = static_cast<size_type>(to - from);
+                    if (count == 0U) {
+                        return begin() + idx;
+                    }
+
+                    std::move(begin() + idx + count, end(), begin() + idx);
+                    destruct(end() - count, count, std::is_trivially_destructible<value_type>());
+                    size_ -= count;
+                    return begin() + idx;
+                }
+
+                /// @brief Adds an element to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/push_back">Reference</a>
+                void push_back(const T &value) {
+                    emplace_back(value);
+                }
+
+                /// @brief Adds an element to the end.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/push_back">Reference</a>
+                void push_back(T &&value) {
+                    emplace_back(std::move(value));
+                }
+
+                /// @brief Constructs an element in place at the end.
+                /// @details The arguments may reference the elements of this vector.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/emplace_back">Reference</a>
+                template<typename... TArgs>
+                void emplace_back(TArgs &&...args) {
+                    if (size_ < capacity_) {
+                        new (data_ + size_) value_type(std::forward<TArgs>(args)...);
+                        ++size_;
+                        return;
+                    }
+
+                    // Construct the new element before the old ones are moved away
+                    auto newCapacity = next_capacity(size_ + 1);
+                    auto *newData = allocator_type().allocate(newCapacity);
+                    new (newData + size_) value_type(std::forward<TArgs>(args)...);
+                    replace_storage(newData, newCapacity);
+                    ++size_;
+                }
+
+                /// @brief Removes the last element.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/pop_back">Reference</a>
+                /// @pre The vector is not empty.
+                void pop_back() {
+                    MARSHALLING_ASSERT(!empty());
+                    --size_;
+                    data_[size_].~T();
+                }
+
+                /// @brief Changes the number of elements stored.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/resize">Reference</a>
+                void resize(size_type count) {
+                    if (count <= size_) {
+                        erase(begin() + count, end());
+                        return;
+                    }
+
+                    reserve_for_append(count - size_);
+                    while (size_ < count) {
+                        new (data_ + size_) value_type();
+                        ++size_;
+                    }
+                }
+
+                /// @brief Changes the number of elements stored.
+                /// @details The value may reference the element of this vector.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/resize">Reference</a>
+                void resize(size_type count, const value_type &value) {
+                    if (count <= size_) {
+                        erase(begin() + count, end());
+                        return;
+                    }
+
+                    if (capacity_ < count) {
+                        value_type copy(value);
+                        reserve_for_append(count - size_);
+                        fill_back(count, copy);
+                        return;
+                    }
+
+                    fill_back(count, value);
+                }
+
+                /// @brief Swaps the contents.
+                /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/swap">Reference</a>
+                void swap(small_vector &other) {
+                    if (&other == this) {
+                        return;
+                    }
+
+                    if ((!inlined()) && (!other.inlined())) {
+                        std::swap(data_, other.data_);
+                        std::swap(size_, other.size_);
+                        std::swap(capacity_, other.capacity_);
+                        return;
+                    }
+
+                    small_vector tmp(std::move(other));
+                    other = std::move(*this);
+                    *this = std::move(tmp);
+                }
+
+            private:
+                pointer inline_data() {
+                    return reinterpret_cast<pointer>(&inline_[0]);
+                }
+
+                const_pointer inline_data() const {
+                    return reinterpret_cast<const_pointer>(&inline_[0]);
+                }
+
+                size_type next_capacity(size_type required) const {
+                    return std::max(capacity_ * 2U, required);
+                }
+
+                void reserve_for_append(size_type count) {
+                    if (capacity_ < (size_ + count)) {
+                        reallocate(next_capacity(size_ + count));
+                    }
+                }
+
+                void reallocate(size_type newCapacity) {
+                    MARSHALLING_ASSERT(size_ <= newCapacity);
+                    replace_storage(allocator_type().allocate(newCapacity), newCapacity);
+                }
+
+                void replace_storage(pointer newData, size_type newCapacity) {
+                    relocate(data_, size_, newData, copy_tag());
+                    release();
+                    data_ = newData;
+                    capacity_ = newCapacity;
+                }
+
+                void release() {
+                    if (!inlined()) {
+                        allocator_type().deallocate(data_, capacity_);
+                    }
+                }
+
+                void move_from(small_vector &other) {
+                    MARSHALLING_ASSERT(empty());
+                    if (!other.inlined()) {
+                        release();
+                        data_ = other.data_;
+                        size_ = other.size_;
+                        capacity_ = other.capacity_;
+                        other.data_ = other.inline_data();
+                        other.size_ = 0U;
+                        other.capacity_ = TSize;
+                        return;
+                    }
+
+                    reserve(other.size_);
+                    relocate(other.data_, other.size_, data_, copy_tag());
+                    size_ = other.size_;
+                    other.size_ = 0U;
+                }
+
+                void fill_back(size_type count, const value_type &value) {
+                    while (size_ < count) {
+                        new (data_ + size_) value_type(value);
+                        ++size_;
+                    }
+                }
+
+                template<typename TIter>
+                void append_range(TIter from, TIter to, trivial_copy_tag) {
+                    auto count = static_cast<size_type>(to - from);
+                    reserve_for_append(count);
+                    if (0U < count) {
+                        std::memcpy(data_ + size_, from, count * sizeof(value_type));
+                    }
+                    size_ += count;
+                }
+
+                template<typename TIter>
+                void append_range(TIter from, TIter to, generic_copy_tag) {
+                    using category = typename std::iterator_traits<TIter>::iterator_category;
+                    reserve_range(from, to, category());
+                    for (; from != to; ++from) {
+                        emplace_back(*from);
+                    }
+                }
+
+                template<typename TIter>
+                void reserve_range(TIter from, TIter to, std::forward_iterator_tag) {
+                    reserve_for_append(static_cast<size_type>(std::distance(from, to)));
+                }
+
+                template<typename TIter>
+                void reserve_range(TIter, TIter, std::input_iterator_tag) {
+                }
+
+                static void relocate(pointer from, size_type count, pointer to, trivial_copy_tag) {
+                    if (0U < count) {
+                        std::memcpy(to, from, count * sizeof(value_type));
+                    }
+                }
+
+                static void relocate(pointer from, size_type count, pointer to, generic_copy_tag) {
+                    for (size_type idx = 0U; idx < count; ++idx) {
+                        new (to + idx) value_type(std::move(from[idx]));
+                        from[idx].~T();
+                    }
+                }
+
+                static void destruct(pointer, size_type, std::true_type) {
+                }
+
+                static void destruct(pointer from, size_type count, std::false_type) {
+                    for (size_type idx = 0U; idx < count; ++idx) {
+                        from[idx].~T();
+                    }
+                }
+
+                pointer data_;
+                size_type size_;
+                size_type capacity_;
+                storage_type inline_[TSize];
+            };
+
+            /// @brief Lexicographically compares the values in the vector.
+            /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+            /// @related small_vector
+            template<typename T, std::size_t TSize1, std::size_t TSize2>
+            bool operator<(const small_vector<T, TSize1> &v1, const small_vector<T, TSize2> &v2) {
+                return std::lexicographical_compare(v1.begin(), v1.end(), v2.begin(), v2.end());
+            }
+
+            /// @brief Lexicographically compares the values in the vector.
+            /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+            /// @related small_vector
+            template<typename T, std::size_t TSize1, std::size_t TSize2>
+            bool operator<=(const small_vector<T, TSize1> &v1, const small_vector<T, TSize2> &v2) {
+                return !(v2 < v1);
+            }
+
+            /// @brief Lexicographically compares the values in the vector.
+            /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+            /// @related small_vector
+            template<typename T, std::size_t TSize1, std::size_t TSize2>
+            bool operator>(const small_vector<T, TSize1> &v1, const small_vector<T, TSize2> &v2) {
+                return v2 < v1;
+            }
+
+            /// @brief Lexicographically compares the values in the vector.
+            /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+            /// @related small_vector
+            template<typename T, std::size_t TSize1, std::size_t TSize2>
+            bool operator>=(const small_vector<T, TSize1> &v1, const small_vector<T, TSize2> &v2) {
+                return !(v1 < v2);
+            }
+
+            /// @brief Lexicographically compares the values in the vector.
+            /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+            /// @related small_vector
+            template<typename T, std::size_t TSize1, std::size_t TSize2>
+            bool operator==(const small_vector<T, TSize1> &v1, const small_vector<T, TSize2> &v2) {
+                return (v1.size() == v2.size()) && std::equal(v1.begin(), v1.end(), v2.begin());
+            }
+
+            /// @brief Lexicographically compares the values in the vector.
+            /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+            /// @related small_vector
+            template<typename T, std::size_t TSize1, std::size_t TSize2>
+            bool operator!=(const small_vector<T, TSize1> &v1, const small_vector<T, TSize2> &v2) {
+                return !(v1 == v2);
+            }
+
+        }    // namespace container
+    }    // namespace marshalling
+}    // namespace nil
+
+namespace std {
+
+    /// @brief Specializes the std::swap algorithm.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/swap2">Reference</a>
+    /// @related nil::marshalling::container::small_vector
+    template<typename T, std::size_t TSize>
+    void swap(nil::marshalling::container::small_vector<T, TSize> &v1,
+              nil::marshalling::container::small_vector<T, TSize> &v2) {
+        v1.swap(v2);
+    }
+
+}    // namespace std
+#endif    // MARSHALLING_SMALL_VECTOR_HPP
@@ -39,6 +39,7 @@
 #include <type_traits>
 #include <iterator>
 #include <algorithm>
+#include <cstring>
 
 #include <nil/marshalling/assert_type.hpp>
 #include <nil/marshalling/processing/size_to_type.hpp>
@@ -50,6 +51,20 @@ namespace nil {
 
                 template<typename T>
                 class static_queue_base {
+                    struct trivial_copy_tag { };
+                    struct generic_copy_tag { };
+
+                    using copy_tag = typename std::conditional<std::is_trivially_copyable<T>::value, trivial_copy_tag,
+                                                               generic_copy_tag>::type;
+
+                    template<typename TIter>
+                    using range_copy_tag = typename std::conditional<
+                        std::is_trivially_copyable<T>::value && std::is_pointer<TIter>::value
+                            && std::is_same<typename std::remove_cv<typename std::remove_pointer<TIter>::type>::type,
+                                            T>::value,
+                        trivial_copy_tag,
+                        generic_copy_tag>::type;
+
                 public:
                     template<typename TDerived, typename TQueueType>
                     class iterator_base;
@@ -95,7 +110,7 @@ namespace nil {
                         }
 
                         clear();
-                        assignElements(other);
+                        assign_elements(other);
                         return *this;
                     }
 
@@ -105,7 +120,7 @@ namespace nil {
                         }
 
                         clear();
-                        assignElements(std::move(other));
+                        assign_elements(std::move(other));
                         return *this;
                     }
 
@@ -118,9 +133,7 @@ namespace nil {
                     }
 
                     void clear() {
-                        while (!empty()) {
-                            popFront();
-                        }
+                        clear_internal(copy_tag());
                     }
 
                     bool empty() const {
@@ -174,10 +187,7 @@ namespace nil {
 
                     void pop_front(std::size_t count) {
                         MARSHALLING_ASSERT(count <= size());
-                        while ((!empty()) && (count > 0)) {
-                            popFront();
-                            --count;
-                        }
+                        pop_front_internal(std::min(count, size()), copy_tag());
                     }
 
                     void pop_back() {
@@ -195,10 +205,7 @@ namespace nil {
 
                     void pop_back(std::size_t count) {
                         MARSHALLING_ASSERT(count <= size());
-                        while ((!empty()) && (count > 0)) {
-                            popBack();
-                            --count;
-                        }
+                        pop_back_internal(std::min(count, size()), copy_tag());
                     }
 
                     reference operator[](std::size_t index) {
@@ -265,7 +272,7 @@ namespace nil {
 
                     linearised_iterator lbegin() {
                         if (!linearised()) {
-                            return invalidIter();
+                            return invalid_iter();
                         }
 
                         return reinterpret_cast<linearised_iterator>(&data_[0] + startIdx_);
@@ -277,7 +284,7 @@ namespace nil {
 
                     const_linearised_iterator clbegin() const {
                         if (!linearised()) {
-                            return invalidIter();
+                            return invalid_iter();
                         }
 
                         return reinterpret_cast<linearised_iterator>(&data_[0] + startIdx_);
@@ -285,7 +292,7 @@ namespace nil {
 
                     reverse_linearised_iterator rlbegin() {
                         if (!linearised()) {
-                            return invalidReverseIter();
+                            return invalid_reverse_iter();
                         }
 
                         return reverse_linearised_iterator(lend());
@@ -297,14 +304,14 @@ namespace nil {
 
                     const_reverse_linearised_iterator crlbegin() const {
                         if (!linearised()) {
-                            return invalidReverseIter();
+                            return invalid_reverse_iter();
                         }
                         return const_reverse_linearised_iterator(lend());
                     }
 
                     linearised_iterator lend() {
                         if (!linearised()) {
-                            return invalidIter();
+                            return invalid_iter();
                         }
 
                         return lbegin() + size();
@@ -316,7 +323,7 @@ namespace nil {
 
                     const_linearised_iterator clend() const {
                         if (!linearised()) {
-                            return invalidIter();
+                            return invalid_iter();
                         }
 
                         return clbegin() + size();
@@ -324,7 +331,7 @@ namespace nil {
 
                     reverse_linearised_iterator rlend() {
                         if (!linearised()) {
-                            return invalidReverseIter();
+                            return invalid_reverse_iter();
                         }
 
                         return rlbegin() + size();
@@ -336,7 +343,7 @@ namespace nil {
 
                     const_reverse_linearised_iterator crlend() const {
                         if (!linearised()) {
-                            return invalidReverseIter();
+                            return invalid_reverse_iter();
                         }
 
                         return rlbegin() + size();
@@ -348,10 +355,10 @@ namespace nil {
                             return;
                         }
 
-                        auto rangeOne = arrayOne();
+                        auto rangeOne = array_one();
                         auto rangeOneSize = std::distance(rangeOne.first, rangeOne.second);
                         MARSHALLING_ASSERT(0 < rangeOneSize);
-                        auto rangeTwo = arrayTwo();
+                        auto rangeTwo = array_two();
                         auto rangeTwoSize = std::distance(rangeTwo.first, rangeTwo.second);
                         MARSHALLING_ASSERT(0 < rangeTwoSize);
                         MARSHALLING_ASSERT((rangeOneSize + rangeTwoSize) == size());
@@ -380,7 +387,7 @@ namespace nil {
 
                     linearised_iterator_range array_one() {
                         auto constThis = static_cast<const static_queue_base *>(this);
-                        auto constRange = constThis->arrayOne();
+                        auto constRange = constThis->array_one();
                         return linearised_iterator_range(const_cast<linearised_iterator>(constRange.first),
                                                          const_cast<linearised_iterator>(constRange.second));
                     }
@@ -394,14 +401,14 @@ namespace nil {
 
                     linearised_iterator_range array_two() {
                         auto constThis = static_cast<const static_queue_base *>(this);
-                        auto constRange = constThis->arrayTwo();
+                        auto constRange = constThis->array_two();
                         return linearised_iterator_range(const_cast<linearised_iterator>(constRange.first),
                                                          const_cast<linearised_iterator>(constRange.second));
                     }
 
                     const_linearised_iterator_range array_two() const {
                         if (linearised()) {
-                            auto iter = arrayOne().second;
+                            auto iter = array_one().second;
                             return const_linearised_iterator_range(iter, iter);
                         }
 
@@ -427,18 +434,18 @@ namespace nil {
                         }
 
                         // New requested size is less than existing now
-                        popBack(size() - newSize);
+                        pop_back(size() - newSize);
                     }
 
                     linearised_iterator erase(linearised_iterator pos) {
-                        MARSHALLING_ASSERT(pos != invalidIter());
+                        MARSHALLING_ASSERT(pos != invalid_iter());
                         MARSHALLING_ASSERT(!empty());
-                        auto rangeOne = arrayOne();
-                        auto rangeTwo = arrayTwo();
+                        auto rangeOne = array_one();
+                        auto rangeTwo = array_two();
 
                         auto isInRangeFunc
-                            = [](linearised_iterator pos, const linearised_iterator_range range) -> bool {
-                            return ((range.first <= pos) && (pos < range.second));
+                            = [](linearised_iterator elem, const linearised_iterator_range range) -> bool {
+                            return ((range.first <= elem) && (elem < range.second));
                         };
 
                         MARSHALLING_ASSERT(isInRangeFunc(pos, rangeOne) || isInRangeFunc(pos, rangeTwo));
@@ -446,8 +453,8 @@ namespace nil {
                         if (isInRangeFunc(pos, rangeOne)) {
                             std::move_backward(rangeOne.first, pos, pos + 1);
 
-                            popFront();
-                            rangeOne = arrayOne();
+                            pop_front();
+                            rangeOne = array_one();
                             if (isInRangeFunc(pos, rangeOne)) {
                                 return pos + 1;
                             }
@@ -457,23 +464,23 @@ namespace nil {
 
                         if (isInRangeFunc(pos, rangeTwo)) {
                             std::move(pos + 1, rangeTwo.second, pos);
-                            popBack();
+                            pop_back();
                             if (!linearised()) {
                                 return pos;
                             }
-                            return arrayOne().second;
+                            return array_one().second;
                         }
 
                         MARSHALLING_ASSERT(!"Invalid iterator is used");
-                        return invalidIter();
+                        return invalid_iter();
                     }
 
                     iterator erase(iterator pos) {
                         MARSHALLING_ASSERT(pos != end());
                         MARSHALLING_ASSERT(!empty());
                         pointer elem = &(*pos);
-                        auto rangeOne = arrayOne();
-                        auto rangeTwo = arrayTwo();
+                        auto rangeOne = array_one();
+                        auto rangeTwo = array_two();
 
                         auto isInRangeFunc = [](pointer elemPtr, const linearised_iterator_range range) -> bool {
                             return ((&(*range.first) <= elemPtr) && (elemPtr < &(*range.second)));
@@ -484,8 +491,8 @@ namespace nil {
                         if (isInRangeFunc(elem, rangeOne)) {
                             std::move_backward(rangeOne.first, elem, elem + 1);
 
-                            popFront();
-                            rangeOne = arrayOne();
+                            pop_front();
+                            rangeOne = array_one();
                             if (isInRangeFunc(elem, rangeOne)) {
                                 return pos + 1;
                             }
@@ -495,7 +502,7 @@ namespace nil {
 
                         if (isInRangeFunc(elem, rangeTwo)) {
                             std::move(elem + 1, rangeTwo.second, elem);
-                            popBack();
+                            pop_back();
                             if (!linearised()) {
                                 return pos;
                             }
@@ -550,15 +557,9 @@ namespace nil {
                         MARSHALLING_ASSERT(other.size() <= capacity());
                         MARSHALLING_ASSERT(empty());
 
-                        auto rangeOne = other.arrayOne();
-                        for (auto iter = rangeOne.first; iter != rangeOne.second; ++iter) {
-                            push_back_not_full(std::forward<ElemRefType>(*iter));
-                        }
-
-                        auto rangeTwo = other.arrayTwo();
-                        for (auto iter = rangeTwo.first; iter != rangeTwo.second; ++iter) {
-                            push_back_not_full(std::forward<ElemRefType>(*iter));
-                        }
+                        auto rangeOne = other.array_one();
+                        auto rangeTwo = other.array_two();
+                        assign_ranges<ElemRefType>(rangeOne, rangeTwo, range_copy_tag<decltype(rangeOne.first)>());
                     }
 
                     template<typename U>
@@ -570,6 +571,11 @@ namespace nil {
                         push_back_not_full(std::forward<U>(value));
                     }
 
+                    template<typename TIter>
+                    void push_back(TIter from, TIter to) {
+                        push_back_range(from, to, range_copy_tag<TIter>());
+                    }
+
                     template<typename... TArgs>
                     void emplace_back(TArgs &&...args) {
                         MARSHALLING_ASSERT(!full());
@@ -593,7 +599,7 @@ namespace nil {
                     linearised_iterator insert(linearised_iterator pos, U &&value) {
                         MARSHALLING_ASSERT(!full());
                         if (full()) {
-                            return invalidIter();
+                            return invalid_iter();
                         }
 
                         return insert_not_full(pos, std::forward<U>(value));
@@ -604,12 +610,12 @@ namespace nil {
                             return false;
                         }
 
-                        auto rangeOne = arrayOne();
+                        auto rangeOne = array_one();
                         auto rangeOneSize = std::distance(rangeOne.first, rangeOne.second);
-                        auto rangeTwo = arrayTwo();
-                        auto otherRangeOne = other.arrayOne();
+                        auto rangeTwo = array_two();
+                        auto otherRangeOne = other.array_one();
                         auto otherRangeOneSize = std::distance(otherRangeOne.first, otherRangeOne.second);
-                        auto otherRangeTwo = other.arrayTwo();
+                        auto otherRangeTwo = other.array_two();
 
                         auto firstCompSize = std::min(rangeOneSize, otherRangeOneSize);
                         auto firstCompEnd = rangeOne.first + firstCompSize;
@@ -650,6 +656,101 @@ namespace nil {
                     }
 
                 private:
+                    std::size_t raw_index(std::size_t index) const {
+                        MARSHALLING_ASSERT(index <= capacity());
+                        auto rawIdx = startIdx_ + index;
+                        if (capacity() <= rawIdx) {
+                            rawIdx -= capacity();
+                        }
+                        return rawIdx;
+                    }
+
+                    void clear_internal(generic_copy_tag) {
+                        while (!empty()) {
+                            pop_front();
+                        }
+                    }
+
+                    void clear_internal(trivial_copy_tag) {
+                        // Trivially copyable types are also trivially destructible
+                        startIdx_ = 0;
+                        count_ = 0;
+                    }
+
+                    void pop_front_internal(std::size_t count, generic_copy_tag) {
+                        while (count > 0) {
+                            pop_front();
+                            --count;
+                        }
+                    }
+
+                    void pop_front_internal(std::size_t count, trivial_copy_tag) {
+                        startIdx_ = raw_index(count);
+                        count_ -= count;
+                        if (empty()) {
+                            startIdx_ = 0;
+                        }
+                    }
+
+                    void pop_back_internal(std::size_t count, generic_copy_tag) {
+                        while (count > 0) {
+                            pop_back();
+                            --count;
+                        }
+                    }
+
+                    void pop_back_internal(std::size_t count, trivial_copy_tag) {
+                        count_ -= count;
+                        if (empty()) {
+                            startIdx_ = 0;
+                        }
+                    }
+
+                    template<typename TElemRef, typename TRange>
+                    void assign_ranges(const TRange &rangeOne, const TRange &rangeTwo, generic_copy_tag) {
+                        for (auto iter = rangeOne.first; iter != rangeOne.second; ++iter) {
+                            push_back_not_full(std::forward<TElemRef>(*iter));
+                        }
+
+                        for (auto iter = rangeTwo.first; iter != rangeTwo.second; ++iter) {
+                            push_back_not_full(std::forward<TElemRef>(*iter));
+                        }
+                    }
+
+                    template<typename TElemRef, typename TRange>
+                    void assign_ranges(const TRange &rangeOne, const TRange &rangeTwo, trivial_copy_tag) {
+                        push_back_range(rangeOne.first, rangeOne.second, trivial_copy_tag());
+                        push_back_range(rangeTwo.first, rangeTwo.second, trivial_copy_tag());
+                    }
+
+                    template<typename TIter>
+                    void push_back_range(TIter from, TIter to, generic_copy_tag) {
+                        for (; from != to; ++from) {
+                            push_back(*from);
+                        }
+                    }
+
+                    /// @brief Copy the range with at most two memcpy() calls, the first one fills
+                    ///     the cells up to the end of the internal array, the second one wraps
+                    ///     around to its beginning.
+                    template<typename TIter>
+                    void push_back_range(TIter from, TIter to, trivial_copy_tag) {
+                        auto count = static_cast<std::size_t>(std::distance(from, to));
+                        MARSHALLING_ASSERT(count <= (capacity() - size()));
+                        count = std::min(count, capacity() - size());
+                        if (count == 0U) {
+                            return;
+                        }
+
+                        auto writeIdx = raw_index(size());
+                        auto firstCount = std::min(count, capacity() - writeIdx);
+                        std::memcpy(&data_[writeIdx], from, firstCount * sizeof(T));
+                        if (firstCount < count) {
+                            std::memcpy(&data_[0], from + firstCount, (count - firstCount) * sizeof(T));
+                        }
+                        count_ += count;
+                    }
+
                     template<typename U>
                     void create_value_at_index(U &&value, std::size_t index) {
                         MARSHALLING_ASSERT(index < capacity());
@@ -690,23 +791,23 @@ namespace nil {
                     template<typename U>
                     linearised_iterator insert_not_full(linearised_iterator pos, U &&value) {
                         MARSHALLING_ASSERT(!full());
-                        MARSHALLING_ASSERT(pos != invalidIter());
-                        auto rangeOne = arrayOne();
-                        auto rangeTwo = arrayTwo();
+                        MARSHALLING_ASSERT(pos != invalid_iter());
+                        auto rangeOne = array_one();
+                        auto rangeTwo = array_two();
 
                         if (pos == rangeOne.first) {
                             push_front_not_full(std::forward<U>(value));
-                            return arrayOne().first;
+                            return array_one().first;
                         }
 
                         if (pos == rangeTwo.second) {
                             push_back_not_full(std::forward<U>(value));
-                            return arrayTwo().second - 1;
+                            return array_two().second - 1;
                         }
 
                         auto isInRangeFunc
-                            = [](linearised_iterator pos, const linearised_iterator_range range) -> bool {
-                            return ((range.first <= pos) && (pos < range.second));
+                            = [](linearised_iterator elem, const linearised_iterator_range range) -> bool {
+                            return ((range.first <= elem) && (elem < range.second));
                         };
 
                         MARSHALLING_ASSERT(isInRangeFunc(pos, rangeOne) || isInRangeFunc(pos, rangeTwo));
@@ -715,8 +816,8 @@ namespace nil {
                             push_front_not_full(std::move(front()));    // move first element
 
                             std::move(rangeOne.first + 1, pos, rangeOne.first);
-                            *pos = std::forward<U>(value);
-                            return pos;
+                            *(pos - 1) = std::forward<U>(value);
+                            return pos - 1;
                         }
 
                         if (isInRangeFunc(pos, rangeTwo)) {
@@ -726,7 +827,7 @@ namespace nil {
                             return pos;
                         }
 
-                        return invalidIter();
+                        return invalid_iter();
                     }
 
                     reference element_at_index(std::size_t index) {
@@ -810,7 +911,7 @@ namespace nil {
                         }
 
                         value_type tmp(std::move(front()));
-                        popFront();
+                        pop_front();
                         linearise_by_pop_one();
                         if (startIdx_ == 0) {
                             using RevIter = std::reverse_iterator<linearised_iterator>;
@@ -818,7 +919,7 @@ namespace nil {
                             move_range(rlbegin(), rlend(), target);
                             startIdx_ = capacity() - size();
                         }
-                        pushFront(std::move(tmp));
+                        push_front(std::move(tmp));
                         MARSHALLING_ASSERT(linearised());
                     }
 
@@ -828,7 +929,7 @@ namespace nil {
                         }
 
                         value_type tmp(std::move(back()));
-                        popBack();
+                        pop_back();
                         linearise_by_pop_two();
                         if (startIdx_ != 0) {
                             auto target = reinterpret_cast<linearised_iterator>(&data_[0]);
@@ -870,7 +971,7 @@ namespace nil {
                 template<typename T>
                 template<typename TDerived, typename TQueueType>
                 class static_queue_base<T>::iterator_base {
-                    friend class StaticQueueBase<T>;
+                    friend class static_queue_base<T>;
 
                 public:
                     iterator_base(const iterator_base &) = default;
@@ -884,7 +985,6 @@ namespace nil {
                     using IteratorCategory = typename std::iterator_traits<ArrayIterator>::iterator_category;
                     using iterator_category = IteratorCategory;
                     using value_type = typename std::iterator_traits<ArrayIterator>::value_type;
-                    using value_type = value_type;
                     using DifferenceType = typename std::iterator_traits<ArrayIterator>::difference_type;
                     using difference_type = DifferenceType;
                     using Pointer = typename std::iterator_traits<ArrayIterator>::pointer;
@@ -895,7 +995,7 @@ namespace nil {
                     using reference = Reference;
                     using ConstReference = typename std::add_const<Reference>::type;
 
-                    iterator_base(QueueType &queue, ArrayIterator iterator) : queue_(queue), iterator_(iterator) {
+                    iterator_base(QueueType &queue, ArrayIterator iter) : queue_(queue), iterator_(iter) {
                     }
 
                     Derived &operator=(const iterator_base &other) {
@@ -1034,7 +1134,7 @@ namespace nil {
 
                     ~const_iterator() noexcept = default;
 
-                    const_iterator(QueueType &queue, ArrayIterator iterator) : Base(queue, iterator) {
+                    const_iterator(QueueType &queue, ArrayIterator iter) : Base(queue, iter) {
                     }
                 };
 
@@ -1054,7 +1154,7 @@ namespace nil {
 
                     ~iterator() noexcept = default;
 
-                    iterator(QueueType &queue, ArrayIterator iterator) : Base(queue, iterator) {
+                    iterator(QueueType &queue, ArrayIterator iter) : Base(queue, iter) {
                     }
 
                     operator const_iterator() const {
@@ -1090,16 +1190,19 @@ namespace nil {
                     using storage_type =
                         typename std::aligned_storage<sizeof(value_type), std::alignment_of<value_type>::value>::type;
                     using StorageTypePtr = storage_type *;
-                    using Reference = value_type &;
-                    using ConstReference = const value_type &;
-                    using Pointer = value_type *;
-                    using ConstPointer = const value_type *;
-                    using LinearisedIterator = Pointer;
-                    using ConstLinearisedIterator = ConstPointer;
-                    using ReverseLinearisedIterator = std::reverse_iterator<LinearisedIterator>;
-                    using ConstReverseLinearisedIterator = std::reverse_iterator<ConstLinearisedIterator>;
-                    using LinearisedIteratorRange = std::pair<LinearisedIterator, LinearisedIterator>;
-                    using ConstLinearisedIteratorRange = std::pair<ConstLinearisedIterator, ConstLinearisedIterator>;
+                    using reference = value_type &;
+                    using const_reference = const value_type &;
+                    using pointer = value_type *;
+                    using const_pointer = const value_type *;
+                    using linearised_iterator = pointer;
+                    using const_linearised_iterator = const_pointer;
+                    using reverse_linearised_iterator = std::reverse_iterator<linearised_iterator>;
+                    using const_reverse_linearised_iterator = std::reverse_iterator<const_linearised_iterator>;
+                    using linearised_iterator_range = std::pair<linearised_iterator, linearised_iterator>;
+                    using const_linearised_iterator_range
+                        = std::pair<const_linearised_iterator, const_linearised_iterator>;
+                    using iterator = Iterator;
+                    using const_iterator = ConstIterator;
 
                     CastWrapperQueueBase(StorageTypePtr data, std::size_t capacity) :
                         Base(reinterpret_cast<BaseStorageTypePtr>(data), capacity) {
@@ -1113,138 +1216,139 @@ namespace nil {
 
                     CastWrapperQueueBase &operator=(CastWrapperQueueBase &&other) = default;
 
-                    Reference front() {
-                        return reinterpret_cast<Reference>(Base::front());
+                    reference front() {
+                        return reinterpret_cast<reference>(Base::front());
                     }
 
-                    ConstReference front() const {
-                        return reinterpret_cast<ConstReference>(Base::front());
+                    const_reference front() const {
+                        return reinterpret_cast<const_reference>(Base::front());
                     }
 
-                    Reference back() {
-                        return reinterpret_cast<Reference>(Base::back());
+                    reference back() {
+                        return reinterpret_cast<reference>(Base::back());
                     }
 
-                    ConstReference back() const {
-                        return reinterpret_cast<Reference>(Base::back());
+                    const_reference back() const {
+                        return reinterpret_cast<reference>(Base::back());
                     }
 
-                    Reference operator[](std::size_t index) {
-                        return reinterpret_cast<Reference>(Base::operator[](index));
+                    reference operator[](std::size_t index) {
+                        return reinterpret_cast<reference>(Base::operator[](index));
                     }
 
-                    ConstReference operator[](std::size_t index) const {
-                        return reinterpret_cast<ConstReference>(Base::operator[](index));
+                    const_reference operator[](std::size_t index) const {
+                        return reinterpret_cast<const_reference>(Base::operator[](index));
                     }
 
-                    Reference at(std::size_t index) {
-                        return reinterpret_cast<Reference>(Base::at(index));
+                    reference at(std::size_t index) {
+                        return reinterpret_cast<reference>(Base::at(index));
                     }
 
-                    ConstReference at(std::size_t index) const {
-                        return reinterpret_cast<ConstReference>(Base::at(index));
+                    const_reference at(std::size_t index) const {
+                        return reinterpret_cast<const_reference>(Base::at(index));
                     }
 
-                    int indexOf(ConstReference element) const {
-                        return Base::indexOf(reinterpret_cast<BaseConstReference>(element));
+                    int index_of(const_reference element) const {
+                        return Base::index_of(reinterpret_cast<BaseConstReference>(element));
                     }
 
-                    LinearisedIterator invalidIter() {
-                        return reinterpret_cast<LinearisedIterator>(Base::invalidIter());
+                    linearised_iterator invalid_iter() {
+                        return reinterpret_cast<linearised_iterator>(Base::invalid_iter());
                     }
 
-                    ConstLinearisedIterator invalidIter() const {
-                        return reinterpret_cast<ConstLinearisedIterator>(Base::invalidIter());
+                    const_linearised_iterator invalid_iter() const {
+                        return reinterpret_cast<const_linearised_iterator>(Base::invalid_iter());
                     }
 
-                    ReverseLinearisedIterator invalidReverseIter() {
-                        return ReverseLinearisedIterator(
-                            reinterpret_cast<LinearisedIterator>(Base::invalidReverseIter().base()));
+                    reverse_linearised_iterator invalid_reverse_iter() {
+                        return reverse_linearised_iterator(
+                            reinterpret_cast<linearised_iterator>(Base::invalid_reverse_iter().base()));
                     }
 
-                    ConstReverseLinearisedIterator invalidReverseIter() const {
-                        return ConstReverseLinearisedIterator(
-                            reinterpret_cast<ConstLinearisedIterator>(Base::invalidReverseIter().base()));
+                    const_reverse_linearised_iterator invalid_reverse_iter() const {
+                        return const_reverse_linearised_iterator(
+                            reinterpret_cast<const_linearised_iterator>(Base::invalid_reverse_iter().base()));
                     }
 
-                    LinearisedIterator lbegin() {
-                        return reinterpret_cast<LinearisedIterator>(Base::lbegin());
+                    linearised_iterator lbegin() {
+                        return reinterpret_cast<linearised_iterator>(Base::lbegin());
                     }
 
-                    ConstLinearisedIterator lbegin() const {
-                        return reinterpret_cast<ConstLinearisedIterator>(Base::lbegin());
+                    const_linearised_iterator lbegin() const {
+                        return reinterpret_cast<const_linearised_iterator>(Base::lbegin());
                     }
 
-                    ConstLinearisedIterator clbegin() const {
-                        return reinterpret_cast<ConstLinearisedIterator>(Base::clbegin());
+                    const_linearised_iterator clbegin() const {
+                        return reinterpret_cast<const_linearised_iterator>(Base::clbegin());
                     }
 
-                    ReverseLinearisedIterator rlbegin() {
-                        return ReverseLinearisedIterator(reinterpret_cast<LinearisedIterator>(Base::rlbegin().base()));
+                    reverse_linearised_iterator rlbegin() {
+                        return reverse_linearised_iterator(
+                            reinterpret_cast<linearised_iterator>(Base::rlbegin().base()));
                     }
 
-                    ConstReverseLinearisedIterator rlbegin() const {
-                        return ConstReverseLinearisedIterator(
-                            reinterpret_cast<ConstLinearisedIterator>(Base::rlbegin().base()));
+                    const_reverse_linearised_iterator rlbegin() const {
+                        return const_reverse_linearised_iterator(
+                            reinterpret_cast<const_linearised_iterator>(Base::rlbegin().base()));
                     }
 
-                    ConstReverseLinearisedIterator crlbegin() const {
-                        return ConstReverseLinearisedIterator(
-                            reinterpret_cast<ConstLinearisedIterator>(Base::crlbegin().base()));
+                    const_reverse_linearised_iterator crlbegin() const {
+                        return const_reverse_linearised_iterator(
+                            reinterpret_cast<const_linearised_iterator>(Base::crlbegin().base()));
                     }
 
-                    LinearisedIterator lend() {
-                        return reinterpret_cast<LinearisedIterator>(Base::lend());
+                    linearised_iterator lend() {
+                        return reinterpret_cast<linearised_iterator>(Base::lend());
                     }
 
-                    ConstLinearisedIterator lend() const {
-                        return reinterpret_cast<ConstLinearisedIterator>(Base::lend());
+                    const_linearised_iterator lend() const {
+                        return reinterpret_cast<const_linearised_iterator>(Base::lend());
                     }
 
-                    ConstLinearisedIterator clend() const {
-                        return reinterpret_cast<ConstLinearisedIterator>(Base::clend());
+                    const_linearised_iterator clend() const {
+                        return reinterpret_cast<const_linearised_iterator>(Base::clend());
                     }
 
-                    ReverseLinearisedIterator rlend() {
-                        return ReverseLinearisedIterator(reinterpret_cast<LinearisedIterator>(Base::rlend().base()));
+                    reverse_linearised_iterator rlend() {
+                        return reverse_linearised_iterator(reinterpret_cast<linearised_iterator>(Base::rlend().base()));
                     }
 
-                    ConstReverseLinearisedIterator rlend() const {
-                        return ConstReverseLinearisedIterator(
-                            reinterpret_cast<ConstLinearisedIterator>(Base::rlend().base()));
+                    const_reverse_linearised_iterator rlend() const {
+                        return const_reverse_linearised_iterator(
+                            reinterpret_cast<const_linearised_iterator>(Base::rlend().base()));
                     }
 
-                    ConstReverseLinearisedIterator crlend() const {
-                        return ConstReverseLinearisedIterator(
-                            reinterpret_cast<ConstLinearisedIterator>(Base::crlend().base()));
+                    const_reverse_linearised_iterator crlend() const {
+                        return const_reverse_linearised_iterator(
+                            reinterpret_cast<const_linearised_iterator>(Base::crlend().base()));
                     }
 
-                    LinearisedIteratorRange arrayOne() {
-                        auto range = Base::arrayOne();
-                        return LinearisedIteratorRange(reinterpret_cast<LinearisedIterator>(range.first),
-                                                       reinterpret_cast<LinearisedIterator>(range.second));
+                    linearised_iterator_range array_one() {
+                        auto range = Base::array_one();
+                        return linearised_iterator_range(reinterpret_cast<linearised_iterator>(range.first),
+                                                       reinterpret_cast<linearised_iterator>(range.second));
                     }
 
-                    ConstLinearisedIteratorRange arrayOne() const {
-                        auto range = Base::arrayOne();
-                        return ConstLinearisedIteratorRange(reinterpret_cast<ConstLinearisedIterator>(range.first),
-                                                            reinterpret_cast<ConstLinearisedIterator>(range.second));
+                    const_linearised_iterator_range array_one() const {
+                        auto range = Base::array_one();
+                        return const_linearised_iterator_range(reinterpret_cast<const_linearised_iterator>(range.first),
+                                                            reinterpret_cast<const_linearised_iterator>(range.second));
                     }
 
-                    LinearisedIteratorRange arrayTwo() {
-                        auto range = Base::arrayTwo();
-                        return LinearisedIteratorRange(reinterpret_cast<LinearisedIterator>(range.first),
-                                                       reinterpret_cast<LinearisedIterator>(range.second));
+                    linearised_iterator_range array_two() {
+                        auto range = Base::array_two();
+                        return linearised_iterator_range(reinterpret_cast<linearised_iterator>(range.first),
+                                                       reinterpret_cast<linearised_iterator>(range.second));
                     }
 
-                    ConstLinearisedIteratorRange arrayTwo() const {
-                        auto range = Base::arrayTwo();
-                        return ConstLinearisedIteratorRange(reinterpret_cast<ConstLinearisedIterator>(range.first),
-                                                            reinterpret_cast<ConstLinearisedIterator>(range.second));
+                    const_linearised_iterator_range array_two() const {
+                        auto range = Base::array_two();
+                        return const_linearised_iterator_range(reinterpret_cast<const_linearised_iterator>(range.first),
+                                                            reinterpret_cast<const_linearised_iterator>(range.second));
                     }
 
-                    LinearisedIterator erase(LinearisedIterator pos) {
-                        return reinterpret_cast<LinearisedIterator>(
+                    linearised_iterator erase(linearised_iterator pos) {
+                        return reinterpret_cast<linearised_iterator>(
                             Base::erase(reinterpret_cast<BaseLinearisedIterator>(pos)));
                     }
 
@@ -1283,26 +1387,47 @@ namespace nil {
                         return *(reinterpret_cast<const_iterator *>(&tmp));
                     }
 
-                    void push_back(ConstReference value) {
+                    void push_back(const_reference value) {
                         Base::push_back(reinterpret_cast<BaseConstReference>(value));
                     }
 
-                    void pushFront(ConstReference value) {
-                        Base::pushFront(reinterpret_cast<BaseConstReference>(value));
+                    void push_back(const_pointer from, const_pointer to) {
+                        Base::push_back(reinterpret_cast<BaseConstPointer>(from),
+                                        reinterpret_cast<BaseConstPointer>(to));
+                    }
+
+                    void push_back(pointer from, pointer to) {
+                        push_back(static_cast<const_pointer>(from), static_cast<const_pointer>(to));
+                    }
+
+                    template<typename TIter>
+                    void push_back(TIter from, TIter to) {
+                        for (; from != to; ++from) {
+                            push_back(static_cast<value_type>(*from));
+                        }
+                    }
+
+                    void push_front(const_reference value) {
+                        Base::push_front(reinterpret_cast<BaseConstReference>(value));
                     }
 
-                    LinearisedIterator insert(LinearisedIterator pos, ConstReference value) {
-                        return reinterpret_cast<LinearisedIterator>(
+                    template<typename... TArgs>
+                    void emplace_back(TArgs &&...args) {
+                        push_back(value_type(std::forward<TArgs>(args)...));
+                    }
+
+                    linearised_iterator insert(linearised_iterator pos, const_reference value) {
+                        return reinterpret_cast<linearised_iterator>(
                             Base::insert(reinterpret_cast<BaseLinearisedIterator>(pos),
                                          reinterpret_cast<BaseConstReference>(value)));
                     }
 
-                    void assignElements(const CastWrapperQueueBase &other) {
-                        Base::assignElements(static_cast<const Base &>(other));
+                    void assign_elements(const CastWrapperQueueBase &other) {
+                        Base::assign_elements(static_cast<const Base &>(other));
                     }
 
-                    void assignElements(CastWrapperQueueBase &&other) {
-                        Base::assignElements(static_cast<Base &&>(std::move(other)));
+                    void assign_elements(CastWrapperQueueBase &&other) {
+                        Base::assign_elements(static_cast<Base &&>(std::move(other)));
                     }
                 };
 
@@ -1319,7 +1444,7 @@ namespace nil {
                     ~ConstIterator() noexcept = default;
 
                 protected:
-                    using ExpectedQueueType = const static_queue_base<TWrapperElemType>;
+                    using ExpectedQueueType = const CastWrapperQueueBase<TWrapperElemType, TQueueElemType>;
                     using ActualQueueType = const static_queue_base<TQueueElemType>;
                     using value_type = TWrapperElemType;
                     using Reference = const value_type &;
@@ -1329,7 +1454,8 @@ namespace nil {
                     using DifferenceType = typename Base::DifferenceType;
 
                     ConstIterator(ExpectedQueueType &queue, Pointer iterator) :
-                        Base(reinterpret_cast<ActualQueueType &>(queue), iterator) {
+                        Base(static_cast<ActualQueueType &>(queue),
+                             reinterpret_cast<typename Base::ArrayIterator>(iterator)) {
                     }
 
                     ConstIterator &operator++() {
@@ -1410,8 +1536,8 @@ namespace nil {
                     ~Iterator() noexcept = default;
 
                 protected:
-                    using ExpectedQueueType = const static_queue_base<TWrapperElemType>;
-                    using ActualQueueType = const static_queue_base<TQueueElemType>;
+                    using ExpectedQueueType = CastWrapperQueueBase<TWrapperElemType, TQueueElemType>;
+                    using ActualQueueType = static_queue_base<TQueueElemType>;
                     using value_type = TWrapperElemType;
                     using Reference = value_type &;
                     using ConstReference = const value_type &;
@@ -1420,7 +1546,8 @@ namespace nil {
                     using DifferenceType = typename Base::DifferenceType;
 
                     Iterator(ExpectedQueueType &queue, Pointer iterator) :
-                        Base(reinterpret_cast<ActualQueueType &>(queue), iterator) {
+                        Base(static_cast<ActualQueueType &>(queue),
+                             reinterpret_cast<typename Base::ArrayIterator>(iterator)) {
                     }
 
                     Iterator &operator++() {
@@ -1586,7 +1713,7 @@ namespace nil {
                                                typename processing::size_to_type<sizeof(T *)>::type>;
 
                 protected:
-                    using Base = typename Base::StorageTypePtr;
+                    using StorageTypePtr = typename Base::StorageTypePtr;
 
                     StaticQueueBaseOptimised(StorageTypePtr data, std::size_t capacity) : Base(data, capacity) {
                     }
@@ -1659,11 +1786,14 @@ namespace nil {
                 class ConstIterator;
 
                 /// @brief Same as ConstIterator
-                using const_iterator = const_iterator;
+                using const_iterator = ConstIterator;
 
                 /// @brief Iterator class
                 class Iterator;
 
+                /// @brief Same as Iterator
+                using iterator = Iterator;
+
                 // Member functions
                 /// @brief Default constructor.
                 /// @details Creates empty queue.
@@ -1681,7 +1811,7 @@ namespace nil {
                 /// @note Exception guarantee: No throw in case copy constructor
                 ///       of the internal elements do not throw, Basic otherwise.
                 static_queue(const static_queue &queue) : Base(&array_[0], TSize) {
-                    Base::assignElements(queue);
+                    Base::assign_elements(queue);
                 }
 
                 /// @brief Move constructor
@@ -1693,7 +1823,7 @@ namespace nil {
                 /// @note Exception guarantee: No throw in case move constructor
                 ///       of the internal elements do not throw, Basic otherwise.
                 static_queue(static_queue &&queue) : Base(&array_[0], TSize) {
-                    Base::assignElements(std::move(queue));
+                    Base::assign_elements(std::move(queue));
                 }
 
                 /// @brief Pseudo copy constructor
@@ -1706,7 +1836,7 @@ namespace nil {
                 ///       of the internal elements do not throw, Basic otherwise.
                 template<std::size_t TAnySize>
                 static_queue(const static_queue<T, TAnySize> &queue) : Base(&array_[0], TSize) {
-                    Base::assignElements(queue);
+                    Base::assign_elements(queue);
                 }
 
                 /// @brief Pseudo move constructor
@@ -1719,7 +1849,7 @@ namespace nil {
                 ///       of the internal elements do not throw, Basic otherwise.
                 template<std::size_t TAnySize>
                 static_queue(static_queue<T, TAnySize> &&queue) : Base(&array_[0], TSize) {
-                    Base::assignElements(std::move(queue));
+                    Base::assign_elements(std::move(queue));
                 }
 
                 /// @brief Destructor
@@ -1857,7 +1987,7 @@ namespace nil {
                 /// @note Exception guarantee: No throw in case the destructor of the
                 ///       popped element doesn't throw. Basic guarantee otherwise.
                 void popBack() {
-                    Base::popBack();
+                    Base::pop_back();
                 }
 
                 /// @brief Same as popBack()
@@ -1875,7 +2005,7 @@ namespace nil {
                 /// @note Exception guarantee: No throw in case the destructor of the
                 ///       popped element doesn't throw. Basic guarantee otherwise.
                 void popBack(std::size_t count) {
-                    Base::popBack(count);
+                    Base::pop_back(count);
                 }
 
                 /// @brief Same as popBack(std::size_t)
@@ -1890,7 +2020,7 @@ namespace nil {
                 /// @note Exception guarantee: No throw in case the destructor of the
                 ///       popped element doesn't throw. Basic guarantee otherwise.
                 void popFront() {
-                    Base::popFront();
+                    Base::pop_front();
                 }
 
                 /// @brief Same as popFront()
@@ -1906,7 +2036,7 @@ namespace nil {
                 /// @note Exception guarantee: No throw in case the destructor of the
                 ///       popped element doesn't throw. Basic guarantee otherwise.
                 void popFront(std::size_t count) {
-                    Base::popFront(count);
+                    Base::pop_front(count);
                 }
 
                 /// @brief Same as popFront(std::size_t)
@@ -1926,6 +2056,22 @@ namespace nil {
                     Base::push_back(std::forward<U>(value));
                 }
 
+                /// @brief Add range of elements to the end of the queue.
+                /// @details For trivially copyable elements provided by pointers the whole
+                ///          range is copied with at most two memcpy() calls (before and after
+                ///          the wrap around of the internal array).
+                /// @param[in] from Iterator to the first element to add.
+                /// @param[in] to Iterator to one-past-last element to add.
+                /// @pre The queue has enough free space for all the elements,
+                ///      i.e. @code std::distance(from, to) <= (capacity() - size()) @endcode
+                /// @note Thread safety: Unsafe
+                /// @note Exception guarantee: No throw in case the copy constructor
+                ///       of the stored elements doesn't throw. Basic guarantee otherwise.
+                template<typename TIter>
+                void push_back(TIter from, TIter to) {
+                    Base::push_back(from, to);
+                }
+
                 /// @brief Construct new element at the end of the queue.
                 /// @details Passes all the provided arguments to the constructor of the
                 ///          element.
@@ -1936,13 +2082,7 @@ namespace nil {
                 ///       of the stored elements doesn't throw. Basic guarantee otherwise.
                 template<typename... TArgs>
                 void emplaceBack(TArgs &&...args) {
-                    Base::emplaceBack(std::forward<TArgs>(args)...);
-                }
-
-                /// @brief Same as push_back(U&&);
-                template<typename U>
-                inline void push_back(U &&value) {
-                    push_back(std::forward<U>(value));
+                    Base::emplace_back(std::forward<TArgs>(args)...);
                 }
 
                 /// @brief Add new element to the beginning of the queue.
@@ -1954,7 +2094,7 @@ namespace nil {
                 ///       of the stored elements doesn't throw. Basic guarantee otherwise.
                 template<typename U>
                 void pushFront(U &&value) {
-                    Base::pushFront(std::forward<U>(value));
+                    Base::push_front(std::forward<U>(value));
                 }
 
                 /// @brief Same as pushFront(U&&);
@@ -2062,7 +2202,7 @@ namespace nil {
                 ///       a writer.
                 /// @note Exception guarantee: No throw.
                 int indexOf(ConstReference element) const {
-                    return Base::indexOf(element);
+                    return Base::index_of(element);
                 }
 
                 /// @brief Invalid iterator
@@ -2072,12 +2212,12 @@ namespace nil {
                 /// @note Thread safety: Safe
                 /// @note Exception guarantee: No throw
                 LinearisedIterator invalidIter() {
-                    return Base::invalidIter();
+                    return Base::invalid_iter();
                 }
 
                 /// @brief Const version of invalidIter()
                 ConstLinearisedIterator invalidIter() const {
-                    return Base::invalidIter();
+                    return Base::invalid_iter();
                 }
 
                 /// @brief Invalid reverse iterator
@@ -2086,12 +2226,12 @@ namespace nil {
                 /// @note Thread safety: Safe
                 /// @note Exception guarantee: No throw
                 ReverseLinearisedIterator invalidReverseIter() {
-                    return Base::invalidReverseIter();
+                    return Base::invalid_reverse_iter();
                 }
 
                 /// @brief Const version of invalidReverseIter()
                 ConstReverseLinearisedIterator invalidReverseIter() const {
-                    return Base::invalidReverseIter();
+                    return Base::invalid_reverse_iter();
                 }
 
                 /// @brief Returns iterator to the linearised beginning.
@@ -2270,12 +2410,12 @@ namespace nil {
                 /// @see isLinearised()
                 /// @see arrayTwo()
                 LinearisedIteratorRange arrayOne() {
-                    return Base::arrayOne();
+                    return Base::array_one();
                 }
 
                 /// @brief Const version of former arrayOne().
                 ConstLinearisedIteratorRange arrayOne() const {
-                    return Base::arrayOne();
+                    return Base::array_one();
                 }
 
                 /// @brief Get the second continuous array of the internal buffer.
@@ -2302,12 +2442,12 @@ namespace nil {
                 /// @see isLinearised()
                 /// @see arrayOne()
                 LinearisedIteratorRange arrayTwo() {
-                    return Base::arrayTwo();
+                    return Base::array_two();
                 }
 
                 /// @brief Const version of former arrayTwo().
                 ConstLinearisedIteratorRange arrayTwo() const {
-                    return Base::arrayTwo();
+                    return Base::array_two();
                 }
 
                 /// @brief Resize the queue.
@@ -2440,9 +2580,6 @@ namespace nil {
                 /// @brief Type of the value referenced by the iterator
                 using value_type = typename Base::value_type;
 
-                /// @brief Same as value_type
-                using value_type = value_type;
-
                 /// @brief Type of the difference between two iterators
                 using DifferenceType = typename Base::DifferenceType;
 
@@ -2622,9 +2759,6 @@ namespace nil {
                 /// @brief Type of the value referenced by the iterator
                 using value_type = typename Base::value_type;
 
-                /// @brief Same as value_type
-                using value_type = value_type;
-
                 /// @brief Type of the difference between two iterators
                 using DifferenceType = typename Base::DifferenceType;
 
@@ -2790,7 +2924,7 @@ namespace nil {
                 }
 
                 operator ConstIterator() const {
-                    auto iter = static_cast<ConstLinearisedIterator>(Base::getIterator());
+                    auto iter = reinterpret_cast<ConstLinearisedIterator>(Base::getIterator());
                     const auto &queue = static_cast<QueueType &>(Base::getQueue());
                     return ConstIterator(queue, iter);
                 }
@@ -0,0 +1,370 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+/// @file nil/marshalling/container/static_spsc_queue.hpp
+/// This file contains the definition and implementation of the static lock-free
+/// single producer / single consumer ring buffer.
+
+#ifndef MARSHALLING_STATIC_SPSC_QUEUE_HPP
+#define MARSHALLING_STATIC_SPSC_QUEUE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <atomic>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+
+#include <nil/marshalling/assert_type.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace container {
+
+            /// @brief Lock-free ring buffer for exactly one producer and one consumer thread.
+            /// @details Same static storage as @ref static_queue, but the read and write
+            ///     positions are atomic counters, so the producer (push_back() / emplace_back())
+            ///     and the consumer (front(), pop_front(), array_one(), array_two()) may run
+            ///     concurrently without locking. The producer publishes the written elements
+            ///     with a release store of the write position, the consumer observes them with
+            ///     an acquire load; the same is done in the opposite direction when elements
+            ///     are consumed. Each side keeps its own position and a cached copy of the other
+            ///     side's position on a separate cache line, so the shared counters are touched
+            ///     only when the cached value is exhausted. The positions run over twice the
+            ///     capacity, which allows distinguishing full queue from the empty one without
+            ///     sacrificing a slot.
+            ///
+            ///     Bulk operations over raw pointers of trivially copyable elements are
+            ///     performed with at most two memcpy() calls (before and after the wrap around).
+            ///
+            ///     The queue is neither copyable nor movable, and all the functions other than
+            ///     the producer / consumer ones listed above may be called only when no other
+            ///     thread accesses the queue.
+            /// @tparam T Type of the stored element.
+            /// @tparam TSize Maximum number of stored elements.
+            template<typename T, std::size_t TSize>
+            class static_spsc_queue {
+                static_assert(0U < TSize, "Queue capacity must be greater than 0");
+
+                struct trivial_copy_tag { };
+                struct generic_copy_tag { };
+
+                template<typename TIter>
+                using range_copy_tag = typename std::conditional<
+                    std::is_trivially_copyable<T>::value && std::is_pointer<TIter>::value
+                        && std::is_same<typename std::remove_cv<typename std::remove_pointer<TIter>::type>::type,
+                                        T>::value,
+                    trivial_copy_tag,
+                    generic_copy_tag>::type;
+
+                using storage_type = typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type;
+
+                static const std::size_t cache_line_size = 64U;
+
+            public:
+                /// @brief Type of the stored elements.
+                using value_type = T;
+
+                /// @brief Size type.
+                using size_type = std::size_t;
+
+                /// @brief Reference type to the stored elements.
+                using reference = value_type &;
+
+                /// @brief Const reference type to the stored elements.
+                using const_reference = const value_type &;
+
+                /// @brief Pointer type to the stored elements.
+                using pointer = value_type *;
+
+                /// @brief Const pointer type to the stored elements.
+                using const_pointer = const value_type *;
+
+                /// @brief Range of contiguous readable elements, see array_one() and array_two().
+                using const_linearised_iterator_range = std::pair<const_pointer, const_pointer>;
+
+                /// @brief Default constructor, creates empty queue.
+                static_spsc_queue() : writeIdx_(0U), readIdxCache_(0U), readIdx_(0U), writeIdxCache_(0U) {
+                }
+
+                static_spsc_queue(const static_spsc_queue &) = delete;
+
+                static_spsc_queue &operator=(const static_spsc_queue &) = delete;
+
+                /// @brief Destructor, destructs the elements which are still stored.
+                ~static_spsc_queue() {
+                    clear();
+                }
+
+                /// @brief Get capacity of the queue.
+                static constexpr size_type capacity() {
+                    return TSize;
+                }
+
+                /// @brief Get number of stored elements.
+                /// @details May be called from any of the two threads, the result is exact
+                ///     for the caller's side and conservative for the other one.
+                size_type size() const {
+                    auto writeIdx = writeIdx_.load(std::memory_order_acquire);
+                    auto readIdx = readIdx_.load(std::memory_order_acquire);
+                    return distance(readIdx, writeIdx);
+                }
+
+                /// @brief Check whether the queue is empty.
+                bool empty() const {
+                    return size() == 0U;
+                }
+
+                /// @brief Check whether the queue is full.
+                bool full() const {
+                    return size() == capacity();
+                }
+
+                /// @brief Producer: add new element at the end of the queue.
+                /// @return false if the queue is full, true otherwise.
+                bool push_back(const value_type &value) {
+                    return emplace_back(value);
+                }
+
+                /// @brief Producer: add new element at the end of the queue.
+                /// @return false if the queue is full, true otherwise.
+                bool push_back(value_type &&value) {
+                    return emplace_back(std::move(value));
+                }
+
+                /// @brief Producer: construct new element at the end of the queue.
+                /// @return false if the queue is full, true otherwise.
+                template<typename... TArgs>
+                bool emplace_back(TArgs &&...args) {
+                    auto writeIdx = writeIdx_.load(std::memory_order_relaxed);
+                    if (free_space(writeIdx, 1U) == 0U) {
+                        return false;
+                    }
+
+                    new (slot(writeIdx)) value_type(std::forward<TArgs>(args)...);
+                    writeIdx_.store(advance(writeIdx, 1U), std::memory_order_release);
+                    return true;
+                }
+
+                /// @brief Producer: add elements of the [from, to) range at the end of the queue.
+                /// @details Elements that don't fit are not added.
+                /// @return Number of added elements.
+                template<typename TIter>
+                size_type push_back(TIter from, TIter to) {
+                    auto writeIdx = writeIdx_.load(std::memory_order_relaxed);
+                    auto count = push_back_range(writeIdx, from, to, range_copy_tag<TIter>());
+                    if (count != 0U) {
+                        writeIdx_.store(advance(writeIdx, count), std::memory_order_release);
+                    }
+                    return count;
+                }
+
+                /// @brief Consumer: access the first element.
+                /// @pre The queue is not empty.
+                reference front() {
+                    auto readIdx = readIdx_.load(std::memory_order_relaxed);
+                    MARSHALLING_ASSERT(0U < available(readIdx, 1U));
+                    return *slot(readIdx);
+                }
+
+                /// @brief Consumer: remove the first element and move it into @b value.
+                /// @return false if the queue is empty, true otherwise.
+                bool pop_front(value_type &value) {
+                    return pop_front(&value, 1U) != 0U;
+                }
+
+                /// @brief Consumer: remove up to @b count elements from the front of the queue
+                ///     and move them into the output iterator.
+                /// @return Number of removed elements.
+                template<typename TIter>
+                size_type pop_front(TIter out, size_type count) {
+                    auto readIdx = readIdx_.load(std::memory_order_relaxed);
+                    count = std::min(count, available(readIdx, count));
+                    pop_front_range(readIdx, out, count, range_copy_tag<TIter>());
+                    if (count != 0U) {
+                        readIdx_.store(advance(readIdx, count), std::memory_order_release);
+                    }
+                    return count;
+                }
+
+                /// @brief Consumer: remove up to @b count elements from the front of the queue.
+                /// @details Usually used after the elements have been processed in place
+                ///     via array_one() and array_two().
+                /// @return Number of removed elements.
+                size_type pop_front(size_type count = 1U) {
+                    auto readIdx = readIdx_.load(std::memory_order_relaxed);
+                    count = std::min(count, available(readIdx, count));
+                    destruct(readIdx, count, std::is_trivially_destructible<value_type>());
+                    if (count != 0U) {
+                        readIdx_.store(advance(readIdx, count), std::memory_order_release);
+                    }
+                    return count;
+                }
+
+                /// @brief Consumer: get the first contiguous range of the readable elements.
+                /// @details The range is empty if the queue is empty.
+                const_linearised_iterator_range array_one() {
+                    auto readIdx = readIdx_.load(std::memory_order_relaxed);
+                    auto count = available(readIdx, capacity());
+                    auto *first = slot(readIdx);
+                    return const_linearised_iterator_range(first,
+                                                           first + std::min(count, capacity() - index_of(readIdx)));
+                }
+
+                /// @brief Consumer: get the second contiguous range of the readable elements.
+                /// @details The range is not empty only if the readable elements wrap around
+                ///     the end of the storage.
+                const_linearised_iterator_range array_two() {
+                    auto readIdx = readIdx_.load(std::memory_order_relaxed);
+                    auto count = available(readIdx, capacity());
+                    auto firstCount = std::min(count, capacity() - index_of(readIdx));
+                    auto *first = slot(0U);
+                    return const_linearised_iterator_range(first, first + (count - firstCount));
+                }
+
+                /// @brief Remove all the elements.
+                /// @pre No other thread accesses the queue.
+                void clear() {
+                    pop_front(capacity());
+                }
+
+            private:
+                static const size_type position_limit = TSize * 2U;
+
+                static size_type advance(size_type idx, size_type count) {
+                    idx += count;
+                    if (position_limit <= idx) {
+                        idx -= position_limit;
+                    }
+                    return idx;
+                }
+
+                static size_type distance(size_type from, size_type to) {
+                    if (from <= to) {
+                        return to - from;
+                    }
+                    return (position_limit - from) + to;
+                }
+
+                static size_type index_of(size_type idx) {
+                    if (TSize <= idx) {
+                        return idx - TSize;
+                    }
+                    return idx;
+                }
+
+                pointer slot(size_type idx) {
+                    return reinterpret_cast<pointer>(&storage_[index_of(idx)]);
+                }
+
+                size_type free_space(size_type writeIdx, size_type required) {
+                    auto freeCount = capacity() - distance(readIdxCache_, writeIdx);
+                    if (freeCount < required) {
+                        readIdxCache_ = readIdx_.load(std::memory_order_acquire);
+                        freeCount = capacity() - distance(readIdxCache_, writeIdx);
+                    }
+                    return freeCount;
+                }
+
+                size_type available(size_type readIdx, size_type required) {
+                    auto count = distance(readIdx, writeIdxCache_);
+                    if (count < required) {
+                        writeIdxCache_ = writeIdx_.load(std::memory_order_acquire);
+                        count = distance(readIdx, writeIdxCache_);
+                    }
+                    return count;
+                }
+
+                template<typename TIter>
+                size_type push_back_range(size_type writeIdx, TIter from, TIter to, trivial_copy_tag) {
+                    auto required = static_cast<size_type>(to - from);
+                    auto count = std::min(required, free_space(writeIdx, required));
+                    auto firstCount = std::min(count, capacity() - index_of(writeIdx));
+                    if (0U < firstCount) {
+                        std::memcpy(slot(writeIdx), from, firstCount * sizeof(value_type));
+                    }
+
+                    if (firstCount < count) {
+                        std::memcpy(slot(0U), from + firstCount, (count - firstCount) * sizeof(value_type));
+                    }
+                    return count;
+                }
+
+                template<typename TIter>
+                size_type push_back_range(size_type writeIdx, TIter from, TIter to, generic_copy_tag) {
+                    auto freeCount = free_space(writeIdx, capacity());
+                    size_type count = 0U;
+                    for (; (from != to) && (count < freeCount); ++from, ++count) {
+                        new (slot(advance(writeIdx, count))) value_type(*from);
+                    }
+                    return count;
+                }
+
+                template<typename TIter>
+                void pop_front_range(size_type readIdx, TIter out, size_type count, trivial_copy_tag) {
+                    auto firstCount = std::min(count, capacity() - index_of(readIdx));
+                    if (0U < firstCount) {
+                        std::memcpy(out, slot(readIdx), firstCount * sizeof(value_type));
+                    }
+
+                    if (firstCount < count) {
+                        std::memcpy(out + firstCount, slot(0U), (count - firstCount) * sizeof(value_type));
+                    }
+                }
+
+                template<typename TIter>
+                void pop_front_range(size_type readIdx, TIter out, size_type count, generic_copy_tag) {
+                    for (size_type idx = 0U; idx < count; ++idx, ++out) {
+                        auto *elem = slot(advance(readIdx, idx));
+                        *out = std::move(*elem);
+                        elem->~T();
+                    }
+                }
+
+                void destruct(size_type, size_type, std::true_type) {
+                }
+
+                void destruct(size_type readIdx, size_type count, std::false_type) {
+                    for (size_type idx = 0U; idx < count; ++idx) {
+                        slot(advance(readIdx, idx))->~T();
+                    }
+                }
+
+                storage_type storage_[TSize];
+
+                // Producer's cache line
+                alignas(cache_line_size) std::atomic<size_type> writeIdx_;
+                size_type readIdxCache_;
+
+                // Consumer's cache line
+                alignas(cache_line_size) std::atomic<size_type> readIdx_;
+                size_type writeIdxCache_;
+            };
+
+        }    // namespace container
+    }    // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_STATIC_SPSC_QUEUE_HPP
@@ -27,10 +27,12 @@
 #define MARSHALLING_STATIC_VECTOR_HPP
 
 #include <cstddef>
+#include <cstring>
 #include <array>
 #include <algorithm>
 #include <iterator>
 #include <initializer_list>
+#include <type_traits>
 
 #include <nil/marshalling/assert_type.hpp>
 
@@ -41,6 +43,33 @@ namespace nil {
 
                 template<typename T>
                 class static_vector_base {
+                    struct trivial_copy_tag { };
+                    struct generic_copy_tag { };
+
+                    using copy_tag = typename std::conditional<std::is_trivially_copyable<T>::value, trivial_copy_tag,
+                                                               generic_copy_tag>::type;
+
+                    /// @brief Check whether elements of the [from, to) range can be copied
+                    ///     into the storage as raw memory.
+                    /// @details The source must be a pointer to the same type, or to integral type
+                    ///     of the same width (conversion between such types preserves bits).
+                    template<typename TIter>
+                    struct is_trivial_copy_range {
+                        using source_type = typename std::remove_cv<typename std::remove_pointer<TIter>::type>::type;
+
+                        static const bool value
+                            = std::is_trivially_copyable<T>::value && std::is_pointer<TIter>::value
+                              && (std::is_same<source_type, T>::value
+                                  || (std::is_integral<source_type>::value && std::is_integral<T>::value
+                                      && (!std::is_same<source_type, bool>::value) && (!std::is_same<T, bool>::value)
+                                      && (sizeof(source_type) == sizeof(T))));
+                    };
+
+                    template<typename TIter>
+                    using range_copy_tag =
+                        typename std::conditional<is_trivial_copy_range<TIter>::value, trivial_copy_tag,
+                                                  generic_copy_tag>::type;
+
                 public:
                     using value_type = T;
                     using size_type = std::size_t;
@@ -109,31 +138,17 @@ namespace nil {
                     template<typename TIter>
                     void assign(TIter from, TIter to) {
                         clear();
-                        for (auto iter = from; iter != to; ++iter) {
-                            if (capacity() <= size()) {
-                                MARSHALLING_ASSERT(!"Not all elements are copied");
-                                return;
-                            }
-
-                            new (cellPtr(size())) T(*iter);
-                            ++size_;
-                        }
+                        assign_internal(from, to, range_copy_tag<TIter>());
                     }
 
                     void fill(std::size_t count, const T &value) {
                         clear();
                         MARSHALLING_ASSERT(count <= capacity());
-                        for (auto idx = 0U; idx < count; ++idx) {
-                            new (cellPtr(idx)) T(value);
-                        }
-                        size_ = count;
+                        fill_internal(count, value, copy_tag());
                     }
 
                     void clear() {
-                        for (auto idx = 0U; idx < size(); ++idx) {
-                            elem(idx).~T();
-                        }
-                        size_ = 0;
+                        clear_internal(copy_tag());
                     }
 
                     T *begin() {
@@ -188,77 +203,18 @@ namespace nil {
 
                     template<typename U>
                     T *insert(const T *pos, U &&value) {
-                        MARSHALLING_ASSERT(pos <= end());
-                        MARSHALLING_ASSERT(size() < capacity());
-                        if (end() <= pos) {
-                            push_back(std::forward<U>(value));
-                            return &(back());
-                        }
-
-                        MARSHALLING_ASSERT(!empty());
-                        push_back(std::move(back()));
-                        auto *insertIter = begin() + std::distance(cbegin(), pos);
-                        std::move_backward(insertIter, end() - 2, end() - 1);
-                        *insertIter = std::forward<U>(value);
-                        return insertIter;
+                        return insert_value(pos, std::forward<U>(value), copy_tag());
                     }
 
                     T *insert(const T *pos, std::size_t count, const T &value) {
-                        MARSHALLING_ASSERT(pos <= end());
-                        MARSHALLING_ASSERT((size() + count) <= capacity());
-                        auto *posIter = begin() + std::distance(cbegin(), pos);
-                        if (end() <= posIter) {
-                            while (0 < count) {
-                                push_back(value);
-                                --count;
-                            }
-                            return posIter;
-                        }
-
-                        MARSHALLING_ASSERT(!empty());
-                        auto tailCount = static_cast<std::size_t>(std::distance(posIter, end()));
-                        if (count <= tailCount) {
-                            auto pushBegIter = end() - count;
-                            auto pushEndIter = end();
-                            for (auto iter = pushBegIter; iter != pushEndIter; ++iter) {
-                                push_back(std::move(*iter));
-                            }
-
-                            auto moveBegIter = posIter;
-                            auto moveEndIter = moveBegIter + (tailCount - count);
-                            MARSHALLING_ASSERT(moveEndIter < pushEndIter);
-                            std::move_backward(moveBegIter, moveEndIter, pushEndIter);
-
-                            auto *assignBegIter = posIter;
-                            auto *assignEndIter = assignBegIter + count;
-                            for (auto iter = assignBegIter; iter != assignEndIter; ++iter) {
-                                *iter = value;
-                            }
-                            return posIter;
-                        }
-
-                        auto pushValueCount = count - tailCount;
-                        for (auto idx = 0U; idx < pushValueCount; ++idx) {
-                            push_back(value);
-                        }
-
-                        auto *pushBegIter = posIter;
-                        auto *pushEndIter = pushBegIter + tailCount;
-                        for (auto iter = pushBegIter; iter != pushEndIter; ++iter) {
-                            push_back(std::move(*iter));
-                        }
-
-                        auto assignBegIter = posIter;
-                        auto assignEndIter = assignBegIter + tailCount;
-                        for (auto iter = assignBegIter; iter != assignEndIter; ++iter) {
-                            *iter = value;
-                        }
-                        return posIter;
+                        return insert_fill(pos, count, value, copy_tag());
                     }
 
                     template<typename TIter>
                     T *insert(const T *pos, TIter from, TIter to) {
-                        using tag = typename std::iterator_traits<TIter>::iterator_category;
+                        using tag = typename std::conditional<
+                            is_trivial_copy_range<TIter>::value, trivial_copy_tag,
+                            typename std::iterator_traits<TIter>::iterator_category>::type;
                         return insert_internal(pos, from, to, tag());
                     }
 
@@ -282,24 +238,7 @@ namespace nil {
                         MARSHALLING_ASSERT(from <= cend());
                         MARSHALLING_ASSERT(to <= cend());
                         MARSHALLING_ASSERT(from <= to);
-
-                        auto tailCount = static_cast<std::size_t>(std::distance(to, cend()));
-                        auto eraseCount = static_cast<std::size_t>(std::distance(from, to));
-
-                        auto *moveSrc = begin() + std::distance(cbegin(), to);
-                        auto *moveDest = begin() + std::distance(cbegin(), from);
-                        std::move(moveSrc, end(), moveDest);
-
-                        auto *eraseFrom = moveDest + tailCount;
-                        auto *eraseTo = end();
-                        MARSHALLING_ASSERT(eraseFrom <= end());
-                        MARSHALLING_ASSERT(eraseCount <= size());
-                        MARSHALLING_ASSERT(static_cast<std::size_t>(std::distance(eraseFrom, eraseTo)) == eraseCount);
-                        for (auto iter = eraseFrom; iter != eraseTo; ++iter) {
-                            iter->~T();
-                        }
-                        size_ -= eraseCount;
-                        return moveDest;
+                        return erase_internal(from, to, copy_tag());
                     }
 
                     template<typename U>
@@ -323,41 +262,12 @@ namespace nil {
                             return;
                         }
 
-                        while (size() < count) {
-                            push_back(value);
-                        }
+                        MARSHALLING_ASSERT(count <= capacity());
+                        fill_internal(count, value, copy_tag());
                     }
 
                     void swap(static_vector_base<T> &other) {
-                        auto swapSize = std::min(other.size(), size());
-                        for (auto idx = 0U; idx < swapSize; ++idx) {
-                            std::swap(this->operator[](idx), other[idx]);
-                        }
-
-                        auto otherSize = other.size();
-                        auto thisSize = size();
-
-                        if (otherSize == thisSize) {
-                            return;
-                        }
-
-                        if (otherSize < thisSize) {
-                            auto limit = std::min(thisSize, other.capacity());
-                            for (auto idx = swapSize; idx < limit; ++idx) {
-                                new (other.cellPtr(idx)) T(std::move(elem(idx)));
-                            }
-
-                            other.size_ = thisSize;
-                            erase(begin() + otherSize, end());
-                            return;
-                        }
-
-                        auto limit = std::min(otherSize, capacity());
-                        for (auto idx = swapSize; idx < limit; ++idx) {
-                            new (cellPtr(idx)) T(std::move(other.elem(idx)));
-                        }
-                        size_ = otherSize;
-                        other.erase(other.begin() + thisSize, other.end());
+                        swap_internal(other, copy_tag());
                     }
 
                 private:
@@ -384,6 +294,188 @@ namespace nil {
                         return reinterpret_cast<const T &>(cell(idx));
                     }
 
+                    /// @brief Raw pointer to the storage cell, valid also for the
+                    ///     past-the-capacity position.
+                    T *rawPtr(std::size_t idx) {
+                        MARSHALLING_ASSERT(idx <= capacity());
+                        return reinterpret_cast<T *>(data_ + idx);
+                    }
+
+                    /// @brief Copy @b count trivially copyable elements into the storage
+                    ///     starting at @b idx, the caller updates the size.
+                    template<typename U>
+                    void copy_raw(std::size_t idx, const U *src, std::size_t count) {
+                        static_assert(sizeof(U) == sizeof(T), "Invalid source type");
+                        if (count == 0U) {
+                            return;
+                        }
+
+                        MARSHALLING_ASSERT((idx + count) <= capacity());
+                        std::memcpy(rawPtr(idx), src, count * sizeof(T));
+                    }
+
+                    /// @brief Move @b count trivially copyable elements inside the storage
+                    ///     from @b fromIdx to @b toIdx, the ranges may overlap.
+                    void move_raw(std::size_t toIdx, std::size_t fromIdx, std::size_t count) {
+                        if (count == 0U) {
+                            return;
+                        }
+
+                        MARSHALLING_ASSERT((toIdx + count) <= capacity());
+                        MARSHALLING_ASSERT((fromIdx + count) <= capacity());
+                        std::memmove(rawPtr(toIdx), rawPtr(fromIdx), count * sizeof(T));
+                    }
+
+                    void clear_internal(generic_copy_tag) {
+                        for (auto idx = 0U; idx < size(); ++idx) {
+                            elem(idx).~T();
+                        }
+                        size_ = 0;
+                    }
+
+                    void clear_internal(trivial_copy_tag) {
+                        // Trivially copyable types are also trivially destructible
+                        size_ = 0;
+                    }
+
+                    template<typename TIter>
+                    void assign_internal(TIter from, TIter to, generic_copy_tag) {
+                        for (auto iter = from; iter != to; ++iter) {
+                            if (capacity() <= size()) {
+                                MARSHALLING_ASSERT(!"Not all elements are copied");
+                                return;
+                            }
+
+                            new (cellPtr(size())) T(*iter);
+                            ++size_;
+                        }
+                    }
+
+                    template<typename TIter>
+                    void assign_internal(TIter from, TIter to, trivial_copy_tag) {
+                        auto count = static_cast<std::size_t>(std::distance(from, to));
+                        if (capacity() < count) {
+                            MARSHALLING_ASSERT(!"Not all elements are copied");
+                            count = capacity();
+                        }
+
+                        copy_raw(0U, from, count);
+                        size_ = count;
+                    }
+
+                    /// @brief Append copies of @b value until the size reaches @b count.
+                    void fill_internal(std::size_t count, const T &value, generic_copy_tag) {
+                        while (size() < count) {
+                            push_back(value);
+                        }
+                    }
+
+                    void fill_internal(std::size_t count, const T &value, trivial_copy_tag) {
+                        if (count <= size()) {
+                            return;
+                        }
+
+                        // The local copy cannot alias the storage, so std::fill_n() is vectorized
+                        // (or reduced to memset() for the single byte types)
+                        T copy(value);
+                        std::fill_n(rawPtr(size()), count - size(), copy);
+                        size_ = count;
+                    }
+
+                    template<typename U>
+                    T *insert_value(const T *pos, U &&value, generic_copy_tag) {
+                        MARSHALLING_ASSERT(pos <= end());
+                        MARSHALLING_ASSERT(size() < capacity());
+                        if (end() <= pos) {
+                            push_back(std::forward<U>(value));
+                            return &(back());
+                        }
+
+                        MARSHALLING_ASSERT(!empty());
+                        push_back(std::move(back()));
+                        auto *insertIter = begin() + std::distance(cbegin(), pos);
+                        std::move_backward(insertIter, end() - 2, end() - 1);
+                        *insertIter = std::forward<U>(value);
+                        return insertIter;
+                    }
+
+                    template<typename U>
+                    T *insert_value(const T *pos, U &&value, trivial_copy_tag) {
+                        MARSHALLING_ASSERT(pos <= end());
+                        MARSHALLING_ASSERT(size() < capacity());
+                        // The value may reference the element being shifted
+                        T copy(std::forward<U>(value));
+                        auto idx = static_cast<std::size_t>(std::distance(cbegin(), pos));
+                        move_raw(idx + 1, idx, size() - idx);
+                        copy_raw(idx, &copy, 1U);
+                        ++size_;
+                        return rawPtr(idx);
+                    }
+
+                    T *insert_fill(const T *pos, std::size_t count, const T &value, generic_copy_tag) {
+                        MARSHALLING_ASSERT(pos <= end());
+                        MARSHALLING_ASSERT((size() + count) <= capacity());
+                        auto *posIter = begin() + std::distance(cbegin(), pos);
+                        if (end() <= posIter) {
+                            while (0 < count) {
+                                push_back(value);
+                                --count;
+                            }
+                            return posIter;
+                        }
+
+                        MARSHALLING_ASSERT(!empty());
+                        auto tailCount = static_cast<std::size_t>(std::distance(posIter, end()));
+                        if (count <= tailCount) {
+                            auto pushBegIter = end() - count;
+                            auto pushEndIter = end();
+                            for (auto iter = pushBegIter; iter != pushEndIter; ++iter) {
+                                push_back(std::move(*iter));
+                            }
+
+                            auto moveBegIter = posIter;
+                            auto moveEndIter = moveBegIter + (tailCount - count);
+                            MARSHALLING_ASSERT(moveEndIter < pushEndIter);
+                            std::move_backward(moveBegIter, moveEndIter, pushEndIter);
+
+                            auto *assignBegIter = posIter;
+                            auto *assignEndIter = assignBegIter + count;
+                            for (auto iter = assignBegIter; iter != assignEndIter; ++iter) {
+                                *iter = value;
+                            }
+                            return posIter;
+                        }
+
+                        auto pushValueCount = count - tailCount;
+                        for (auto idx = 0U; idx < pushValueCount; ++idx) {
+                            push_back(value);
+                        }
+
+                        auto *pushBegIter = posIter;
+                        auto *pushEndIter = pushBegIter + tailCount;
+                        for (auto iter = pushBegIter; iter != pushEndIter; ++iter) {
+                            push_back(std::move(*iter));
+                        }
+
+                        auto assignBegIter = posIter;
+                        auto assignEndIter = assignBegIter + tailCount;
+                        for (auto iter = assignBegIter; iter != assignEndIter; ++iter) {
+                            *iter = value;
+                        }
+                        return posIter;
+                    }
+
+                    T *insert_fill(const T *pos, std::size_t count, const T &value, trivial_copy_tag) {
+                        MARSHALLING_ASSERT(pos <= end());
+                        MARSHALLING_ASSERT((size() + count) <= capacity());
+                        T copy(value);
+                        auto idx = static_cast<std::size_t>(std::distance(cbegin(), pos));
+                        move_raw(idx + count, idx, size() - idx);
+                        std::fill_n(rawPtr(idx), count, copy);
+                        size_ += count;
+                        return rawPtr(idx);
+                    }
+
                     template<typename TIter>
                     T *insert_random_access(const T *pos, TIter from, TIter to) {
                         MARSHALLING_ASSERT(pos <= end());
@@ -466,6 +558,96 @@ namespace nil {
                         return insert_input(pos, from, to);
                     }
 
+                    template<typename TIter>
+                    T *insert_internal(const T *pos, TIter from, TIter to, trivial_copy_tag) {
+                        MARSHALLING_ASSERT(pos <= end());
+                        auto count = static_cast<std::size_t>(std::distance(from, to));
+                        MARSHALLING_ASSERT((size() + count) <= capacity());
+                        auto idx = static_cast<std::size_t>(std::distance(cbegin(), pos));
+                        move_raw(idx + count, idx, size() - idx);
+                        copy_raw(idx, from, count);
+                        size_ += count;
+                        return rawPtr(idx);
+                    }
+
+                    T *erase_internal(const T *from, const T *to, generic_copy_tag) {
+                        auto tailCount = static_cast<std::size_t>(std::distance(to, cend()));
+                        auto eraseCount = static_cast<std::size_t>(std::distance(from, to));
+
+                        auto *moveSrc = begin() + std::distance(cbegin(), to);
+                        auto *moveDest = begin() + std::distance(cbegin(), from);
+                        std::move(moveSrc, end(), moveDest);
+
+                        auto *eraseFrom = moveDest + tailCount;
+                        auto *eraseTo = end();
+                        MARSHALLING_ASSERT(eraseFrom <= end());
+                        MARSHALLING_ASSERT(eraseCount <= size());
+                        MARSHALLING_ASSERT(static_cast<std::size_t>(std::distance(eraseFrom, eraseTo)) == eraseCount);
+                        for (auto iter = eraseFrom; iter != eraseTo; ++iter) {
+                            iter->~T();
+                        }
+                        size_ -= eraseCount;
+                        return moveDest;
+                    }
+
+                    T *erase_internal(const T *from, const T *to, trivial_copy_tag) {
+                        auto fromIdx = static_cast<std::size_t>(std::distance(cbegin(), from));
+                        auto toIdx = static_cast<std::size_t>(std::distance(cbegin(), to));
+                        move_raw(fromIdx, toIdx, size() - toIdx);
+                        size_ -= (toIdx - fromIdx);
+                        return rawPtr(fromIdx);
+                    }
+
+                    void swap_internal(static_vector_base<T> &other, generic_copy_tag) {
+                        auto swapSize = std::min(other.size(), size());
+                        for (auto idx = 0U; idx < swapSize; ++idx) {
+                            std::swap(this->operator[](idx), other[idx]);
+                        }
+
+                        auto otherSize = other.size();
+                        auto thisSize = size();
+
+                        if (otherSize == thisSize) {
+                            return;
+                        }
+
+                        if (otherSize < thisSize) {
+                            auto limit = std::min(thisSize, other.capacity());
+                            for (auto idx = swapSize; idx < limit; ++idx) {
+                                new (other.cellPtr(idx)) T(std::move(elem(idx)));
+                            }
+
+                            other.size_ = thisSize;
+                            erase(begin() + otherSize, end());
+                            return;
+                        }
+
+                        auto limit = std::min(otherSize, capacity());
+                        for (auto idx = swapSize; idx < limit; ++idx) {
+                            new (cellPtr(idx)) T(std::move(other.elem(idx)));
+                        }
+                        size_ = otherSize;
+                        other.erase(other.begin() + thisSize, other.end());
+                    }
+
+                    void swap_internal(static_vector_base<T> &other, trivial_copy_tag) {
+                        auto swapSize = std::min(other.size(), size());
+                        std::swap_ranges(rawPtr(0U), rawPtr(swapSize), other.rawPtr(0U));
+
+                        auto otherSize = other.size();
+                        auto thisSize = size();
+                        if (otherSize < thisSize) {
+                            auto limit = std::min(thisSize, other.capacity());
+                            other.copy_raw(swapSize, rawPtr(swapSize), limit - swapSize);
+                        } else {
+                            auto limit = std::min(otherSize, capacity());
+                            copy_raw(swapSize, other.rawPtr(swapSize), limit - swapSize);
+                        }
+
+                        other.size_ = thisSize;
+                        size_ = otherSize;
+                    }
+
                     cell_type *data_ = nullptr;
                     std::size_t capacity_ = 0;
                     std::size_t size_ = 0;
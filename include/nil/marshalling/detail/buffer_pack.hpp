@@ -0,0 +1,239 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2021 Aleksei Moskvin <alalmoskvin@gmail.com>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef MARSHALLING_MARSHALL_BUFFER_PACK_HPP
+#define MARSHALLING_MARSHALL_BUFFER_PACK_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/parallel_policy.hpp>
+#include <nil/marshalling/type_traits.hpp>
+#include <nil/marshalling/inference.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace detail {
+
+            template<typename T>
+            struct is_byte_output {
+                static const bool value
+                    = std::is_integral<T>::value && !std::is_same<T, bool>::value && (sizeof(T) == 1U);
+            };
+
+            template<typename T, typename Enabled = void>
+            struct packed_type {
+                using type = typename is_compatible<T>::template type<>;
+            };
+
+            template<typename T>
+            struct packed_type<T, typename std::enable_if<is_marshalling_type<T>::value>::type> {
+                using type = T;
+            };
+
+            template<typename T, typename Enabled = void>
+            struct has_fixed_packed_size {
+                static const bool value = is_compatible<T>::fixed_size;
+            };
+
+            template<typename T>
+            struct has_fixed_packed_size<T, typename std::enable_if<is_marshalling_type<T>::value>::type> {
+                static const bool value = (T::min_length() == T::max_length());
+            };
+
+            template<typename TEndian, typename TInput>
+            typename std::enable_if<is_marshalling_type<TInput>::value, const TInput &>::type
+                make_marshalling_value(const TInput &input) {
+                return input;
+            }
+
+            template<typename TEndian, typename TInput>
+            typename std::enable_if<!is_marshalling_type<TInput>::value,
+                                    typename is_compatible<TInput>::template type<TEndian>>::type
+                make_marshalling_value(const TInput &input) {
+                using marshalling_type = typename is_compatible<TInput>::template type<TEndian>;
+                return marshalling_type(input);
+            }
+
+            /// @brief Serialize single value directly into the caller provided buffer.
+            /// @details The required length is computed up front, nothing is written
+            ///     when the buffer is too small.
+            /// @param[in] input Value to serialize, either marshalling field or compatible type.
+            /// @param[in] out Pointer to the beginning of the output buffer.
+            /// @param[in] len Length of the output buffer.
+            /// @param[out] written Number of bytes written.
+            /// @return Status of the operation.
+            template<typename TEndian, typename TInput, typename TOutput>
+            status_type value_buffer_pack(const TInput &input, TOutput *out, std::size_t len, std::size_t &written) {
+                static_assert(is_byte_output<TOutput>::value, "Output buffer must consist of bytes");
+
+                written = 0U;
+                const auto &m_val = make_marshalling_value<TEndian>(input);
+                std::size_t required = m_val.length();
+                if (len < required) {
+                    return status_type::buffer_overflow;
+                }
+
+                TOutput *iter = out;
+                status_type status = m_val.write(iter, required);
+                written = static_cast<std::size_t>(std::distance(out, iter));
+                return status;
+            }
+
+            /// @brief Serialize sequence of fixed length values directly into the
+            ///     caller provided buffer.
+            /// @details Every element is written on its own without creating
+            ///     intermediate collection of fields, nothing is written when the
+            ///     buffer is too small.
+            /// @param[in] first Iterator to the first element of the sequence.
+            /// @param[in] count Number of elements in the sequence.
+            /// @param[in] out Pointer to the beginning of the output buffer.
+            /// @param[in] len Length of the output buffer.
+            /// @param[out] written Number of bytes written.
+            /// @return Status of the operation.
+            template<typename TEndian, typename InputIterator, typename TOutput>
+            status_type range_buffer_pack(InputIterator first, std::size_t count, TOutput *out, std::size_t len,
+                                          std::size_t &written) {
+                using value_type = typename std::iterator_traits<InputIterator>::value_type;
+                using element_type = typename is_compatible<value_type>::template type<TEndian>;
+
+                static_assert(is_byte_output<TOutput>::value, "Output buffer must consist of bytes");
+                static_assert(is_compatible<value_type>::fixed_size, "Elements must have fixed length");
+
+                written = 0U;
+                std::size_t required = count * element_type::max_length();
+                if (len < required) {
+                    return status_type::buffer_overflow;
+                }
+
+                TOutput *iter = out;
+                for (std::size_t i = 0; i < count; ++i, ++first) {
+                    status_type status = element_type(*first).write(iter, element_type::max_length());
+                    if (status != status_type::success) {
+                        written = static_cast<std::size_t>(std::distance(out, iter));
+                        return status;
+                    }
+                }
+
+                written = required;
+                return status_type::success;
+            }
+
+            template<typename TIter>
+            struct is_random_access_iterator {
+                static const bool value
+                    = std::is_base_of<std::random_access_iterator_tag,
+                                      typename std::iterator_traits<TIter>::iterator_category>::value;
+            };
+
+            /// @brief Same as range_buffer_pack(), but splits the sequence into chunks
+            ///     processed according to the parallel policy.
+            /// @details Falls back to range_buffer_pack() for input iterators, which
+            ///     are not random access.
+            template<typename TEndian, typename InputIterator, typename TOutput>
+            typename std::enable_if<is_random_access_iterator<InputIterator>::value, status_type>::type
+                range_buffer_pack(const parallel_policy &policy, InputIterator first, std::size_t count,
+                                  TOutput *out, std::size_t len, std::size_t &written) {
+                using value_type = typename std::iterator_traits<InputIterator>::value_type;
+                using element_type = typename is_compatible<value_type>::template type<TEndian>;
+
+                static_assert(is_compatible<value_type>::fixed_size, "Elements must have fixed length");
+
+                written = 0U;
+                std::size_t required = count * element_type::max_length();
+                if (len < required) {
+                    return status_type::buffer_overflow;
+                }
+
+                parallel_for(policy, count, element_type::max_length(),
+                             [first, out](std::size_t from, std::size_t to) {
+                                 std::size_t chunkWritten = 0U;
+                                 std::size_t chunkLength = (to - from) * element_type::max_length();
+                                 range_buffer_pack<TEndian>(first + from, to - from,
+                                                            out + (from * element_type::max_length()), chunkLength,
+                                                            chunkWritten);
+                             });
+
+                written = required;
+                return status_type::success;
+            }
+
+            template<typename TEndian, typename InputIterator, typename TOutput>
+            typename std::enable_if<!is_random_access_iterator<InputIterator>::value, status_type>::type
+                range_buffer_pack(const parallel_policy &, InputIterator first, std::size_t count, TOutput *out,
+                                  std::size_t len, std::size_t &written) {
+                return range_buffer_pack<TEndian>(first, count, out, len, written);
+            }
+
+            /// @brief Decode sequence of fixed length values from the serialized bytes
+            ///     directly into the caller provided buffer, splitting the sequence into
+            ///     chunks processed according to the parallel policy.
+            /// @param[in] policy Parallel processing policy.
+            /// @param[in] first Iterator to the first serialized byte.
+            /// @param[in] len Number of serialized bytes.
+            /// @param[in] out Pointer to the beginning of the output buffer.
+            /// @param[in] count Number of elements the output buffer can hold.
+            /// @param[out] read Number of decoded elements.
+            /// @return status_type::buffer_overflow if the output buffer is too small,
+            ///     status_type::not_enough_data if input has incomplete trailing element.
+            template<typename TEndian, typename InputIterator, typename TOutput>
+            status_type range_values_pack(const parallel_policy &policy, InputIterator first, std::size_t len,
+                                          TOutput *out, std::size_t count, std::size_t &read) {
+                using element_type = typename is_compatible<TOutput>::template type<TEndian>;
+
+                static_assert(is_compatible<TOutput>::fixed_size, "Elements must have fixed length");
+                static_assert(is_random_access_iterator<InputIterator>::value,
+                              "Input iterator must be random access");
+
+                std::size_t available = len / element_type::max_length();
+                read = std::min(count, available);
+                std::size_t elemLength = element_type::max_length();
+                parallel_for(policy, read, elemLength, [first, out, elemLength](std::size_t from, std::size_t to) {
+                    InputIterator iter = first + (from * elemLength);
+                    for (std::size_t idx = from; idx < to; ++idx) {
+                        element_type elem;
+                        elem.read_no_status(iter);
+                        out[idx] = static_cast<TOutput>(elem.value());
+                    }
+                });
+
+                if (read < available) {
+                    return status_type::buffer_overflow;
+                }
+
+                if ((len % element_type::max_length()) != 0U) {
+                    return status_type::not_enough_data;
+                }
+
+                return status_type::success;
+            }
+        }    // namespace detail
+    }        // namespace marshalling
+}    // namespace nil
+
+#endif    // MARSHALLING_MARSHALL_BUFFER_PACK_HPP
@@ -0,0 +1,631 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_INCREMENTAL_READER_HPP
+#define MARSHALLING_INCREMENTAL_READER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/processing/tuple.hpp>
+#include <nil/marshalling/types/tag.hpp>
+#include <nil/marshalling/types/integral.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace detail {
+
+            struct fixed_length_reader_tag { };
+            struct sequence_reader_tag { };
+            struct ser_length_reader_tag { };
+            struct bundle_reader_tag { };
+            struct generic_reader_tag { };
+
+            template<typename TField>
+            struct is_incremental_sequence {
+                using options_type = typename TField::parsed_options_type;
+                using tag_type = typename TField::tag;
+
+                static const bool value
+                    = (std::is_same<tag_type, types::tag::array_list>::value
+                       || std::is_same<tag_type, types::tag::raw_array_list>::value
+                       || (std::is_same<tag_type, types::tag::string>::value && !options_type::has_sequence_fixed_size))
+                      && !options_type::has_custom_value_reader && !options_type::has_sequence_size_forcing
+                      && !options_type::has_sequence_length_forcing && !options_type::has_sequence_elem_length_forcing
+                      && !options_type::has_sequence_ser_length_field_prefix
+                      && !options_type::has_sequence_elem_ser_length_field_prefix
+                      && !options_type::has_sequence_elem_fixed_ser_length_field_prefix
+                      && !options_type::has_sequence_trailing_field_suffix
+                      && !options_type::has_sequence_termination_field_suffix
+                      && !options_type::has_sequence_group_varint && !options_type::has_fail_on_invalid
+                      && !options_type::has_ignore_invalid && !options_type::has_empty_serialization
+                      && !options_type::has_versions_range && !options_type::has_orig_data_view
+                      && !options_type::has_custom_storage_type && !options_type::has_lazy_elements_view && !TField::is_version_dependent();
+            };
+
+            template<typename TField>
+            struct is_ser_length_prefixed {
+                using options_type = typename TField::parsed_options_type;
+
+                static const bool value
+                    = options_type::has_sequence_ser_length_field_prefix && !options_type::has_custom_value_reader
+                      && !options_type::has_sequence_trailing_field_suffix
+                      && !options_type::has_sequence_termination_field_suffix
+                      && !options_type::has_empty_serialization && !options_type::has_versions_range
+                      && !options_type::has_orig_data_view && !TField::is_version_dependent();
+            };
+
+            template<typename TField>
+            struct is_incremental_bundle {
+                using options_type = typename TField::parsed_options_type;
+
+                static const bool value = std::is_same<typename TField::tag, types::tag::bundle>::value
+                                          && !options_type::has_custom_value_reader
+                                          && !options_type::has_fail_on_invalid && !options_type::has_ignore_invalid
+                                          && !options_type::has_empty_serialization
+                                          && !options_type::has_versions_range && !TField::is_version_dependent();
+            };
+
+            template<typename TField>
+            struct incremental_reader_tag {
+                using type = typename std::conditional<
+                    is_incremental_sequence<TField>::value,
+                    sequence_reader_tag,
+                    typename std::conditional<
+                        is_ser_length_prefixed<TField>::value,
+                        ser_length_reader_tag,
+                        typename std::conditional<
+                            (TField::min_length() == TField::max_length()) && !TField::is_version_dependent(),
+                            fixed_length_reader_tag,
+                            typename std::conditional<is_incremental_bundle<TField>::value, bundle_reader_tag,
+                                                      generic_reader_tag>::type>::type>::type>::type;
+            };
+
+            /// @brief Resumable decoder of a single field.
+            /// @details Accepts serialized data in arbitrary sized chunks via feed() and keeps
+            ///     partial decoding state in between the calls, so every byte is processed
+            ///     only once. Fixed length fields, sequences (with optional size prefix or fixed
+            ///     size) and bundles are decoded incrementally. Sequences with serialization length
+            ///     prefix are staged until the announced length is received and read once. All
+            ///     other fields are staged and re-read on every chunk until enough data is
+            ///     accumulated.
+            /// @tparam TField Type of the field to decode.
+            template<typename TField, typename TTag = typename incremental_reader_tag<TField>::type>
+            class incremental_reader;
+
+            template<typename TField>
+            class incremental_reader<TField, fixed_length_reader_tag> {
+            public:
+                using field_type = TField;
+
+                incremental_reader() : status_(status_type::not_enough_data), size_(0U) {
+                }
+
+                /// @brief Decode the next chunk of data.
+                /// @param[in, out] iter Pointer to the chunk, advanced past the consumed bytes.
+                /// @param[in, out] len Length of the chunk, decreased by number of consumed bytes.
+                /// @param[in] last Whether no more data is going to follow.
+                /// @return status_type::success when the field is complete,
+                ///     status_type::not_enough_data when more data is required, error otherwise.
+                status_type feed(const std::uint8_t *&iter, std::size_t &len, bool last) {
+                    static_cast<void>(last);
+                    if (status_ != status_type::not_enough_data) {
+                        return status_;
+                    }
+
+                    if ((size_ == 0U) && (TField::max_length() <= len)) {
+                        const std::uint8_t *readIter = iter;
+                        status_ = field_.read(readIter, TField::max_length());
+                        size_ = static_cast<std::size_t>(readIter - iter);
+                        len -= size_;
+                        iter = readIter;
+                        return status_;
+                    }
+
+                    std::size_t count = std::min(len, TField::max_length() - size_);
+                    std::copy_n(iter, count, buf_.begin() + size_);
+                    size_ += count;
+                    iter += count;
+                    len -= count;
+                    if (size_ < TField::max_length()) {
+                        return status_;
+                    }
+
+                    const std::uint8_t *readIter = buf_.data();
+                    status_ = field_.read(readIter, size_);
+                    return status_;
+                }
+
+                void reset() {
+                    field_ = TField();
+                    status_ = status_type::not_enough_data;
+                    size_ = 0U;
+                }
+
+                status_type status() const {
+                    return status_;
+                }
+
+                std::size_t consumed() const {
+                    return size_;
+                }
+
+                TField &field() {
+                    return field_;
+                }
+
+                const TField &field() const {
+                    return field_;
+                }
+
+            private:
+                TField field_;
+                status_type status_;
+                std::size_t size_;
+                std::array<std::uint8_t, TField::max_length()> buf_;
+            };
+
+            template<typename TField>
+            class incremental_reader<TField, generic_reader_tag> {
+            public:
+                using field_type = TField;
+
+                incremental_reader() : status_(status_type::not_enough_data), consumed_(0U) {
+                }
+
+                status_type feed(const std::uint8_t *&iter, std::size_t &len, bool last) {
+                    static_cast<void>(last);
+                    if (status_ != status_type::not_enough_data) {
+                        return status_;
+                    }
+
+                    std::size_t prevSize = buf_.size();
+                    buf_.insert(buf_.end(), iter, iter + len);
+                    if (buf_.size() < TField::min_length()) {
+                        iter += len;
+                        len = 0U;
+                        return status_;
+                    }
+
+                    const std::uint8_t *readIter = buf_.data();
+                    status_type es = field_.read(readIter, buf_.size());
+                    if (es == status_type::not_enough_data) {
+                        iter += len;
+                        len = 0U;
+                        return status_;
+                    }
+
+                    std::size_t used = static_cast<std::size_t>(readIter - buf_.data());
+                    std::size_t fromChunk = (used < prevSize) ? 0U : (used - prevSize);
+                    iter += fromChunk;
+                    len -= fromChunk;
+                    consumed_ = used;
+                    status_ = es;
+                    buf_.clear();
+                    return status_;
+                }
+
+                void reset() {
+                    field_ = TField();
+                    status_ = status_type::not_enough_data;
+                    consumed_ = 0U;
+                    buf_.clear();
+                }
+
+                status_type status() const {
+                    return status_;
+                }
+
+                std::size_t consumed() const {
+                    return (status_ == status_type::not_enough_data) ? buf_.size() : consumed_;
+                }
+
+                TField &field() {
+                    return field_;
+                }
+
+                const TField &field() const {
+                    return field_;
+                }
+
+            private:
+                TField field_;
+                status_type status_;
+                std::size_t consumed_;
+                std::vector<std::uint8_t> buf_;
+            };
+
+            template<typename TField>
+            class incremental_reader<TField, ser_length_reader_tag> {
+                using options_type = typename TField::parsed_options_type;
+                using length_reader_type = incremental_reader<typename options_type::sequence_ser_length_field_prefix>;
+
+            public:
+                using field_type = TField;
+
+                incremental_reader() :
+                    status_(status_type::not_enough_data), sized_(false), required_(0U), consumed_(0U) {
+                }
+
+                status_type feed(const std::uint8_t *&iter, std::size_t &len, bool last) {
+                    if (status_ != status_type::not_enough_data) {
+                        return status_;
+                    }
+
+                    if (!sized_) {
+                        const std::uint8_t *start = iter;
+                        status_type es = length_.feed(iter, len, last);
+                        buf_.insert(buf_.end(), start, iter);
+                        if (es != status_type::success) {
+                            return read_staged(es);
+                        }
+
+                        required_ = length_.consumed() + static_cast<std::size_t>(length_.field().value());
+                        sized_ = true;
+                    }
+
+                    std::size_t count = std::min(len, required_ - buf_.size());
+                    buf_.insert(buf_.end(), iter, iter + count);
+                    iter += count;
+                    len -= count;
+                    if ((buf_.size() < required_) && (!last)) {
+                        return status_;
+                    }
+
+                    return read_staged(status_type::success);
+                }
+
+                void reset() {
+                    *this = incremental_reader();
+                }
+
+                status_type status() const {
+                    return status_;
+                }
+
+                std::size_t consumed() const {
+                    return (status_ == status_type::not_enough_data) ? buf_.size() : consumed_;
+                }
+
+                TField &field() {
+                    return field_;
+                }
+
+                const TField &field() const {
+                    return field_;
+                }
+
+            private:
+                status_type read_staged(status_type es) {
+                    if (es == status_type::not_enough_data) {
+                        return status_;
+                    }
+
+                    const std::uint8_t *readIter = buf_.data();
+                    status_ = field_.read(readIter, buf_.size());
+                    consumed_ = static_cast<std::size_t>(readIter - buf_.data());
+                    buf_.clear();
+                    return status_;
+                }
+
+                TField field_;
+                length_reader_type length_;
+                status_type status_;
+                bool sized_;
+                std::size_t required_;
+                std::size_t consumed_;
+                std::vector<std::uint8_t> buf_;
+            };
+
+            template<typename TOptions, bool THasPrefix = TOptions::has_sequence_size_field_prefix>
+            struct sequence_size_prefix_reader {
+                struct type {
+                    using field_type = types::integral<marshalling::field_type<option::big_endian>, std::size_t>;
+
+                    status_type feed(const std::uint8_t *&, std::size_t &, bool) {
+                        return status_type::success;
+                    }
+
+                    std::size_t consumed() const {
+                        return 0U;
+                    }
+
+                    field_type field() const {
+                        return field_type();
+                    }
+                };
+            };
+
+            template<typename TOptions>
+            struct sequence_size_prefix_reader<TOptions, true> {
+                using type = incremental_reader<typename TOptions::sequence_size_field_prefix>;
+            };
+
+            template<typename TField, bool TIsRaw = std::is_integral<typename TField::value_type::value_type>::value>
+            struct sequence_element_field {
+                using type = typename TField::value_type::value_type;
+            };
+
+            template<typename TField>
+            struct sequence_element_field<TField, true> {
+                using type = types::integral<marshalling::field_type<option::endian<typename TField::endian_type>>,
+                                             typename TField::value_type::value_type>;
+            };
+
+            template<typename TField>
+            class incremental_reader<TField, sequence_reader_tag> {
+                using options_type = typename TField::parsed_options_type;
+                using prefix_reader_type = typename sequence_size_prefix_reader<options_type>::type;
+                using element_reader_type = incremental_reader<typename sequence_element_field<TField>::type>;
+
+                struct raw_element_tag { };
+                struct field_element_tag { };
+
+                using element_tag =
+                    typename std::conditional<std::is_integral<typename TField::value_type::value_type>::value,
+                                              raw_element_tag, field_element_tag>::type;
+
+            public:
+                using field_type = TField;
+
+                incremental_reader() :
+                    status_(status_type::not_enough_data), remaining_(fixed_size()), counted_(has_known_size()),
+                    consumed_(0U) {
+                }
+
+                status_type feed(const std::uint8_t *&iter, std::size_t &len, bool last) {
+                    if (status_ != status_type::not_enough_data) {
+                        return status_;
+                    }
+
+                    // Same as read() of the field, sequences without size information consume
+                    // at most max_length() bytes, so fixed size storage is never overflown.
+                    std::size_t avail = len;
+                    bool capped = false;
+                    if (!has_size_info() && ((TField::max_length() - consumed_) <= len)) {
+                        avail = TField::max_length() - consumed_;
+                        capped = true;
+                    }
+
+                    std::size_t rest = len - avail;
+                    const std::uint8_t *start = iter;
+                    status_ = feed_internal(iter, avail, last || capped);
+                    consumed_ += static_cast<std::size_t>(iter - start);
+                    len = avail + rest;
+                    return status_;
+                }
+
+                void reset() {
+                    *this = incremental_reader();
+                }
+
+                status_type status() const {
+                    return status_;
+                }
+
+                std::size_t consumed() const {
+                    return consumed_;
+                }
+
+                TField &field() {
+                    return field_;
+                }
+
+                const TField &field() const {
+                    return field_;
+                }
+
+            private:
+                static constexpr std::size_t fixed_size() {
+                    return sequence_fixed_size(std::integral_constant<bool, options_type::has_sequence_fixed_size>());
+                }
+
+                static constexpr std::size_t sequence_fixed_size(std::true_type) {
+                    return options_type::sequence_fixed_size;
+                }
+
+                static constexpr std::size_t sequence_fixed_size(std::false_type) {
+                    return 0U;
+                }
+
+                static constexpr bool has_known_size() {
+                    return options_type::has_sequence_fixed_size;
+                }
+
+                static constexpr bool has_size_info() {
+                    return options_type::has_sequence_fixed_size || options_type::has_sequence_size_field_prefix;
+                }
+
+                status_type feed_internal(const std::uint8_t *&iter, std::size_t &len, bool last) {
+                    if (!counted_ && options_type::has_sequence_size_field_prefix) {
+                        status_type es = prefix_.feed(iter, len, last);
+                        if (es != status_type::success) {
+                            return es;
+                        }
+
+                        remaining_ = static_cast<std::size_t>(prefix_.field().value());
+                        counted_ = true;
+                    }
+
+                    while (true) {
+                        if (counted_) {
+                            if (remaining_ == 0U) {
+                                break;
+                            }
+                        } else if ((len == 0U) && (elem_.consumed() == 0U)) {
+                            if (last) {
+                                break;
+                            }
+
+                            return status_type::not_enough_data;
+                        }
+
+                        status_type es = elem_.feed(iter, len, last);
+                        if (es != status_type::success) {
+                            return es;
+                        }
+
+                        add_element(elem_tag());
+                        elem_.reset();
+                        if (counted_) {
+                            --remaining_;
+                        }
+                    }
+
+                    return status_type::success;
+                }
+
+                static element_tag elem_tag() {
+                    return element_tag();
+                }
+
+                void add_element(raw_element_tag) {
+                    field_.value().push_back(elem_.field().value());
+                }
+
+                void add_element(field_element_tag) {
+                    field_.value().push_back(std::move(elem_.field()));
+                }
+
+                TField field_;
+                prefix_reader_type prefix_;
+                element_reader_type elem_;
+                status_type status_;
+                std::size_t remaining_;
+                bool counted_;
+                std::size_t consumed_;
+            };
+
+            template<typename TTuple>
+            struct bundle_member_readers;
+
+            template<typename... TMembers>
+            struct bundle_member_readers<std::tuple<TMembers...>> {
+                using type = std::tuple<incremental_reader<TMembers>...>;
+            };
+
+            template<typename TField>
+            class incremental_reader<TField, bundle_reader_tag> {
+                using readers_type = typename bundle_member_readers<typename TField::value_type>::type;
+
+                struct member_feeder {
+                    member_feeder(const std::uint8_t *&iter, std::size_t &len, bool last) :
+                        iter_(iter), len_(len), last_(last), status_(status_type::success) {
+                    }
+
+                    template<typename TReader>
+                    void operator()(TReader &reader) {
+                        if (status_ != status_type::success) {
+                            return;
+                        }
+
+                        status_ = reader.feed(iter_, len_, last_);
+                    }
+
+                    const std::uint8_t *&iter_;
+                    std::size_t &len_;
+                    bool last_;
+                    status_type status_;
+                };
+
+                struct member_mover {
+                    explicit member_mover(typename TField::value_type &members) : members_(members) {
+                    }
+
+                    template<std::size_t TIdx, typename TReader>
+                    void operator()(TReader &reader) {
+                        std::get<TIdx>(members_) = std::move(reader.field());
+                    }
+
+                    typename TField::value_type &members_;
+                };
+
+                struct consumed_counter {
+                    template<typename TReader>
+                    std::size_t operator()(std::size_t sum, const TReader &reader) const {
+                        return sum + reader.consumed();
+                    }
+                };
+
+            public:
+                using field_type = TField;
+
+                incremental_reader() : status_(status_type::not_enough_data) {
+                }
+
+                status_type feed(const std::uint8_t *&iter, std::size_t &len, bool last) {
+                    if (status_ != status_type::not_enough_data) {
+                        return status_;
+                    }
+
+                    member_feeder feeder(iter, len, last);
+                    processing::tuple_for_each(readers_, feeder);
+                    status_ = feeder.status_;
+                    if (status_ == status_type::success) {
+                        processing::tuple_for_each_with_template_param_idx(readers_, member_mover(field_.value()));
+                    }
+
+                    return status_;
+                }
+
+                void reset() {
+                    *this = incremental_reader();
+                }
+
+                status_type status() const {
+                    return status_;
+                }
+
+                std::size_t consumed() const {
+                    return processing::tuple_accumulate(readers_, std::size_t(0U), consumed_counter());
+                }
+
+                TField &field() {
+                    return field_;
+                }
+
+                const TField &field() const {
+                    return field_;
+                }
+
+            private:
+                TField field_;
+                readers_type readers_;
+                status_type status_;
+            };
+
+        }    // namespace detail
+    }        // namespace marshalling
+}    // namespace nil
+
+#endif    // MARSHALLING_INCREMENTAL_READER_HPP
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <iterator>
 #include <type_traits>
+#include <vector>
 
 #include <boost/assert.hpp>
 #include <boost/concept_check.hpp>
@@ -41,6 +42,8 @@
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/type_traits.hpp>
 #include <nil/marshalling/inference.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/processing/access.hpp>
 #include <nil/detail/type_traits.hpp>
 
 namespace nil {
@@ -76,18 +79,8 @@ namespace nil {
 
                 template<typename SimilarStdArray>
                 SimilarStdArray similar_std_array_marshalling() {
-                    using marshalling_type = typename is_compatible<SimilarStdArray>::template type<TEndian>;
-
-                    marshalling_type m_val;
-
-                    *status = m_val.read(iterator, count_elements);
-                    auto values = m_val.value();
-
-                    SimilarStdArray result;
-                    for (std::size_t i = 0; i < values.size(); i++) {
-                        result[i] = values[i].value();
-                    }
-                    return result;
+                    using tag = typename std::conditional<is_byte_input(), direct_read_tag, field_read_tag>::type;
+                    return similar_std_array_marshalling<SimilarStdArray>(tag());
                 }
 
                 template<typename T, size_t SizeArray,
@@ -135,6 +128,63 @@ namespace nil {
                              && !nil::marshalling::is_container<typename is_compatible<
                                  typename OutputRange::value_type>::template type<>>::value>::type>
                 inline operator OutputRange() {
+                    using tag = typename std::conditional<
+                        is_byte_input(),
+                        typename std::conditional<has_member_function_resize<OutputRange>::value, direct_read_tag,
+                                                  staged_read_tag>::type,
+                        field_read_tag>::type;
+                    return output_range_marshalling<OutputRange>(tag());
+                }
+
+            private:
+                struct field_read_tag { };
+                struct direct_read_tag { };
+                struct staged_read_tag { };
+                struct bulk_elements_tag { };
+                struct single_elements_tag { };
+
+                using input_value = typename std::iterator_traits<Iter>::value_type;
+
+                static constexpr bool is_byte_input() {
+                    return std::is_integral<input_value>::value && !std::is_same<input_value, bool>::value
+                           && (sizeof(input_value) == 1U);
+                }
+
+                template<typename SimilarStdArray>
+                SimilarStdArray similar_std_array_marshalling(field_read_tag) {
+                    using marshalling_type = typename is_compatible<SimilarStdArray>::template type<TEndian>;
+
+                    marshalling_type m_val;
+
+                    *status = m_val.read(iterator, count_elements);
+                    const auto &values = m_val.value();
+
+                    SimilarStdArray result;
+                    for (std::size_t i = 0; i < values.size(); i++) {
+                        result[i] = values[i].value();
+                    }
+                    return result;
+                }
+
+                template<typename SimilarStdArray>
+                SimilarStdArray similar_std_array_marshalling(direct_read_tag) {
+                    using T = typename SimilarStdArray::value_type;
+
+                    using marshalling_type = typename is_compatible<T>::template type<TEndian>;
+
+                    // Same as the field read, the input exceeding the array is ignored
+                    // and the partial trailing element is reported.
+                    SimilarStdArray result;
+                    std::size_t len = std::min(count_elements, result.size() * marshalling_type::max_length());
+                    result.fill(T());
+                    read_elements<T>(result.data(), result.size());
+                    *status = ((len % marshalling_type::max_length()) != 0U) ? status_type::not_enough_data :
+                                                                                 status_type::success;
+                    return result;
+                }
+
+                template<typename OutputRange>
+                OutputRange output_range_marshalling(field_read_tag) {
                     using T = typename OutputRange::value_type;
                     using marshalling_type = typename is_compatible<std::vector<T>>::template type<TEndian>;
 
@@ -143,11 +193,73 @@ namespace nil {
                     *status = m_val.read(iterator, count_elements);
 
                     std::vector<T> result;
+                    result.reserve(m_val.value().size());
                     for (const auto &val_i : m_val.value()) {
                         result.push_back(val_i.value());
                     }
                     return OutputRange(result.begin(), result.end());
                 }
+
+                template<typename OutputRange>
+                OutputRange output_range_marshalling(direct_read_tag) {
+                    using T = typename OutputRange::value_type;
+                    using marshalling_type = typename is_compatible<T>::template type<TEndian>;
+
+                    OutputRange result;
+                    result.resize(count_elements / marshalling_type::max_length());
+                    read_elements<T>(result.begin(), result.size());
+                    *status = read_status<T>();
+                    return result;
+                }
+
+                template<typename OutputRange>
+                OutputRange output_range_marshalling(staged_read_tag) {
+                    using T = typename OutputRange::value_type;
+                    std::vector<T> result = output_range_marshalling<std::vector<T>>(direct_read_tag());
+                    return OutputRange(result.begin(), result.end());
+                }
+
+                template<typename T>
+                status_type read_status() const {
+                    using marshalling_type = typename is_compatible<T>::template type<TEndian>;
+                    if ((count_elements % marshalling_type::max_length()) != 0U) {
+                        return status_type::not_enough_data;
+                    }
+                    return status_type::success;
+                }
+
+                template<typename T, typename TOutputIter>
+                std::size_t read_elements(TOutputIter out, std::size_t maxCount) {
+                    using marshalling_type = typename is_compatible<T>::template type<TEndian>;
+                    using endian_type = typename field_type<TEndian>::endian_type;
+                    using tag = typename std::conditional<
+                        std::is_same<TOutputIter, T *>::value
+                            && processing::detail::is_bulk_accessible<endian_type, Iter, T>::value,
+                        bulk_elements_tag, single_elements_tag>::type;
+
+                    std::size_t count = std::min(maxCount, count_elements / marshalling_type::max_length());
+                    if (0U < count) {
+                        read_elements_internal<T>(out, count, tag());
+                    }
+                    return count;
+                }
+
+                template<typename T, typename TOutputIter>
+                void read_elements_internal(TOutputIter out, std::size_t count, bulk_elements_tag) {
+                    Iter iter = iterator;
+                    processing::read_data_bulk(out, count, iter, typename field_type<TEndian>::endian_type());
+                }
+
+                template<typename T, typename TOutputIter>
+                void read_elements_internal(TOutputIter out, std::size_t count, single_elements_tag) {
+                    using marshalling_type = typename is_compatible<T>::template type<TEndian>;
+                    Iter iter = iterator;
+                    for (std::size_t i = 0; i < count; ++i, ++out) {
+                        marshalling_type m_val;
+                        m_val.read_no_status(iter);
+                        *out = static_cast<T>(m_val.value());
+                    }
+                }
             };
         }    // namespace detail
     }        // namespace marshalling
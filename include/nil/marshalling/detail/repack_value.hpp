@@ -28,17 +28,22 @@
 #define MARSHALLING_MARSHALL_REPACK_VALUE_HPP
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 #include <type_traits>
+#include <vector>
 
 #include <boost/assert.hpp>
 #include <boost/concept_check.hpp>
 
+#include <boost/array.hpp>
 #include <boost/range/concepts.hpp>
 
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/type_traits.hpp>
 #include <nil/marshalling/inference.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/processing/detail/bulk_access.hpp>
 #include <nil/marshalling/detail/unpack_value.hpp>
 #include <nil/marshalling/detail/pack_value.hpp>
 
@@ -48,6 +53,154 @@ namespace nil {
     namespace marshalling {
         namespace detail {
 
+            template<typename T>
+            struct is_regroupable_word {
+                static const bool value = std::is_integral<T>::value && !std::is_same<T, bool>::value
+                                          && !nil::marshalling::is_supported_representation_type<T>::value
+                                          && ((sizeof(T) == 2U) || (sizeof(T) == 4U) || (sizeof(T) == 8U));
+            };
+
+            template<typename T, typename Enabled = void>
+            struct is_regroupable_output {
+                static const bool value = false;
+            };
+
+            template<typename T>
+            struct is_regroupable_output<T, typename std::enable_if<is_regroupable_word<T>::value>::type> {
+                static const bool value = true;
+            };
+
+            template<typename T, typename TAllocator>
+            struct is_regroupable_output<std::vector<T, TAllocator>,
+                                         typename std::enable_if<is_regroupable_word<T>::value>::type> {
+                static const bool value = true;
+            };
+
+            template<typename T, std::size_t TSize>
+            struct is_regroupable_output<std::array<T, TSize>,
+                                         typename std::enable_if<is_regroupable_word<T>::value>::type> {
+                static const bool value = true;
+            };
+
+            template<typename T, std::size_t TSize>
+            struct is_regroupable_output<boost::array<T, TSize>,
+                                         typename std::enable_if<is_regroupable_word<T>::value>::type> {
+                static const bool value = true;
+            };
+
+            /// @brief Single pass conversion of the sequence of integral words serialized
+            ///     with TInputEndian into the integral words deserialized with TOutputEndian.
+            /// @details Byte shuffle for every combination of endians and word sizes is
+            ///     selected at compile time. The words are converted straight into the
+            ///     output storage without intermediate serialization buffer, input
+            ///     iterators, which are not pointers, are staged through the fixed size
+            ///     block on stack.
+            template<typename TInputEndian, typename TOutputEndian, typename Iter>
+            struct words_regroup_impl {
+                using input_value = typename std::iterator_traits<Iter>::value_type;
+
+                template<typename T>
+                static typename std::enable_if<is_regroupable_word<T>::value, status_type>::type
+                    regroup(Iter first, std::size_t count, T &result) {
+                    result = T();
+                    if (apply(first, count, &result, 1U) != 1U) {
+                        return status_type::not_enough_data;
+                    }
+                    return status_type::success;
+                }
+
+                template<typename T, typename TAllocator>
+                static status_type regroup(Iter first, std::size_t count, std::vector<T, TAllocator> &result) {
+                    std::size_t bytesCount = count * sizeof(input_value);
+                    result.resize(bytesCount / sizeof(T));
+                    if (!result.empty()) {
+                        apply(first, count, result.data(), result.size());
+                    }
+
+                    if ((bytesCount % sizeof(T)) != 0U) {
+                        return status_type::not_enough_data;
+                    }
+                    return status_type::success;
+                }
+
+                template<typename T, std::size_t TSize>
+                static status_type regroup(Iter first, std::size_t count, std::array<T, TSize> &result) {
+                    result.fill(T());
+                    if (apply(first, count, result.data(), TSize) != TSize) {
+                        return status_type::not_enough_data;
+                    }
+                    return status_type::success;
+                }
+
+                template<typename T, std::size_t TSize>
+                static status_type regroup(Iter first, std::size_t count, boost::array<T, TSize> &result) {
+                    result.fill(T());
+                    if (apply(first, count, result.data(), TSize) != TSize) {
+                        return status_type::not_enough_data;
+                    }
+                    return status_type::success;
+                }
+
+            private:
+                struct contiguous_input_tag { };
+                struct staged_input_tag { };
+
+                using input_tag = typename std::conditional<std::is_pointer<Iter>::value, contiguous_input_tag,
+                                                            staged_input_tag>::type;
+
+                static constexpr std::size_t block_length() {
+                    return 256U;
+                }
+
+                static constexpr std::size_t group_size(std::size_t outSize) {
+                    return (sizeof(input_value) < outSize) ? outSize : sizeof(input_value);
+                }
+
+                template<typename TOutputWord>
+                static std::size_t apply(Iter first, std::size_t count, TOutputWord *out, std::size_t outCount) {
+                    using access_type = processing::detail::bulk_regroup_access<
+                        typename field_type<TInputEndian>::endian_type, typename field_type<TOutputEndian>::endian_type,
+                        sizeof(input_value), sizeof(TOutputWord)>;
+
+                    std::size_t wordsCount = std::min(outCount, (count * sizeof(input_value)) / sizeof(TOutputWord));
+                    std::size_t bytesCount = wordsCount * sizeof(TOutputWord);
+                    std::size_t groupedBytes = bytesCount - (bytesCount % group_size(sizeof(TOutputWord)));
+                    auto *dst = reinterpret_cast<std::uint8_t *>(out);
+                    apply_internal<access_type>(first, dst, groupedBytes, input_tag());
+
+                    if (groupedBytes < bytesCount) {
+                        // Output is truncated in the middle of the input word
+                        std::uint8_t tail[group_size(sizeof(TOutputWord))];
+                        apply_internal<access_type>(first, &tail[0], sizeof(tail), input_tag());
+                        std::copy_n(&tail[0], bytesCount - groupedBytes, dst + groupedBytes);
+                    }
+                    return wordsCount;
+                }
+
+                template<typename TAccess>
+                static void apply_internal(Iter &first, std::uint8_t *dst, std::size_t bytesCount,
+                                           contiguous_input_tag) {
+                    TAccess::convert(reinterpret_cast<const std::uint8_t *>(first), dst, bytesCount);
+                    first += bytesCount / sizeof(input_value);
+                }
+
+                template<typename TAccess>
+                static void apply_internal(Iter &first, std::uint8_t *dst, std::size_t bytesCount, staged_input_tag) {
+                    input_value block[block_length()];
+                    std::size_t done = 0U;
+                    while (done < bytesCount) {
+                        std::size_t blockBytes = std::min(bytesCount - done, sizeof(block));
+                        std::size_t blockWords = blockBytes / sizeof(input_value);
+                        for (std::size_t idx = 0; idx < blockWords; ++idx, ++first) {
+                            block[idx] = *first;
+                        }
+
+                        TAccess::convert(reinterpret_cast<const std::uint8_t *>(&block[0]), dst + done, blockBytes);
+                        done += blockBytes;
+                    }
+                }
+            };
+
             template<typename TInputEndian, typename TOutputEndian, typename TInput>
             struct value_repack_impl {
                 status_type *status;
@@ -78,16 +231,10 @@ namespace nil {
                              && !nil::marshalling::is_supported_representation_type<T>::value>::type,
                          bool Enable = true>
                 inline operator T() {
-                    status_type status_unpack, status_pack;
-                    using marshalling_type = typename is_compatible<TInput>::template type<TInputEndian>;
-
-                    std::vector<std::uint8_t> buffer
-                        = value_unpack_impl<marshalling_type>(marshalling_type(input), status_unpack);
-                    T result = range_pack_impl<TOutputEndian, std::vector<std::uint8_t>::const_iterator>(buffer,
-                                                                                                         status_pack);
-                    *status = status_pack | status_unpack;
-
-                    return result;
+                    using tag =
+                        typename std::conditional<is_regroupable_word<TInput>::value && is_regroupable_output<T>::value,
+                                                  regroup_words_tag, regroup_bytes_tag>::type;
+                    return repack<T>(tag());
                 }
 
                 template<typename T,
@@ -117,6 +264,32 @@ namespace nil {
                     T result = value_unpack_impl<TInput>(input, status_unpack);
                     *status = status_unpack;
 
+                    return result;
+                }
+
+            private:
+                struct regroup_words_tag { };
+                struct regroup_bytes_tag { };
+
+                template<typename T>
+                T repack(regroup_words_tag) {
+                    T result;
+                    *status = words_regroup_impl<TInputEndian, TOutputEndian, const TInput *>::regroup(&input, 1U,
+                                                                                                       result);
+                    return result;
+                }
+
+                template<typename T>
+                T repack(regroup_bytes_tag) {
+                    status_type status_unpack, status_pack;
+                    using marshalling_type = typename is_compatible<TInput>::template type<TInputEndian>;
+
+                    std::vector<std::uint8_t> buffer
+                        = value_unpack_impl<marshalling_type>(marshalling_type(input), status_unpack);
+                    T result = range_pack_impl<TOutputEndian, std::vector<std::uint8_t>::const_iterator>(buffer,
+                                                                                                         status_pack);
+                    *status = status_pack | status_unpack;
+
                     return result;
                 }
             };
@@ -175,6 +348,26 @@ namespace nil {
                              && !nil::marshalling::is_supported_representation_type<T>::value>::type,
                          bool Enable1 = true, bool Enable2 = true>
                 inline operator T() {
+                    using tag = typename std::conditional<is_regroupable_word<input_value>::value
+                                                              && is_regroupable_output<T>::value,
+                                                          regroup_words_tag, regroup_bytes_tag>::type;
+                    return repack<T>(tag());
+                }
+
+            private:
+                struct regroup_words_tag { };
+                struct regroup_bytes_tag { };
+
+                template<typename T>
+                T repack(regroup_words_tag) {
+                    T result;
+                    *status = words_regroup_impl<TInputEndian, TOutputEndian, Iter>::regroup(iterator, count_elements,
+                                                                                             result);
+                    return result;
+                }
+
+                template<typename T>
+                T repack(regroup_bytes_tag) {
                     std::vector<std::uint8_t> buffer
                         = range_unpack_impl<TInputEndian, Iter>(iterator, count_elements, status_unpack);
                     T result = range_pack_impl<TOutputEndian, std::vector<std::uint8_t>::const_iterator>(buffer,
@@ -41,6 +41,7 @@
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/type_traits.hpp>
 #include <nil/marshalling/inference.hpp>
+#include <nil/marshalling/detail/buffer_pack.hpp>
 #include <nil/detail/type_traits.hpp>
 
 namespace nil {
@@ -132,24 +133,61 @@ namespace nil {
                         && (std::is_same<typename OutputRange::value_type, bool>::value
                             || std::is_same<typename OutputRange::value_type, std::uint8_t>::value)>::type>
                 inline operator OutputRange() {
-                    using Toutput = typename OutputRange::value_type;
+                    using tag = typename std::conditional<
+                        std::is_same<typename OutputRange::value_type, bool>::value, bits_output_tag,
+                        typename std::conditional<has_member_function_data<OutputRange>::value
+                                                      && has_member_function_resize<OutputRange>::value,
+                                                  contiguous_output_tag, copied_output_tag>::type>::type;
+                    return unpack<OutputRange>(tag());
+                }
 
-                    using marshalling_type = typename is_compatible<std::vector<value_type>>::template type<TEndian>;
-                    using marshalling_internal_type = typename marshalling_type::element_type;
+                template<typename Array,
+                         typename = typename std::enable_if<!std::is_constructible<
+                             Array,
+                             typename std::vector<typename Array::value_type>::iterator,
+                             typename std::vector<typename Array::value_type>::iterator>::value>::type,
+                         typename = typename std::enable_if<
+                             (std::is_same<typename Array::value_type, bool>::value
+                              || std::is_same<typename Array::value_type, std::uint8_t>::value)>::type>
+                inline operator Array() {
+                    using tag = typename std::conditional<std::is_same<typename Array::value_type, bool>::value,
+                                                          bits_output_tag, contiguous_output_tag>::type;
+                    return unpack_array<Array>(tag());
+                }
 
-                    //                using marshalling_vector = typename
-                    //                std::conditional<marshalling::is_compatible<Input>::fixed_size,
-                    //                nil::marshalling::container::static_vector<marshalling_internal_type,
-                    //                marshalling_type::max_length()>, std::vector<marshalling_internal_type>>::type;
-                    using marshalling_vector = std::vector<marshalling_internal_type>;
-                    marshalling_vector values;
+            private:
+                struct bits_output_tag { };
+                struct contiguous_output_tag { };
+                struct copied_output_tag { };
 
-                    auto k = iterator;
-                    for (std::size_t i = 0; i < count_elements; ++i, ++k) {
-                        values.emplace_back(*k);
+                static constexpr std::size_t element_length() {
+                    return is_compatible<value_type>::template type<TEndian>::max_length();
+                }
+
+                template<typename OutputRange>
+                OutputRange unpack(contiguous_output_tag) {
+                    OutputRange result;
+                    result.resize(count_elements * element_length());
+                    std::size_t written = 0U;
+                    if (!result.empty()) {
+                        *status = range_buffer_pack<TEndian>(iterator, count_elements, result.data(), result.size(),
+                                                             written);
+                    } else {
+                        *status = status_type::success;
                     }
+                    return result;
+                }
+
+                template<typename OutputRange>
+                OutputRange unpack(copied_output_tag) {
+                    std::vector<std::uint8_t> result = unpack<std::vector<std::uint8_t>>(contiguous_output_tag());
+                    return OutputRange(result.begin(), result.end());
+                }
 
-                    marshalling_type m_val = marshalling_type(values);
+                template<typename OutputRange>
+                OutputRange unpack(bits_output_tag) {
+                    using Toutput = typename OutputRange::value_type;
+                    auto m_val = make_marshalling_value();
                     std::vector<Toutput> result(get_length<Toutput>(m_val));
                     typename std::vector<Toutput>::iterator buffer_begin = result.begin();
                     *status = m_val.write(buffer_begin, result.size());
@@ -157,16 +195,33 @@ namespace nil {
                     return OutputRange(result.begin(), result.end());
                 }
 
-                template<typename Array,
-                         typename = typename std::enable_if<!std::is_constructible<
-                             Array,
-                             typename std::vector<typename Array::value_type>::iterator,
-                             typename std::vector<typename Array::value_type>::iterator>::value>::type,
-                         typename = typename std::enable_if<
-                             (std::is_same<typename Array::value_type, bool>::value
-                              || std::is_same<typename Array::value_type, std::uint8_t>::value)>::type>
-                inline operator Array() {
-                    using marshalling_type = typename is_compatible<std::vector<value_type>>::template type<TEndian>;
+                template<typename Array>
+                Array unpack_array(contiguous_output_tag) {
+                    Array result;
+                    result.fill(typename Array::value_type());
+
+                    std::size_t fitCount = std::min(count_elements, result.size() / element_length());
+                    std::size_t written = 0U;
+                    *status = range_buffer_pack<TEndian>(iterator, fitCount, result.data(), result.size(), written);
+                    if ((*status == status_type::success) && (fitCount < count_elements)) {
+                        *status = status_type::buffer_overflow;
+                    }
+                    return result;
+                }
+
+                template<typename Array>
+                Array unpack_array(bits_output_tag) {
+                    auto m_val = make_marshalling_value();
+                    Array result;
+                    typename Array::iterator buffer_begin = result.begin();
+                    *status = m_val.write(buffer_begin, result.size());
+
+                    return result;
+                }
+
+                template<typename TValue = value_type>
+                typename is_compatible<std::vector<TValue>>::template type<TEndian> make_marshalling_value() const {
+                    using marshalling_type = typename is_compatible<std::vector<TValue>>::template type<TEndian>;
                     using marshalling_internal_type = typename marshalling_type::element_type;
 
                     //                using marshalling_vector = typename
@@ -175,16 +230,14 @@ namespace nil {
                     //                marshalling_type::max_length()>, std::vector<marshalling_internal_type>>::type;
                     using marshalling_vector = std::vector<marshalling_internal_type>;
                     marshalling_vector values;
+                    values.reserve(count_elements);
+
                     auto k = iterator;
                     for (std::size_t i = 0; i < count_elements; ++i, ++k) {
                         values.emplace_back(*k);
                     }
-                    marshalling_type m_val = marshalling_type(values);
-                    Array result;
-                    typename Array::iterator buffer_begin = result.begin();
-                    *status = m_val.write(buffer_begin, result.size());
 
-                    return result;
+                    return marshalling_type(values);
                 }
             };
         }    // namespace detail
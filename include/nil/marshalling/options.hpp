@@ -210,6 +210,20 @@ namespace nil {
             template<std::size_t TSize>
             struct fixed_size_storage { };
 
+            /// @brief Option that forces usage of embedded storage area for small number of
+            ///     elements, switching to dynamic memory allocation only for the bigger ones.
+            /// @details Applicable to nil::marshalling::types::array_list and nil::marshalling::types::string.
+            ///     If this option is used, it will force such fields to use
+            ///     @ref nil::marshalling::container::small_vector or @ref
+            ///     nil::marshalling::container::small_string with the embedded capacity provided
+            ///     by this option. Unlike @ref fixed_size_storage, there is no limit on the
+            ///     number of stored elements, the ones which don't fit are moved to the heap.
+            /// @tparam TSize Number of elements stored without dynamic memory allocation, for strings
+            ///     it does @b NOT include the '\0' terminating character.
+            /// @headerfile nil/marshalling/options.hpp
+            template<std::size_t TSize>
+            struct small_buffer_storage { };
+
             /// @brief Set custom storage type for fields like nil::marshalling::types::string or
             ///     nil::marshalling::types::array_list.
             /// @details By default nil::marshalling::types::string uses
@@ -314,6 +328,35 @@ namespace nil {
                      status_type TReadErrorStatus = status_type::invalid_msg_data>
             struct sequence_ser_length_field_prefix { };
 
+            /// @brief Option that modifies the default behaviour of @ref nil::marshalling::types::array_list
+            ///     of unsigned integral values to use group varint encoding.
+            /// @details The elements are split into groups of four. Every group starts with
+            ///     a control byte, which contains serialization length (minus one) of every
+            ///     element in the group as two bit value (first element in the least
+            ///     significant bits), followed by the minimal number of bytes required to
+            ///     represent every element in the group. The bytes of every element are
+            ///     serialized using endianness of the field. The last group may contain less than
+            ///     four elements, the codes of absent elements are zero. As the number of
+            ///     elements can not be deduced from the encoded data, the option must be
+            ///     used together with @ref sequence_size_field_prefix.
+            ///     @code
+            ///     using MyFieldBase = nil::marshalling::field_type<nil::marshalling::option::little_endian>;
+            ///     using MyField =
+            ///         nil::marshalling::types::array_list<
+            ///             MyFieldBase,
+            ///             std::uint32_t,
+            ///             nil::marshalling::option::sequence_size_field_prefix<
+            ///                 nil::marshalling::types::integral<MyFieldBase, std::uint32_t,
+            ///                     nil::marshalling::option::var_length<1, 4> >
+            ///             >,
+            ///             nil::marshalling::option::sequence_group_varint
+            ///         >;
+            ///     @endcode
+            ///     When the field is read from contiguous memory area the groups are decoded
+            ///     using vector byte shuffle instructions (if available).
+            /// @headerfile nil/marshalling/options.hpp
+            struct sequence_group_varint { };
+
             /// @brief Option that forces <b>every element</b> of @ref nil::marshalling::types::array_list to
             ///     be prefixed with its serialization length.
             /// @details Similar to @ref sequence_ser_length_field_prefix but instead of the whole
@@ -1083,6 +1126,9 @@ namespace nil {
             /// nil::marshalling::types::array_list,
             ///     will force usage of @ref nil::marshalling::container::string_view and
             ///     nil::marshalling::container::array_view respectively as data storage type.
+            ///     The @ref nil::marshalling::types::array_list of wider integral values (or plain
+            ///     integral and float_value fields) uses nil::marshalling::container::endian_array_view
+            ///     instead, which converts the byte order of the element only when it is accessed.
             /// @note The original data must be preserved until destruction of the field
             ///     that uses the "view".
             /// @note Incompatible with other options that contol data storage type,
@@ -1091,6 +1137,45 @@ namespace nil {
             /// @headerfile nil/marshalling/options.hpp
             struct orig_data_view { };
 
+            /// @brief Decode the elements of the list only when they are accessed.
+            /// @details Can be used with @ref nil::marshalling::types::array_list of fields
+            ///     having fixed serialization length (such as @ref nil::marshalling::types::bundle
+            ///     or @ref nil::marshalling::types::bitfield), will force usage of
+            ///     @ref nil::marshalling::container::lazy_array_view as data storage type.
+            ///     The read operation only checks the length of the input data, the element
+            ///     is located and decoded every time it is accessed. The write operation
+            ///     copies the bytes of the original data.
+            /// @tparam TCached Keep the decoded copies of the elements updated with
+            ///     nil::marshalling::container::lazy_array_view::modify(). The cached elements
+            ///     are serialized again on write, the rest of the data is still copied as is.
+            /// @note The original data must be preserved until destruction of the field
+            ///     that uses the "view".
+            /// @note Incompatible with other options that contol data storage type,
+            ///     such as @ref nil::marshalling::option::custom_storage_type or @ref
+            ///     nil::marshalling::option::orig_data_view
+            /// @headerfile nil/marshalling/options.hpp
+            template<bool TCached = false>
+            struct lazy_elements_view { };
+
+            /// @brief Allocate the storage from the memory resource selected for the current thread.
+            /// @details Can be used with @ref nil::marshalling::types::string and @ref
+            ///     nil::marshalling::types::array_list, will force usage of
+            ///     @ref nil::marshalling::container::resource_string and
+            ///     @ref nil::marshalling::container::resource_vector respectively as data
+            ///     storage type. When the field is read, its storage is re-created from the
+            ///     resource selected by @ref nil::marshalling::container::memory_resource_scope
+            ///     (unless it already uses that one). So when all the dynamic fields of a message
+            ///     use this option, reading it inside the scope of single
+            ///     @ref nil::marshalling::container::monotonic_buffer_resource arena performs no
+            ///     heap allocation per field and the whole message is freed at once when the
+            ///     arena is released. Without active scope the global new and delete are used.
+            /// @note The fields must be destroyed before the memory resource is released.
+            /// @note Incompatible with other options that contol data storage type,
+            ///     such as @ref nil::marshalling::option::custom_storage_type or @ref
+            ///     nil::marshalling::option::fixed_size_storage
+            /// @headerfile nil/marshalling/options.hpp
+            struct memory_resource_storage { };
+
             /// @brief Force field not to be serialized during read/write operations
             /// @details Some protocols may define some constant values that are predefined
             ///     and are not present on I/O link when serialized. Sometimes it is convenient
@@ -1155,6 +1240,23 @@ namespace nil {
             /// @details The version information can be accessed using @b get_version() member function.
             struct version_storage { };
 
+            /// @brief Option for @ref nil::marshalling::types::variant field to select
+            ///     the member to read by the value of its leading key field.
+            /// @details Every member of the variant is expected to be a
+            ///     @ref nil::marshalling::types::bundle which first member is the key field.
+            ///     The key of the member is the default value of that field, specified with
+            ///     @ref default_num_value option and sorted at compile time. Upon read, the
+            ///     key is read only once using provided field type and the matching member is
+            ///     constructed and read directly instead of trying every member in turn.
+            ///     Keys are expected to be unique. If the received key does not match
+            ///     any member, the default behaviour of trying every member is used.
+            /// @tparam TKeyField Field type used to read the key, must have the same
+            ///     serialization as the leading fields of all the members, but without any
+            ///     validity restrictions.
+            /// @headerfile nil/marshalling/options.hpp
+            template<typename TKeyField>
+            struct variant_key_dispatch { };
+
         }    // namespace option
     }        // namespace marshalling
 }    // namespace nil
@@ -0,0 +1,157 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_PARALLEL_POLICY_HPP
+#define MARSHALLING_PARALLEL_POLICY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace nil {
+    namespace marshalling {
+
+        /// @brief Opt-in policy of splitting processing of the long sequences of
+        ///     fixed length elements between several threads.
+        /// @details The sequence is split into independent chunks of elements, which are
+        ///     processed concurrently. The sequences shorter than the threshold
+        ///     (in serialized bytes) are processed serially on the calling thread.
+        ///     By default every chunk but the first one is processed by the newly
+        ///     created std::thread, the custom executor may be provided instead.
+        class parallel_policy {
+        public:
+            /// @brief Processing of the single chunk, receives the index of the chunk.
+            using task_type = std::function<void(std::size_t)>;
+
+            /// @brief Executor, must invoke the task for every chunk index in range
+            ///     [0, tasks count) and return only when all of them are complete.
+            using executor_type = std::function<void(std::size_t, const task_type &)>;
+
+            /// @brief Default threshold (1 MiB) of the serialization length.
+            static constexpr std::size_t default_threshold() {
+                return 1024U * 1024U;
+            }
+
+            /// @brief Constructor
+            /// @param[in] threadsCount Maximal number of threads to use, hardware
+            ///     concurrency by default.
+            /// @param[in] threshold Minimal serialization length to process in parallel.
+            explicit parallel_policy(std::size_t threadsCount = std::thread::hardware_concurrency(),
+                                     std::size_t threshold = default_threshold()) :
+                threads_count_(threadsCount),
+                threshold_(threshold) {
+            }
+
+            /// @brief Constructor
+            /// @param[in] executor Custom executor of the chunk tasks.
+            /// @param[in] threadsCount Maximal number of chunks to split the sequence into.
+            /// @param[in] threshold Minimal serialization length to process in parallel.
+            parallel_policy(executor_type executor, std::size_t threadsCount,
+                            std::size_t threshold = default_threshold()) :
+                threads_count_(threadsCount),
+                threshold_(threshold),
+                executor_(std::move(executor)) {
+            }
+
+            /// @brief Maximal number of threads (chunks).
+            std::size_t threads_count() const {
+                return threads_count_;
+            }
+
+            /// @brief Minimal serialization length to process in parallel.
+            std::size_t threshold() const {
+                return threshold_;
+            }
+
+            /// @brief Invoke task for every chunk index in range [0, tasksCount).
+            void run(std::size_t tasksCount, const task_type &task) const {
+                if (executor_) {
+                    executor_(tasksCount, task);
+                    return;
+                }
+
+                std::vector<std::thread> threads;
+                threads.reserve(tasksCount);
+                threads_joiner joiner(threads);
+                for (std::size_t idx = 1U; idx < tasksCount; ++idx) {
+                    threads.emplace_back(task, idx);
+                }
+
+                if (0U < tasksCount) {
+                    task(0U);
+                }
+            }
+
+        private:
+            // Joins the started threads on any exit from run(), including the exception
+            // thrown when the thread cannot be created.
+            struct threads_joiner {
+                explicit threads_joiner(std::vector<std::thread> &threads) : threads_(threads) {
+                }
+
+                ~threads_joiner() {
+                    for (auto &thread : threads_) {
+                        if (thread.joinable()) {
+                            thread.join();
+                        }
+                    }
+                }
+
+                std::vector<std::thread> &threads_;
+            };
+
+            std::size_t threads_count_;
+            std::size_t threshold_;
+            executor_type executor_;
+        };
+
+        namespace detail {
+
+            /// @brief Split the sequence of fixed length elements into chunks and invoke
+            ///     func(first, last) for every chunk according to the policy.
+            template<typename TFunc>
+            void parallel_for(const parallel_policy &policy, std::size_t count, std::size_t elemLength,
+                              const TFunc &func) {
+                std::size_t tasksCount = std::min(policy.threads_count(), count);
+                if ((tasksCount < 2U) || ((count * elemLength) < policy.threshold())) {
+                    func(0U, count);
+                    return;
+                }
+
+                std::size_t chunkSize = (count + tasksCount - 1U) / tasksCount;
+                tasksCount = (count + chunkSize - 1U) / chunkSize;
+                policy.run(tasksCount, [&func, count, chunkSize](std::size_t idx) {
+                    std::size_t first = idx * chunkSize;
+                    func(first, std::min(count, first + chunkSize));
+                });
+            }
+        }    // namespace detail
+    }        // namespace marshalling
+}    // namespace nil
+
+#endif    // MARSHALLING_PARALLEL_POLICY_HPP
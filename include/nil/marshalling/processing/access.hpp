@@ -33,6 +33,7 @@
 #include <iterator>
 
 #include <nil/marshalling/processing/detail/access.hpp>
+#include <nil/marshalling/processing/detail/bulk_access.hpp>
 #include <nil/marshalling/endianness.hpp>
 
 namespace nil {
@@ -207,6 +208,46 @@ namespace nil {
                 return read_little_endian<T, TSize>(iter);
             }
 
+            /// @brief Read sequence of arithmetic values from the contiguous input area.
+            /// @details The whole block is converted in a single pass using vector byte
+            ///     shuffle instructions when they are available (or plain memory copy when
+            ///     requested endianness matches the host one).
+            /// @tparam T Type of the single value.
+            /// @param[out] values Pointer to the first value to be updated.
+            /// @param[in] count Number of values to read.
+            /// @param[in, out] iter Pointer to the input area.
+            /// @param[in] endian Endianness of the serialized values.
+            /// @pre The input area contains at least count * sizeof(T) bytes.
+            /// @post The iterator is advanced.
+            template<typename T, typename TByte, typename TEndian>
+            void read_data_bulk(T *values, std::size_t count, TByte *&iter, const TEndian &endian) {
+                static_cast<void>(endian);
+                static_assert(detail::is_bulk_accessible<TEndian, TByte *, T>::value,
+                              "Bulk access is not supported for provided types");
+                detail::bulk_word_access<TEndian, sizeof(T)>::convert(reinterpret_cast<const std::uint8_t *>(iter),
+                                                                      reinterpret_cast<std::uint8_t *>(values), count);
+                iter += count * sizeof(T);
+            }
+
+            /// @brief Write sequence of arithmetic values into the contiguous output area.
+            /// @details Counterpart of @ref read_data_bulk().
+            /// @tparam T Type of the single value.
+            /// @param[in] values Pointer to the first value to be written.
+            /// @param[in] count Number of values to write.
+            /// @param[in, out] iter Pointer to the output area.
+            /// @param[in] endian Endianness of the serialized values.
+            /// @pre The output area has space for at least count * sizeof(T) bytes.
+            /// @post The iterator is advanced.
+            template<typename T, typename TByte, typename TEndian>
+            void write_data_bulk(const T *values, std::size_t count, TByte *&iter, const TEndian &endian) {
+                static_cast<void>(endian);
+                static_assert(detail::is_bulk_accessible<TEndian, TByte *, T>::value,
+                              "Bulk access is not supported for provided types");
+                detail::bulk_word_access<TEndian, sizeof(T)>::convert(reinterpret_cast<const std::uint8_t *>(values),
+                                                                      reinterpret_cast<std::uint8_t *>(iter), count);
+                iter += count * sizeof(T);
+            }
+
         }    // namespace processing
     }    // namespace marshalling
 }    // namespace nil
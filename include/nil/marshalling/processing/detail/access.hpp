@@ -31,8 +31,12 @@
 #include <type_traits>
 #include <limits>
 #include <iterator>
+#include <cstring>
+
+#include <boost/endian/conversion.hpp>
 
 #include <nil/marshalling/endianness.hpp>
+#include <nil/marshalling/processing/detail/size_to_type.hpp>
 
 namespace nil {
     namespace marshalling {
@@ -410,6 +414,67 @@ namespace nil {
                     }
                 };
 
+                template<typename TEndian>
+                struct endian_order;
+
+                template<>
+                struct endian_order<endian::big_endian> {
+                    static const boost::endian::order value = boost::endian::order::big;
+                };
+
+                template<>
+                struct endian_order<endian::little_endian> {
+                    static const boost::endian::order value = boost::endian::order::little;
+                };
+
+                /// @brief Whole word access to the contiguous memory area.
+                /// @details Loads or stores TSize bytes with a single unaligned memory
+                ///     access and converts the byte order with the byte-swap intrinsic
+                ///     (no-op when the requested endianness matches the host one).
+                template<typename TEndian, std::size_t TSize>
+                struct word_access {
+                    using word_type = typename size_to_type_helper<TSize>::type;
+
+                    static_assert(sizeof(word_type) == TSize, "Only native word sizes are supported");
+
+                    static const boost::endian::order order = endian_order<TEndian>::value;
+
+                    template<typename T, typename TByte>
+                    static void write(T value, TByte *&iter) {
+                        auto word = boost::endian::conditional_reverse<boost::endian::order::native, order>(
+                            static_cast<word_type>(value));
+                        std::memcpy(iter, &word, TSize);
+                        iter += TSize;
+                    }
+
+                    template<typename T, typename TByte>
+                    static T read(TByte *&iter) {
+                        word_type word;
+                        std::memcpy(&word, iter, TSize);
+                        iter += TSize;
+                        return static_cast<T>(
+                            boost::endian::conditional_reverse<order, boost::endian::order::native>(word));
+                    }
+                };
+
+                template<typename TEndian, typename TIter>
+                struct is_contiguous_byte_access {
+                    using byte_type = typename std::remove_cv<typename std::remove_pointer<TIter>::type>::type;
+
+                    static const bool value
+                        = std::is_pointer<TIter>::value && std::is_integral<byte_type>::value
+                          && (!std::is_same<byte_type, bool>::value) && (sizeof(byte_type) == 1U)
+                          && (std::numeric_limits<unsigned char>::digits == 8)
+                          && (std::is_same<TEndian, endian::big_endian>::value
+                              || std::is_same<TEndian, endian::little_endian>::value);
+                };
+
+                template<typename TEndian, typename TIter, std::size_t TSize>
+                struct is_word_accessible {
+                    static const bool value = is_contiguous_byte_access<TEndian, TIter>::value
+                                              && ((TSize == 2U) || (TSize == 4U) || (TSize == 8U));
+                };
+
                 template<template<typename, bool> class THelper>
                 struct writer {
                     template<typename TEndian, std::size_t TSize, typename T, typename TIter>
@@ -418,10 +483,26 @@ namespace nil {
                         using optimised_value_type = detail::optimised_value_type<value_type>;
 
                         static_assert(TSize <= sizeof(value_type), "Precondition failure");
+                        using tag = typename std::conditional<is_word_accessible<TEndian, TIter, TSize>::value,
+                                                              word_tag, byte_tag>::type;
+                        write_internal<TEndian, TSize>(static_cast<optimised_value_type>(value), iter, tag());
+                    }
+
+                private:
+                    struct word_tag { };
+                    struct byte_tag { };
+
+                    template<typename TEndian, std::size_t TSize, typename T, typename TIter>
+                    static void write_internal(T value, TIter &iter, word_tag) {
+                        word_access<TEndian, TSize>::write(value, iter);
+                    }
+
+                    template<typename TEndian, std::size_t TSize, typename T, typename TIter>
+                    static void write_internal(T value, TIter &iter, byte_tag) {
                         static const bool IsRandomAccess
                             = std::is_same<typename std::iterator_traits<TIter>::iterator_category,
                                            std::random_access_iterator_tag>::value;
-                        THelper<TEndian, IsRandomAccess>::write(static_cast<optimised_value_type>(value), TSize, iter);
+                        THelper<TEndian, IsRandomAccess>::write(value, TSize, iter);
                     }
                 };
 
@@ -434,17 +515,33 @@ namespace nil {
                         using byte_type = detail::byte_type<TIter>;
 
                         static_assert(TSize <= sizeof(value_type), "Precondition failure");
-                        static const bool IsRandomAccess
-                            = std::is_same<typename std::iterator_traits<TIter>::iterator_category,
-                                           std::random_access_iterator_tag>::value;
-                        auto retval = static_cast<value_type>(
-                            THelper<TEndian, IsRandomAccess>::template read<optimised_value_type>(TSize, iter));
+                        using tag = typename std::conditional<is_word_accessible<TEndian, TIter, TSize>::value,
+                                                              word_tag, byte_tag>::type;
+                        auto retval
+                            = static_cast<value_type>(read_internal<TEndian, optimised_value_type, TSize>(iter, tag()));
 
                         if (std::is_signed<value_type>::value) {
                             retval = detail::sign_ext<decltype(retval), TSize, byte_type>::value(retval);
                         }
                         return static_cast<T>(retval);
                     }
+
+                private:
+                    struct word_tag { };
+                    struct byte_tag { };
+
+                    template<typename TEndian, typename T, std::size_t TSize, typename TIter>
+                    static T read_internal(TIter &iter, word_tag) {
+                        return word_access<TEndian, TSize>::template read<T>(iter);
+                    }
+
+                    template<typename TEndian, typename T, std::size_t TSize, typename TIter>
+                    static T read_internal(TIter &iter, byte_tag) {
+                        static const bool IsRandomAccess
+                            = std::is_same<typename std::iterator_traits<TIter>::iterator_category,
+                                           std::random_access_iterator_tag>::value;
+                        return THelper<TEndian, IsRandomAccess>::template read<T>(TSize, iter);
+                    }
                 };
             }    // namespace detail
         }    // namespace processing
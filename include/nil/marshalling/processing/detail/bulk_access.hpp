@@ -0,0 +1,380 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_PROCESSING_BULK_ACCESS_DETAIL_HPP
+#define MARSHALLING_PROCESSING_BULK_ACCESS_DETAIL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include <boost/endian/conversion.hpp>
+
+#include <nil/marshalling/processing/detail/access.hpp>
+#include <nil/marshalling/processing/detail/size_to_type.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace processing {
+            namespace detail {
+
+                template<std::size_t TSize>
+                constexpr std::size_t reversed_index(std::size_t idx) {
+                    return (idx / TSize) * TSize + (TSize - 1U - (idx % TSize));
+                }
+
+                template<std::size_t TSize>
+                constexpr char reversed_byte_index(std::size_t idx) {
+                    return static_cast<char>(reversed_index<TSize>(idx));
+                }
+
+                template<std::size_t TInSize, std::size_t TOutSize>
+                constexpr char regrouped_byte_index(std::size_t idx) {
+                    return static_cast<char>(reversed_index<TInSize>(reversed_index<TOutSize>(idx)));
+                }
+
+                /// @brief Reverses bytes of every TSize long word in the area.
+                /// @details Processes as many words as possible using the available
+                ///     vector byte shuffle instructions and finishes the tail with
+                ///     scalar byte-swap intrinsic. The source and destination areas may
+                ///     be the same.
+                template<std::size_t TSize>
+                struct words_reverser {
+                    using word_type = typename size_to_type_helper<TSize>::type;
+
+                    static_assert(sizeof(word_type) == TSize, "Only native word sizes are supported");
+
+                    static void apply(const std::uint8_t *src, std::uint8_t *dst, std::size_t count) {
+                        std::size_t bytesCount = count * TSize;
+                        std::size_t done = apply_vector(src, dst, bytesCount);
+                        while (done < bytesCount) {
+                            word_type word;
+                            std::memcpy(&word, src + done, TSize);
+                            word = boost::endian::endian_reverse(word);
+                            std::memcpy(dst + done, &word, TSize);
+                            done += TSize;
+                        }
+                    }
+
+                private:
+#if defined(__AVX2__)
+                    static std::size_t apply_vector(const std::uint8_t *src, std::uint8_t *dst,
+                                                    std::size_t bytesCount) {
+                        const __m256i mask = _mm256_setr_epi8(
+                            reversed_byte_index<TSize>(0), reversed_byte_index<TSize>(1),
+                            reversed_byte_index<TSize>(2), reversed_byte_index<TSize>(3),
+                            reversed_byte_index<TSize>(4), reversed_byte_index<TSize>(5),
+                            reversed_byte_index<TSize>(6), reversed_byte_index<TSize>(7),
+                            reversed_byte_index<TSize>(8), reversed_byte_index<TSize>(9),
+                            reversed_byte_index<TSize>(10), reversed_byte_index<TSize>(11),
+                            reversed_byte_index<TSize>(12), reversed_byte_index<TSize>(13),
+                            reversed_byte_index<TSize>(14), reversed_byte_index<TSize>(15),
+                            reversed_byte_index<TSize>(0), reversed_byte_index<TSize>(1),
+                            reversed_byte_index<TSize>(2), reversed_byte_index<TSize>(3),
+                            reversed_byte_index<TSize>(4), reversed_byte_index<TSize>(5),
+                            reversed_byte_index<TSize>(6), reversed_byte_index<TSize>(7),
+                            reversed_byte_index<TSize>(8), reversed_byte_index<TSize>(9),
+                            reversed_byte_index<TSize>(10), reversed_byte_index<TSize>(11),
+                            reversed_byte_index<TSize>(12), reversed_byte_index<TSize>(13),
+                            reversed_byte_index<TSize>(14), reversed_byte_index<TSize>(15));
+
+                        std::size_t done = 0U;
+                        for (; (done + sizeof(__m256i)) <= bytesCount; done += sizeof(__m256i)) {
+                            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + done));
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + done),
+                                                _mm256_shuffle_epi8(block, mask));
+                        }
+                        return done;
+                    }
+#elif defined(__SSSE3__)
+                    static std::size_t apply_vector(const std::uint8_t *src, std::uint8_t *dst,
+                                                    std::size_t bytesCount) {
+                        const __m128i mask = _mm_setr_epi8(
+                            reversed_byte_index<TSize>(0), reversed_byte_index<TSize>(1),
+                            reversed_byte_index<TSize>(2), reversed_byte_index<TSize>(3),
+                            reversed_byte_index<TSize>(4), reversed_byte_index<TSize>(5),
+                            reversed_byte_index<TSize>(6), reversed_byte_index<TSize>(7),
+                            reversed_byte_index<TSize>(8), reversed_byte_index<TSize>(9),
+                            reversed_byte_index<TSize>(10), reversed_byte_index<TSize>(11),
+                            reversed_byte_index<TSize>(12), reversed_byte_index<TSize>(13),
+                            reversed_byte_index<TSize>(14), reversed_byte_index<TSize>(15));
+
+                        std::size_t done = 0U;
+                        for (; (done + sizeof(__m128i)) <= bytesCount; done += sizeof(__m128i)) {
+                            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + done));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + done), _mm_shuffle_epi8(block, mask));
+                        }
+                        return done;
+                    }
+#elif defined(__SSE2__)
+                    static __m128i reverse_block(__m128i block, std::integral_constant<std::size_t, 2>) {
+                        return _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+                    }
+
+                    static __m128i reverse_block(__m128i block, std::integral_constant<std::size_t, 4>) {
+                        block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(2, 3, 0, 1));
+                        block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(2, 3, 0, 1));
+                        return reverse_block(block, std::integral_constant<std::size_t, 2>());
+                    }
+
+                    static __m128i reverse_block(__m128i block, std::integral_constant<std::size_t, 8>) {
+                        block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+                        block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+                        return reverse_block(block, std::integral_constant<std::size_t, 2>());
+                    }
+
+                    static std::size_t apply_vector(const std::uint8_t *src, std::uint8_t *dst,
+                                                    std::size_t bytesCount) {
+                        std::size_t done = 0U;
+                        for (; (done + sizeof(__m128i)) <= bytesCount; done += sizeof(__m128i)) {
+                            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + done));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + done),
+                                             reverse_block(block, std::integral_constant<std::size_t, TSize>()));
+                        }
+                        return done;
+                    }
+#elif defined(__ARM_NEON)
+                    static uint8x16_t reverse_block(uint8x16_t block, std::integral_constant<std::size_t, 2>) {
+                        return vrev16q_u8(block);
+                    }
+
+                    static uint8x16_t reverse_block(uint8x16_t block, std::integral_constant<std::size_t, 4>) {
+                        return vrev32q_u8(block);
+                    }
+
+                    static uint8x16_t reverse_block(uint8x16_t block, std::integral_constant<std::size_t, 8>) {
+                        return vrev64q_u8(block);
+                    }
+
+                    static std::size_t apply_vector(const std::uint8_t *src, std::uint8_t *dst,
+                                                    std::size_t bytesCount) {
+                        std::size_t done = 0U;
+                        for (; (done + sizeof(uint8x16_t)) <= bytesCount; done += sizeof(uint8x16_t)) {
+                            uint8x16_t block = vld1q_u8(src + done);
+                            vst1q_u8(dst + done, reverse_block(block, std::integral_constant<std::size_t, TSize>()));
+                        }
+                        return done;
+                    }
+#else
+                    static std::size_t apply_vector(const std::uint8_t *, std::uint8_t *, std::size_t) {
+                        return 0U;
+                    }
+#endif
+                };
+
+                template<>
+                struct words_reverser<1U> {
+                    static void apply(const std::uint8_t *src, std::uint8_t *dst, std::size_t count) {
+                        if (src != dst) {
+                            std::memmove(dst, src, count);
+                        }
+                    }
+                };
+
+                /// @brief Regroups bytes of the area of TInSize long words, which are
+                ///     serialized in reversed byte order, into the TOutSize long words,
+                ///     which are deserialized in reversed byte order as well.
+                /// @details Equivalent to reversal of the input words followed by the
+                ///     reversal of the output ones, but done in a single pass. The
+                ///     bytes count must be multiple of both sizes.
+                template<std::size_t TInSize, std::size_t TOutSize>
+                struct words_regrouper {
+                    static const std::size_t block_size = (TInSize < TOutSize) ? TOutSize : TInSize;
+
+                    static void apply(const std::uint8_t *src, std::uint8_t *dst, std::size_t bytesCount) {
+                        std::size_t done = apply_vector(src, dst, bytesCount);
+                        for (; done < bytesCount; done += block_size) {
+                            std::uint8_t block[block_size];
+                            for (std::size_t idx = 0; idx < block_size; ++idx) {
+                                block[idx] = src[done + reversed_index<TInSize>(reversed_index<TOutSize>(idx))];
+                            }
+                            std::memcpy(dst + done, &block[0], block_size);
+                        }
+                    }
+
+                private:
+#if defined(__AVX2__)
+                    static std::size_t apply_vector(const std::uint8_t *src, std::uint8_t *dst,
+                                                    std::size_t bytesCount) {
+                        const __m256i mask = _mm256_setr_epi8(
+                            regrouped_byte_index<TInSize, TOutSize>(0), regrouped_byte_index<TInSize, TOutSize>(1),
+                            regrouped_byte_index<TInSize, TOutSize>(2), regrouped_byte_index<TInSize, TOutSize>(3),
+                            regrouped_byte_index<TInSize, TOutSize>(4), regrouped_byte_index<TInSize, TOutSize>(5),
+                            regrouped_byte_index<TInSize, TOutSize>(6), regrouped_byte_index<TInSize, TOutSize>(7),
+                            regrouped_byte_index<TInSize, TOutSize>(8), regrouped_byte_index<TInSize, TOutSize>(9),
+                            regrouped_byte_index<TInSize, TOutSize>(10), regrouped_byte_index<TInSize, TOutSize>(11),
+                            regrouped_byte_index<TInSize, TOutSize>(12), regrouped_byte_index<TInSize, TOutSize>(13),
+                            regrouped_byte_index<TInSize, TOutSize>(14), regrouped_byte_index<TInSize, TOutSize>(15),
+                            regrouped_byte_index<TInSize, TOutSize>(0), regrouped_byte_index<TInSize, TOutSize>(1),
+                            regrouped_byte_index<TInSize, TOutSize>(2), regrouped_byte_index<TInSize, TOutSize>(3),
+                            regrouped_byte_index<TInSize, TOutSize>(4), regrouped_byte_index<TInSize, TOutSize>(5),
+                            regrouped_byte_index<TInSize, TOutSize>(6), regrouped_byte_index<TInSize, TOutSize>(7),
+                            regrouped_byte_index<TInSize, TOutSize>(8), regrouped_byte_index<TInSize, TOutSize>(9),
+                            regrouped_byte_index<TInSize, TOutSize>(10), regrouped_byte_index<TInSize, TOutSize>(11),
+                            regrouped_byte_index<TInSize, TOutSize>(12), regrouped_byte_index<TInSize, TOutSize>(13),
+                            regrouped_byte_index<TInSize, TOutSize>(14), regrouped_byte_index<TInSize, TOutSize>(15));
+
+                        std::size_t done = 0U;
+                        for (; (done + sizeof(__m256i)) <= bytesCount; done += sizeof(__m256i)) {
+                            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + done));
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + done),
+                                                _mm256_shuffle_epi8(block, mask));
+                        }
+                        return done;
+                    }
+#elif defined(__SSSE3__)
+                    static std::size_t apply_vector(const std::uint8_t *src, std::uint8_t *dst,
+                                                    std::size_t bytesCount) {
+                        const __m128i mask = _mm_setr_epi8(
+                            regrouped_byte_index<TInSize, TOutSize>(0), regrouped_byte_index<TInSize, TOutSize>(1),
+                            regrouped_byte_index<TInSize, TOutSize>(2), regrouped_byte_index<TInSize, TOutSize>(3),
+                            regrouped_byte_index<TInSize, TOutSize>(4), regrouped_byte_index<TInSize, TOutSize>(5),
+                            regrouped_byte_index<TInSize, TOutSize>(6), regrouped_byte_index<TInSize, TOutSize>(7),
+                            regrouped_byte_index<TInSize, TOutSize>(8), regrouped_byte_index<TInSize, TOutSize>(9),
+                            regrouped_byte_index<TInSize, TOutSize>(10), regrouped_byte_index<TInSize, TOutSize>(11),
+                            regrouped_byte_index<TInSize, TOutSize>(12), regrouped_byte_index<TInSize, TOutSize>(13),
+                            regrouped_byte_index<TInSize, TOutSize>(14), regrouped_byte_index<TInSize, TOutSize>(15));
+
+                        std::size_t done = 0U;
+                        for (; (done + sizeof(__m128i)) <= bytesCount; done += sizeof(__m128i)) {
+                            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + done));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + done), _mm_shuffle_epi8(block, mask));
+                        }
+                        return done;
+                    }
+#else
+                    static std::size_t apply_vector(const std::uint8_t *, std::uint8_t *, std::size_t) {
+                        return 0U;
+                    }
+#endif
+                };
+
+                /// @brief Conversion of the whole block of words between serialized
+                ///     and host representations.
+                /// @details The conversion is symmetric, i.e. the same operation is used
+                ///     for both reading and writing.
+                template<typename TEndian, std::size_t TSize>
+                struct bulk_word_access {
+                    static void convert(const std::uint8_t *src, std::uint8_t *dst, std::size_t count) {
+                        using tag =
+                            typename std::conditional<endian_order<TEndian>::value == boost::endian::order::native,
+                                                      same_order_tag, reversed_order_tag>::type;
+                        convert_internal(src, dst, count, tag());
+                    }
+
+                private:
+                    struct same_order_tag { };
+                    struct reversed_order_tag { };
+
+                    static void convert_internal(const std::uint8_t *src, std::uint8_t *dst, std::size_t count,
+                                                 same_order_tag) {
+                        if ((src != dst) && (0U < count)) {
+                            std::memmove(dst, src, count * TSize);
+                        }
+                    }
+
+                    static void convert_internal(const std::uint8_t *src, std::uint8_t *dst, std::size_t count,
+                                                 reversed_order_tag) {
+                        words_reverser<TSize>::apply(src, dst, count);
+                    }
+                };
+
+                /// @brief Conversion of the area of TInSize long words serialized with
+                ///     TInEndian into the area of TOutSize long words deserialized with
+                ///     TOutEndian.
+                /// @details The byte shuffle is selected at compile time, the bytes count
+                ///     must be multiple of both sizes.
+                template<typename TInEndian, typename TOutEndian, std::size_t TInSize, std::size_t TOutSize>
+                struct bulk_regroup_access {
+                    static void convert(const std::uint8_t *src, std::uint8_t *dst, std::size_t bytesCount) {
+                        using tag = typename std::conditional<
+                            in_reversed(),
+                            typename std::conditional<out_reversed(),
+                                                      typename std::conditional<TInSize == TOutSize, copy_tag,
+                                                                                regroup_tag>::type,
+                                                      reverse_in_tag>::type,
+                            typename std::conditional<out_reversed(), reverse_out_tag, copy_tag>::type>::type;
+                        convert_internal(src, dst, bytesCount, tag());
+                    }
+
+                private:
+                    struct copy_tag { };
+                    struct reverse_in_tag { };
+                    struct reverse_out_tag { };
+                    struct regroup_tag { };
+
+                    static constexpr bool in_reversed() {
+                        return (TInSize != 1U) && (endian_order<TInEndian>::value != boost::endian::order::native);
+                    }
+
+                    static constexpr bool out_reversed() {
+                        return (TOutSize != 1U) && (endian_order<TOutEndian>::value != boost::endian::order::native);
+                    }
+
+                    static void convert_internal(const std::uint8_t *src, std::uint8_t *dst, std::size_t bytesCount,
+                                                 copy_tag) {
+                        if ((src != dst) && (0U < bytesCount)) {
+                            std::memmove(dst, src, bytesCount);
+                        }
+                    }
+
+                    static void convert_internal(const std::uint8_t *src, std::uint8_t *dst, std::size_t bytesCount,
+                                                 reverse_in_tag) {
+                        words_reverser<TInSize>::apply(src, dst, bytesCount / TInSize);
+                    }
+
+                    static void convert_internal(const std::uint8_t *src, std::uint8_t *dst, std::size_t bytesCount,
+                                                 reverse_out_tag) {
+                        words_reverser<TOutSize>::apply(src, dst, bytesCount / TOutSize);
+                    }
+
+                    static void convert_internal(const std::uint8_t *src, std::uint8_t *dst, std::size_t bytesCount,
+                                                 regroup_tag) {
+                        words_regrouper<TInSize, TOutSize>::apply(src, dst, bytesCount);
+                    }
+                };
+
+                template<typename TEndian, typename TIter, typename T>
+                struct is_bulk_accessible {
+                    static const bool value
+                        = std::is_arithmetic<T>::value && (!std::is_same<T, bool>::value)
+                          && is_contiguous_byte_access<TEndian, TIter>::value
+                          && ((sizeof(T) == 1U) || (sizeof(T) == 2U) || (sizeof(T) == 4U) || (sizeof(T) == 8U));
+                };
+
+            }    // namespace detail
+        }        // namespace processing
+    }            // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_PROCESSING_BULK_ACCESS_DETAIL_HPP
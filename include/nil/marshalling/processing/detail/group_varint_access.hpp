@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_PROCESSING_GROUP_VARINT_ACCESS_DETAIL_HPP
+#define MARSHALLING_PROCESSING_GROUP_VARINT_ACCESS_DETAIL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSSE3__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include <boost/endian/conversion.hpp>
+
+#include <nil/marshalling/endianness.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace processing {
+            namespace detail {
+
+                /// @brief Decoding of the group varint encoded 32 bit values from the
+                ///     contiguous input area.
+                /// @details When vector byte shuffle instructions are available every possible
+                ///     control byte is mapped to the shuffle mask, which moves the bytes of four
+                ///     values into their positions within four 32 bit words (in host byte order)
+                ///     and zeroes the unused ones. The masks are built once on the first use.
+                ///     Otherwise every value is decoded with a single unaligned word load.
+                /// @tparam TEndian Endianness of the bytes of every encoded value.
+                template<typename TEndian>
+                class group_varint_access {
+                public:
+                    static const std::size_t group_size = 4U;
+                    static const std::size_t max_group_data_length = group_size * sizeof(std::uint32_t);
+
+                    /// @brief Whether the vector decoding is used on the target platform.
+                    static constexpr bool vectorized() {
+#if defined(__SSSE3__) || (defined(__ARM_NEON) && defined(__aarch64__))
+                        return boost::endian::order::native == boost::endian::order::little;
+#else
+                        return false;
+#endif
+                    }
+
+                    /// @brief Serialization length of the value encoded with provided two bit code.
+                    static std::size_t value_length(std::uint8_t ctrl, std::size_t idx) {
+                        return static_cast<std::size_t>((ctrl >> (2U * idx)) & 0x3U) + 1U;
+                    }
+
+                    /// @brief Total serialization length of the values of the full group.
+                    static std::size_t data_length(std::uint8_t ctrl) {
+                        return tables().lengths_[ctrl];
+                    }
+
+                    /// @brief Decode full group of four values.
+                    /// @pre At least @ref max_group_data_length bytes are accessible from @b data
+                    ///     (regardless of the actual length of the encoded group).
+                    /// @return Number of consumed data bytes.
+                    static std::size_t decode(std::uint8_t ctrl, const std::uint8_t *data, std::uint32_t *out) {
+                        decode_group(ctrl, data, out, std::integral_constant<bool, vectorized()>());
+                        return data_length(ctrl);
+                    }
+
+                private:
+                    struct tables_type {
+                        tables_type() {
+                            for (std::size_t ctrl = 0U; ctrl < 256U; ++ctrl) {
+                                std::size_t offset = 0U;
+                                for (std::size_t idx = 0U; idx < group_size; ++idx) {
+                                    auto len = value_length(static_cast<std::uint8_t>(ctrl), idx);
+                                    for (std::size_t byteIdx = 0U; byteIdx < sizeof(std::uint32_t); ++byteIdx) {
+                                        auto &maskByte = masks_[ctrl][(idx * sizeof(std::uint32_t)) + byteIdx];
+                                        maskByte = 0x80;    // zeroes the output byte
+                                        if (byteIdx < len) {
+                                            auto srcIdx = offset + source_index(byteIdx, len, TEndian());
+                                            maskByte = static_cast<std::uint8_t>(srcIdx);
+                                        }
+                                    }
+                                    offset += len;
+                                }
+                                lengths_[ctrl] = static_cast<std::uint8_t>(offset);
+                            }
+                        }
+
+                        std::uint8_t masks_[256U][max_group_data_length];
+                        std::uint8_t lengths_[256U];
+                    };
+
+                    static std::size_t source_index(std::size_t byteIdx, std::size_t len, endian::little_endian) {
+                        static_cast<void>(len);
+                        return byteIdx;
+                    }
+
+                    static std::size_t source_index(std::size_t byteIdx, std::size_t len, endian::big_endian) {
+                        return len - 1U - byteIdx;
+                    }
+
+                    static const tables_type &tables() {
+                        static const tables_type Tables;
+                        return Tables;
+                    }
+
+                    static void decode_group(std::uint8_t ctrl, const std::uint8_t *data, std::uint32_t *out,
+                                             std::false_type) {
+                        std::size_t offset = 0U;
+                        for (std::size_t idx = 0U; idx < group_size; ++idx) {
+                            auto len = value_length(ctrl, idx);
+                            std::uint32_t word = 0U;
+                            std::memcpy(&word, data + offset, sizeof(word));
+                            out[idx] = load_word(word, len, TEndian());
+                            offset += len;
+                        }
+                    }
+
+                    static std::uint32_t load_word(std::uint32_t word, std::size_t len, endian::little_endian) {
+                        auto shift = (sizeof(std::uint32_t) - len) * 8U;
+                        return (boost::endian::little_to_native(word) << shift) >> shift;
+                    }
+
+                    static std::uint32_t load_word(std::uint32_t word, std::size_t len, endian::big_endian) {
+                        return boost::endian::big_to_native(word) >> ((sizeof(std::uint32_t) - len) * 8U);
+                    }
+
+#if defined(__SSSE3__)
+                    static void decode_group(std::uint8_t ctrl, const std::uint8_t *data, std::uint32_t *out,
+                                             std::true_type) {
+                        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+                        __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(tables().masks_[ctrl]));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_shuffle_epi8(block, mask));
+                    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+                    static void decode_group(std::uint8_t ctrl, const std::uint8_t *data, std::uint32_t *out,
+                                             std::true_type) {
+                        uint8x16_t block = vld1q_u8(data);
+                        uint8x16_t mask = vld1q_u8(tables().masks_[ctrl]);
+                        vst1q_u8(reinterpret_cast<std::uint8_t *>(out), vqtbl1q_u8(block, mask));
+                    }
+#endif
+                };
+
+            }    // namespace detail
+        }        // namespace processing
+    }            // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_PROCESSING_GROUP_VARINT_ACCESS_DETAIL_HPP
@@ -0,0 +1,162 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_PROCESSING_VAR_LENGTH_ACCESS_DETAIL_HPP
+#define MARSHALLING_PROCESSING_VAR_LENGTH_ACCESS_DETAIL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/endian/conversion.hpp>
+
+#include <nil/marshalling/endianness.hpp>
+#include <nil/marshalling/processing/detail/access.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace processing {
+            namespace detail {
+
+                inline std::size_t count_trailing_zeros(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+                    return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+                    std::size_t count = 0U;
+                    while ((value & 1U) == 0U) {
+                        value >>= 1U;
+                        ++count;
+                    }
+                    return count;
+#endif
+                }
+
+                inline std::size_t count_leading_zeros(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+                    return static_cast<std::size_t>(__builtin_clzll(value));
+#else
+                    std::size_t count = 0U;
+                    while ((value & (static_cast<std::uint64_t>(1U) << 63U)) == 0U) {
+                        value <<= 1U;
+                        ++count;
+                    }
+                    return count;
+#endif
+                }
+
+                /// @brief Word level encoding / decoding of base-128 variable length values,
+                ///     serialized into at most 8 bytes.
+                /// @details The bytes are processed as a single 64 bit word, where the byte
+                ///     at offset N occupies bits [8N, 8N + 8). The terminating byte is located
+                ///     with count-trailing-zeros, the 7 bit groups are packed / unpacked with
+                ///     a fixed sequence of shift-and-mask operations.
+                /// @tparam TEndian Order of the 7 bit groups, little endian is standard LEB128.
+                template<typename TEndian>
+                struct var_length_word_access {
+                    static const std::size_t max_length = sizeof(std::uint64_t);
+
+                    /// @brief Number of bytes encoding the value, 0 if the terminating byte
+                    ///     is not within the word.
+                    static std::size_t encoded_length(std::uint64_t word) {
+                        std::uint64_t stopBits = (~word) & ContinueBits;
+                        if (stopBits == 0U) {
+                            return 0U;
+                        }
+
+                        return (count_trailing_zeros(stopBits) / 8U) + 1U;
+                    }
+
+                    /// @brief Number of 7 bit groups required to encode the value.
+                    static std::size_t groups_count(std::uint64_t value) {
+                        if (value == 0U) {
+                            return 0U;
+                        }
+
+                        std::size_t bits = 64U - count_leading_zeros(value);
+                        return (bits + 6U) / 7U;
+                    }
+
+                    /// @brief Decode the value from the first @b len bytes of the word.
+                    /// @pre 0 < len <= 8
+                    static std::uint64_t decode(std::uint64_t word, std::size_t len) {
+                        return compact(order_groups(word, len, TEndian()) & GroupBits);
+                    }
+
+                    /// @brief Encode the value into the first @b len bytes of the word.
+                    /// @pre 0 < len <= 8, the value fits into @b len groups.
+                    static std::uint64_t encode(std::uint64_t value, std::size_t len) {
+                        std::uint64_t continueMask = (static_cast<std::uint64_t>(1U) << (8U * (len - 1U))) - 1U;
+                        return order_groups(spread(value), len, TEndian()) | (ContinueBits & continueMask);
+                    }
+
+                    template<typename TByte>
+                    static std::uint64_t load(const TByte *iter) {
+                        std::uint64_t word;
+                        std::memcpy(&word, iter, sizeof(word));
+                        return boost::endian::little_to_native(word);
+                    }
+
+                    template<typename TByte>
+                    static void store(std::uint64_t word, std::size_t len, TByte *iter) {
+                        word = boost::endian::native_to_little(word);
+                        std::memcpy(iter, &word, len);
+                    }
+
+                private:
+                    static std::uint64_t order_groups(std::uint64_t word, std::size_t len, endian::little_endian) {
+                        static_cast<void>(len);
+                        return (len < max_length) ? (word & ((static_cast<std::uint64_t>(1U) << (8U * len)) - 1U))
+                                                  : word;
+                    }
+
+                    static std::uint64_t order_groups(std::uint64_t word, std::size_t len, endian::big_endian) {
+                        // The first byte holds the most significant group, reversing the
+                        // used bytes turns it into the little endian case.
+                        return boost::endian::endian_reverse(word) >> (8U * (max_length - len));
+                    }
+
+                    static std::uint64_t compact(std::uint64_t word) {
+                        word = (word & 0x007f007f007f007fULL) | ((word & 0x7f007f007f007f00ULL) >> 1U);
+                        word = (word & 0x00003fff00003fffULL) | ((word & 0x3fff00003fff0000ULL) >> 2U);
+                        word = (word & 0x000000000fffffffULL) | ((word & 0x0fffffff00000000ULL) >> 4U);
+                        return word;
+                    }
+
+                    static std::uint64_t spread(std::uint64_t value) {
+                        value = (value & 0x000000000fffffffULL) | ((value & 0x00fffffff0000000ULL) << 4U);
+                        value = (value & 0x00003fff00003fffULL) | ((value & 0x0fffc0000fffc000ULL) << 2U);
+                        value = (value & 0x007f007f007f007fULL) | ((value & 0x3f803f803f803f80ULL) << 1U);
+                        return value;
+                    }
+
+                    static const std::uint64_t ContinueBits = 0x8080808080808080ULL;
+                    static const std::uint64_t GroupBits = 0x7f7f7f7f7f7f7f7fULL;
+                };
+
+            }    // namespace detail
+        }        // namespace processing
+    }            // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_PROCESSING_VAR_LENGTH_ACCESS_DETAIL_HPP
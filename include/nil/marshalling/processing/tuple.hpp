@@ -579,66 +579,55 @@ namespace nil {
 
             namespace detail {
 
-                template<std::size_t TFromIdx, std::size_t TToIdx, std::size_t TCount>
-                class tuple_selected_type_helper {
-                    static_assert(TCount == (TToIdx - TFromIdx), "Internal error: Bad parameters");
-                    static_assert(TFromIdx < TToIdx, "Internal error: Bad parameters");
+                template<std::size_t... TIndices>
+                struct tuple_index_sequence { };
 
-                public:
-                    template<typename TTuple, typename TFunc>
-                    static void exec(std::size_t idx, TFunc &&func) {
-                        using Tuple = typename std::decay<TTuple>::type;
-                        static_assert(nil::detail::is_tuple<Tuple>::value, "TTuple must be std::tuple");
-                        static const std::size_t TupleSize = std::tuple_size<Tuple>::value;
-                        static_assert(TCount <= TupleSize, "Incorrect TCount");
-                        static_assert(0U < TCount, "Incorrect instantiation");
-
-                        MARSHALLING_ASSERT(TFromIdx <= idx);
-                        MARSHALLING_ASSERT(idx < TToIdx);
-                        if (idx == TFromIdx) {
-                            tuple_selected_type_helper<TFromIdx, TFromIdx + 1, 1U>::template exec<TTuple>(
-                                idx, std::forward<TFunc>(func));
-                            return;
-                        }
+                template<std::size_t TCount, std::size_t... TIndices>
+                struct tuple_make_index_sequence
+                    : public tuple_make_index_sequence<TCount - 1, TCount - 1, TIndices...> { };
 
-                        static const std::size_t MidIdx = TFromIdx + TCount / 2;
-                        static_assert(MidIdx < TToIdx, "Internal error: bad calculation");
-                        static_assert(TFromIdx <= MidIdx, "Internal error: bad calculation");
-                        if (MidIdx <= idx) {
-                            tuple_selected_type_helper<MidIdx, TToIdx, TToIdx - MidIdx>::template exec<TTuple>(
-                                idx, std::forward<TFunc>(func));
-                            return;
-                        }
-
-                        tuple_selected_type_helper<TFromIdx, MidIdx, MidIdx - TFromIdx>::template exec<TTuple>(
-                            idx, std::forward<TFunc>(func));
-                    }
+                template<std::size_t... TIndices>
+                struct tuple_make_index_sequence<0U, TIndices...> {
+                    using type = tuple_index_sequence<TIndices...>;
                 };
 
-                template<std::size_t TFromIdx, std::size_t TToIdx>
-                class tuple_selected_type_helper<TFromIdx, TToIdx, 1U> {
-                    static_assert((TFromIdx + 1) == TToIdx, "Internal error: Bad parameters");
+                template<typename TTuple, typename TFunc, typename TIndices>
+                class tuple_selected_type_dispatcher;
 
-                public:
-                    template<typename TTuple, typename TFunc>
-                    static void exec(std::size_t idx, TFunc &&func) {
-                        static_cast<void>(idx);
-                        MARSHALLING_ASSERT(idx == TFromIdx);
-                        using ElemType = typename std::tuple_element<TFromIdx, TTuple>::type;
+                template<typename TTuple, typename TFunc, std::size_t... TIndices>
+                class tuple_selected_type_dispatcher<TTuple, TFunc, tuple_index_sequence<TIndices...>> {
+                    using invoker_type = void (*)(TFunc &);
+
+                    template<std::size_t TIdx>
+                    static void invoke(TFunc &func) {
+                        using ElemType = typename std::tuple_element<TIdx, TTuple>::type;
 #ifdef _MSC_VER
                         // VS compiler
-                        func.operator()<TFromIdx, ElemType>();
+                        func.operator()<TIdx, ElemType>();
 #else     // #ifdef _MSC_VER
-                        func.template operator()<TFromIdx, ElemType>();
+                        func.template operator()<TIdx, ElemType>();
 #endif    // #ifdef _MSC_VER
                     }
+
+                public:
+                    static void exec(std::size_t idx, TFunc &func) {
+                        static const invoker_type Invokers[] = {&invoke<TIndices>...};
+                        MARSHALLING_ASSERT(idx < sizeof...(TIndices));
+                        if (sizeof...(TIndices) <= idx) {
+                            return;
+                        }
+
+                        Invokers[idx](func);
+                    }
                 };
 
             }    // namespace detail
 
             /// @brief Invoke provided functor for a selected type when element index
             ///     is known only at run time.
-            /// @details The functor object class must define operator() with following signature:
+            /// @details The selection is performed with a single indirect call through the
+            ///     table of per-element invokers regardless of the tuple size.
+            ///     The functor object class must define operator() with following signature:
             ///     @code
             ///     struct MyFunc
             ///     {
@@ -657,8 +646,9 @@ namespace nil {
                 static const std::size_t TupleSize = std::tuple_size<Tuple>::value;
                 static_assert(0U < TupleSize, "Empty tuples are not supported");
 
-                detail::tuple_selected_type_helper<0, TupleSize, TupleSize>::template exec<Tuple>(
-                    idx, std::forward<TFunc>(func));
+                using FuncType = typename std::remove_reference<TFunc>::type;
+                using Indices = typename detail::tuple_make_index_sequence<TupleSize>::type;
+                detail::tuple_selected_type_dispatcher<Tuple, FuncType, Indices>::exec(idx, func);
             }
             //----------------------------------------
 
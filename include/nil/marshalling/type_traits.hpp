@@ -251,6 +251,21 @@ namespace nil {
             constexpr static const bool value = !std::is_same<no, decltype(test<T>(nullptr))>::value;
         };
 
+        template<typename T>
+        class has_member_function_data {
+            struct no { };
+
+        protected:
+            template<typename C>
+            static auto test(std::nullptr_t) -> decltype(std::declval<C>().data());
+
+            template<typename>
+            static no test(...);
+
+        public:
+            constexpr static const bool value = !std::is_same<no, decltype(test<T>(nullptr))>::value;
+        };
+
         template<typename T>
         class has_member_function_remove_suffix {
         protected:
@@ -26,8 +26,14 @@
 #ifndef MARSHALLING_IGNORE_INVALID_HPP
 #define MARSHALLING_IGNORE_INVALID_HPP
 
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include <nil/marshalling/assert_type.hpp>
 #include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/type_traits.hpp>
 
 namespace nil {
     namespace marshalling {
@@ -59,6 +65,36 @@ namespace nil {
 
                     template<typename TIter>
                     status_type read(TIter &iter, std::size_t len) {
+                        return read_internal(iter, len, read_tag());
+                    }
+
+                    template<typename TIter>
+                    void read_no_status(TIter &iter) {
+                        read_no_status_internal(iter, read_tag());
+                    }
+
+                private:
+                    struct spare_tag { };
+                    struct in_place_tag { };
+                    struct copy_tag { };
+
+                    template<typename T>
+                    struct is_heap_vector : public std::false_type { };
+
+                    template<typename T>
+                    struct is_heap_vector<std::vector<T, std::allocator<T>>> : public std::true_type { };
+
+                    // Heap allocated vectors are decoded into the spare storage, which is swapped
+                    // with the current one in constant time, so the capacity of both is kept.
+                    // Other sequences are decoded in place when empty, the emptiness is all there
+                    // is to restore. The rest is validated in the temporary copy before committing.
+                    using read_tag = typename std::conditional<
+                        is_heap_vector<value_type>::value, spare_tag,
+                        typename std::conditional<has_member_function_clear<value_type>::value, in_place_tag,
+                                                  copy_tag>::type>::type;
+
+                    template<typename TIter>
+                    status_type read_internal(TIter &iter, std::size_t len, copy_tag) {
                         base_impl_type tmp;
                         status_type es = tmp.read(iter, len);
                         if (es != status_type::success) {
@@ -73,7 +109,33 @@ namespace nil {
                     }
 
                     template<typename TIter>
-                    void read_no_status(TIter &iter) {
+                    status_type read_internal(TIter &iter, std::size_t len, in_place_tag) {
+                        if (!base_impl_type::value().empty()) {
+                            return read_internal(iter, len, copy_tag());
+                        }
+
+                        status_type es = base_impl_type::read(iter, len);
+                        if ((es != status_type::success) || (!base_impl_type::valid())) {
+                            base_impl_type::value().clear();
+                        }
+
+                        return es;
+                    }
+
+                    template<typename TIter>
+                    status_type read_internal(TIter &iter, std::size_t len, spare_tag) {
+                        std::swap(spare_.value_, base_impl_type::value());
+                        status_type es = base_impl_type::read(iter, len);
+                        if ((es != status_type::success) || (!base_impl_type::valid())) {
+                            std::swap(spare_.value_, base_impl_type::value());
+                        }
+
+                        spare_.value_.clear();
+                        return es;
+                    }
+
+                    template<typename TIter>
+                    void read_no_status_internal(TIter &iter, copy_tag) {
                         base_impl_type tmp;
                         tmp.read_no_status(iter);
 
@@ -81,6 +143,50 @@ namespace nil {
                             static_cast<base_impl_type &>(*this) = std::move(tmp);
                         }
                     }
+
+                    template<typename TIter>
+                    void read_no_status_internal(TIter &iter, in_place_tag) {
+                        if (!base_impl_type::value().empty()) {
+                            read_no_status_internal(iter, copy_tag());
+                            return;
+                        }
+
+                        base_impl_type::read_no_status(iter);
+                        if (!base_impl_type::valid()) {
+                            base_impl_type::value().clear();
+                        }
+                    }
+
+                    template<typename TIter>
+                    void read_no_status_internal(TIter &iter, spare_tag) {
+                        std::swap(spare_.value_, base_impl_type::value());
+                        base_impl_type::read_no_status(iter);
+                        if (!base_impl_type::valid()) {
+                            std::swap(spare_.value_, base_impl_type::value());
+                        }
+
+                        spare_.value_.clear();
+                    }
+
+                    // Empty between the reads, only its capacity is kept. It isn't part
+                    // of the field value, it is neither copied nor moved together with the field.
+                    struct spare_storage {
+                        spare_storage() = default;
+
+                        spare_storage(const spare_storage &) {
+                        }
+
+                        spare_storage &operator=(const spare_storage &) {
+                            return *this;
+                        }
+
+                        value_type value_;
+                    };
+
+                    struct no_spare_storage { };
+
+                    typename std::conditional<std::is_same<read_tag, spare_tag>::value, spare_storage,
+                                              no_spare_storage>::type spare_;
                 };
 
             }    // namespace adapter
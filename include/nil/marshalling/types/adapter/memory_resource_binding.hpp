@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_MEMORY_RESOURCE_BINDING_HPP
+#define MARSHALLING_MEMORY_RESOURCE_BINDING_HPP
+
+#include <utility>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/container/memory_resource.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace types {
+            namespace adapter {
+
+                template<typename TBase>
+                class memory_resource_binding : public TBase {
+                    using base_impl_type = TBase;
+
+                public:
+                    using value_type = typename base_impl_type::value_type;
+
+                    memory_resource_binding() = default;
+
+                    explicit memory_resource_binding(const value_type &val) : base_impl_type(val) {
+                    }
+
+                    explicit memory_resource_binding(value_type &&val) : base_impl_type(std::move(val)) {
+                    }
+
+                    memory_resource_binding(const memory_resource_binding &) = default;
+
+                    memory_resource_binding(memory_resource_binding &&) = default;
+
+                    memory_resource_binding &operator=(const memory_resource_binding &) = default;
+
+                    memory_resource_binding &operator=(memory_resource_binding &&) = default;
+
+                    template<typename TIter>
+                    status_type read(TIter &iter, std::size_t len) {
+                        bind_resource();
+                        return base_impl_type::read(iter, len);
+                    }
+
+                    template<typename TIter>
+                    void read_no_status(TIter &iter) {
+                        bind_resource();
+                        base_impl_type::read_no_status(iter);
+                    }
+
+                private:
+                    // The storage is re-created from the resource selected for the current thread,
+                    // so the decoded value never mixes storages of different resources.
+                    void bind_resource() {
+                        auto *resource = container::memory_resource_scope::current();
+                        auto &storage = base_impl_type::value();
+                        if (storage.get_allocator().resource() != resource) {
+                            using allocator_type = typename value_type::allocator_type;
+                            storage = value_type(allocator_type(resource));
+                        }
+                    }
+                };
+
+            }    // namespace adapter
+        }        // namespace types
+    }            // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_MEMORY_RESOURCE_BINDING_HPP
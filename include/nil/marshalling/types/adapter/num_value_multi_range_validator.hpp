@@ -28,7 +28,7 @@
 
 #include <nil/detail/type_traits.hpp>
 
-#include <nil/marshalling/processing/tuple.hpp>
+#include <nil/marshalling/types/detail/num_value_range_table.hpp>
 
 namespace nil {
     namespace marshalling {
@@ -65,34 +65,11 @@ namespace nil {
                     num_value_multi_range_validator &operator=(num_value_multi_range_validator &&) = default;
 
                     bool valid() const {
-                        return base_impl_type::valid()
-                               && processing::tuple_type_accumulate<TRanges>(
-                                   false, Validator(base_impl_type::value()));
+                        return base_impl_type::valid() && table_type::contains(base_impl_type::value());
                     }
 
                 private:
-                    class Validator {
-                    public:
-                        Validator(value_type val) : m_val(val) {
-                        }
-
-                        template<typename TRange>
-                        bool operator()(bool val) const {
-                            static_cast<void>(val);
-                            static_assert(nil::detail::is_tuple<TRange>::value,
-                                          "TRange must be a tuple");
-                            static_assert(std::tuple_size<TRange>::value == 2, "Tuple with 2 elements is expected");
-                            using MinVal = typename std::tuple_element<0, TRange>::type;
-                            using MaxVal = typename std::tuple_element<1, TRange>::type;
-                            static_assert(MinVal::value <= MaxVal::value, "Invalid range");
-                            return val
-                                   || ((static_cast<value_type>(MinVal::value) <= m_val)
-                                       && (m_val <= static_cast<value_type>(MaxVal::value)));
-                        }
-
-                    private:
-                        value_type m_val;
-                    };
+                    using table_type = types::detail::num_value_range_table<value_type, TRanges>;
                 };
 
             }    // namespace adapter
@@ -0,0 +1,324 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_SEQUENCE_GROUP_VARINT_HPP
+#define MARSHALLING_SEQUENCE_GROUP_VARINT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/marshalling/assert_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/type_traits.hpp>
+#include <nil/marshalling/processing/access.hpp>
+#include <nil/marshalling/processing/detail/group_varint_access.hpp>
+#include <nil/marshalling/processing/detail/var_length_access.hpp>
+#include <nil/marshalling/types/array_list/type_traits.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace types {
+            namespace adapter {
+
+                template<typename TBase>
+                class sequence_group_varint : public TBase {
+                    using base_impl_type = TBase;
+
+                public:
+                    using value_type = typename base_impl_type::value_type;
+                    using element_type = typename base_impl_type::element_type;
+                    using endian_type = typename base_impl_type::endian_type;
+
+                    static_assert(std::is_integral<element_type>::value && std::is_unsigned<element_type>::value
+                                      && (!std::is_same<element_type, bool>::value)
+                                      && (sizeof(element_type) <= sizeof(std::uint32_t)),
+                                  "Group varint encoding is applicable only to lists of unsigned integral values "
+                                  "not longer than 4 bytes");
+
+                    sequence_group_varint() = default;
+
+                    explicit sequence_group_varint(const value_type &val) : base_impl_type(val) {
+                    }
+
+                    explicit sequence_group_varint(value_type &&val) : base_impl_type(std::move(val)) {
+                    }
+
+                    sequence_group_varint(const sequence_group_varint &) = default;
+
+                    sequence_group_varint(sequence_group_varint &&) = default;
+
+                    sequence_group_varint &operator=(const sequence_group_varint &) = default;
+
+                    sequence_group_varint &operator=(sequence_group_varint &&) = default;
+
+                    std::size_t length() const {
+                        auto &storage = base_impl_type::value();
+                        std::size_t result = ctrl_length(storage.size());
+                        for (auto &elem : storage) {
+                            result += element_length(elem);
+                        }
+                        return result;
+                    }
+
+                    static constexpr std::size_t min_length() {
+                        return 0U;
+                    }
+
+                    static constexpr std::size_t max_length() {
+                        return base_impl_type::max_length() + ctrl_length(max_count);
+                    }
+
+                    static std::size_t element_length(const element_type &elem) {
+                        if (elem == 0U) {
+                            return 1U;
+                        }
+
+                        auto bits = 64U - processing::detail::count_leading_zeros(static_cast<std::uint64_t>(elem));
+                        return (bits + 7U) / 8U;
+                    }
+
+                    template<typename TIter>
+                    status_type read(TIter &iter, std::size_t len) = delete;
+
+                    template<typename TIter>
+                    void read_no_status(TIter &iter) = delete;
+
+                    template<typename TIter>
+                    status_type read_n(std::size_t count, TIter &iter, std::size_t &len) {
+                        base_impl_type::value().clear();
+                        // Every value occupies at least one byte, reject the count before
+                        // the storage is resized to hold it.
+                        if (len < (ctrl_length(count) + count)) {
+                            return status_type::not_enough_data;
+                        }
+
+                        return read_n_internal(count, iter, len, read_tag<TIter>());
+                    }
+
+                    template<typename TIter>
+                    void read_no_status_n(std::size_t count, TIter &iter) {
+                        auto &storage = base_impl_type::value();
+                        storage.clear();
+                        for (std::size_t idx = 0U; idx < count; idx += group_size) {
+                            auto ctrl = processing::read_data<std::uint8_t>(iter, endian_type());
+                            auto groupCount = std::min(group_size, count - idx);
+                            for (std::size_t groupIdx = 0U; groupIdx < groupCount; ++groupIdx) {
+                                storage.push_back(read_value(access_type::value_length(ctrl, groupIdx), iter));
+                            }
+                        }
+                    }
+
+                    template<typename TIter>
+                    status_type write(TIter &iter, std::size_t len) const {
+                        if (len < length()) {
+                            return status_type::buffer_overflow;
+                        }
+
+                        write_no_status(iter);
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    void write_no_status(TIter &iter) const {
+                        auto &storage = base_impl_type::value();
+                        auto elemIter = storage.begin();
+                        std::size_t count = storage.size();
+                        for (std::size_t idx = 0U; idx < count; idx += group_size) {
+                            auto groupCount = std::min(group_size, count - idx);
+                            std::size_t lengths[group_size] = {0U};
+                            std::uint8_t ctrl = 0U;
+                            auto groupIter = elemIter;
+                            for (std::size_t groupIdx = 0U; groupIdx < groupCount; ++groupIdx, ++groupIter) {
+                                lengths[groupIdx] = element_length(*groupIter);
+                                ctrl = static_cast<std::uint8_t>(ctrl | ((lengths[groupIdx] - 1U) << (2U * groupIdx)));
+                            }
+
+                            processing::write_data(ctrl, iter, endian_type());
+                            for (std::size_t groupIdx = 0U; groupIdx < groupCount; ++groupIdx, ++elemIter) {
+                                write_value(*elemIter, lengths[groupIdx], iter);
+                            }
+                        }
+                    }
+
+                private:
+                    struct block_read_tag { };
+                    struct generic_read_tag { };
+
+                    using access_type = processing::detail::group_varint_access<endian_type>;
+
+                    static const std::size_t group_size = access_type::group_size;
+                    static const std::size_t max_count = types::detail::array_list_max_length_retrieve_helper<
+                        value_type>::value;
+
+                    template<typename TIter>
+                    using read_tag = typename std::conditional<
+                        (sizeof(element_type) == sizeof(std::uint32_t))
+                            && processing::detail::is_contiguous_byte_access<endian_type, TIter>::value
+                            && has_member_function_data<value_type>::value
+                            && has_member_function_resize<value_type>::value,
+                        block_read_tag,
+                        generic_read_tag>::type;
+
+                    static constexpr std::size_t ctrl_length(std::size_t count) {
+                        return (count + (group_size - 1U)) / group_size;
+                    }
+
+                    template<typename TIter>
+                    status_type read_n_internal(std::size_t count, TIter &iter, std::size_t &len, generic_read_tag) {
+                        auto &storage = base_impl_type::value();
+                        for (std::size_t idx = 0U; idx < count; idx += group_size) {
+                            if (len < 1U) {
+                                return status_type::not_enough_data;
+                            }
+
+                            auto ctrl = processing::read_data<std::uint8_t>(iter, endian_type());
+                            --len;
+
+                            auto groupCount = std::min(group_size, count - idx);
+                            for (std::size_t groupIdx = 0U; groupIdx < groupCount; ++groupIdx) {
+                                element_type elem = 0U;
+                                auto es = read_element(ctrl, groupIdx, elem, iter, len);
+                                if (es != status_type::success) {
+                                    return es;
+                                }
+                                storage.push_back(elem);
+                            }
+                        }
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    status_type read_n_internal(std::size_t count, TIter &iter, std::size_t &len, block_read_tag) {
+                        auto &storage = base_impl_type::value();
+                        storage.resize(count);
+                        auto *out = reinterpret_cast<std::uint32_t *>(storage.data());
+
+                        std::size_t idx = 0U;
+                        // Decoding of the full group may access up to 16 data bytes regardless of
+                        // the actual group length, which must not cross the end of the input area.
+                        while ((group_size <= (count - idx)) && (access_type::max_group_data_length < len)) {
+                            auto ctrl = static_cast<std::uint8_t>(*iter);
+                            auto consumed = 1U
+                                            + access_type::decode(
+                                                ctrl, reinterpret_cast<const std::uint8_t *>(&iter[1]), &out[idx]);
+                            iter += consumed;
+                            len -= consumed;
+                            idx += group_size;
+                        }
+
+                        for (; idx < count; idx += group_size) {
+                            if (len < 1U) {
+                                storage.resize(idx);
+                                return status_type::not_enough_data;
+                            }
+
+                            auto ctrl = processing::read_data<std::uint8_t>(iter, endian_type());
+                            --len;
+
+                            auto groupCount = std::min(group_size, count - idx);
+                            for (std::size_t groupIdx = 0U; groupIdx < groupCount; ++groupIdx) {
+                                auto es = read_element(ctrl, groupIdx, storage[idx + groupIdx], iter, len);
+                                if (es != status_type::success) {
+                                    storage.resize(idx + groupIdx);
+                                    return es;
+                                }
+                            }
+                        }
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    static status_type read_element(std::uint8_t ctrl, std::size_t groupIdx, element_type &elem,
+                                                    TIter &iter, std::size_t &len) {
+                        auto elemLen = access_type::value_length(ctrl, groupIdx);
+                        if (sizeof(element_type) < elemLen) {
+                            return status_type::protocol_error;
+                        }
+
+                        if (len < elemLen) {
+                            return status_type::not_enough_data;
+                        }
+
+                        elem = read_value(elemLen, iter);
+                        len -= elemLen;
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    static element_type read_value(std::size_t elemLen, TIter &iter) {
+                        switch (elemLen) {
+                            case 1U:
+                                return static_cast<element_type>(
+                                    processing::read_data<std::uint32_t, 1U>(iter, endian_type()));
+                            case 2U:
+                                return static_cast<element_type>(
+                                    processing::read_data<std::uint32_t, 2U>(iter, endian_type()));
+                            case 3U:
+                                return static_cast<element_type>(
+                                    processing::read_data<std::uint32_t, 3U>(iter, endian_type()));
+                            default:
+                                break;
+                        }
+
+                        MARSHALLING_ASSERT(elemLen == 4U);
+                        return static_cast<element_type>(
+                            processing::read_data<std::uint32_t, 4U>(iter, endian_type()));
+                    }
+
+                    template<typename TIter>
+                    static void write_value(element_type elem, std::size_t elemLen, TIter &iter) {
+                        auto value = static_cast<std::uint32_t>(elem);
+                        switch (elemLen) {
+                            case 1U:
+                                processing::write_data<1U>(value, iter, endian_type());
+                                return;
+                            case 2U:
+                                processing::write_data<2U>(value, iter, endian_type());
+                                return;
+                            case 3U:
+                                processing::write_data<3U>(value, iter, endian_type());
+                                return;
+                            default:
+                                break;
+                        }
+
+                        MARSHALLING_ASSERT(elemLen == 4U);
+                        processing::write_data<4U>(value, iter, endian_type());
+                    }
+                };
+
+                template<typename TBase>
+                const std::size_t sequence_group_varint<TBase>::group_size;
+
+                template<typename TBase>
+                const std::size_t sequence_group_varint<TBase>::max_count;
+
+            }    // namespace adapter
+        }        // namespace types
+    }            // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_SEQUENCE_GROUP_VARINT_HPP
@@ -26,8 +26,18 @@
 #ifndef MARSHALLING_SEQUENCE_TERMINATION_FIELD_SUFFIX_HPP
 #define MARSHALLING_SEQUENCE_TERMINATION_FIELD_SUFFIX_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
 #include <nil/marshalling/assert_type.hpp>
 #include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/processing/detail/access.hpp>
+#include <nil/marshalling/types/tag.hpp>
+#include <nil/marshalling/types/bundle/type_traits.hpp>
 
 namespace nil {
     namespace marshalling {
@@ -82,13 +92,13 @@ namespace nil {
                                       "Only random access iterator for reading is supported with "
                                       "nil::marshalling::option::sequence_termination_field_suffix option");
 
-                        using elem_tag =
+                        using elem_read_tag =
                             typename std::conditional<std::is_integral<element_type>::value
                                                           && (sizeof(element_type) == sizeof(std::uint8_t)),
                                                       raw_data_tag,
                                                       field_tag>::type;
 
-                        return read_internal(iter, len, elem_tag());
+                        return read_internal(iter, len, elem_read_tag());
                     }
 
                     template<typename TIter>
@@ -117,20 +127,142 @@ namespace nil {
                     struct raw_data_tag { };
                     struct field_tag { };
 
+                    /// @brief Detection of the terminator by reading the termination field.
+                    class field_term_matcher {
+                    public:
+                        template<typename TIter>
+                        bool match(TIter iter, std::size_t len) const {
+                            term_field_type termField;
+                            status_type es = termField.read(iter, len);
+                            return (es == status_type::success) && (termField == term_field_type());
+                        }
+
+                        template<typename TIter>
+                        bool find(TIter iter, std::size_t len, std::size_t &consumed) const {
+                            for (consumed = 0U; consumed < len; ++consumed) {
+                                if (match(iter + consumed, len - consumed)) {
+                                    return true;
+                                }
+                            }
+                            return false;
+                        }
+                    };
+
+                    /// @brief Detection of the terminator by comparing the input with the
+                    ///     serialized default value of the termination field.
+                    /// @details Applicable to fixed length integral values, which have single
+                    ///     serialized form for every value.
+                    class pattern_term_matcher {
+                    public:
+                        pattern_term_matcher() {
+                            term_field_type termField;
+                            std::uint8_t *writeIter = &pattern_[0];
+                            termField.write_no_status(writeIter);
+
+                            // The default value may be not representable by the serialized one
+                            term_field_type readField;
+                            const std::uint8_t *readIter = &pattern_[0];
+                            readField.read_no_status(readIter);
+                            valid_ = (readField == termField);
+                        }
+
+                        template<typename TIter>
+                        bool match(TIter iter, std::size_t len) const {
+                            if ((!valid_) || (len < pattern_length)) {
+                                return false;
+                            }
+
+                            for (std::size_t idx = 0U; idx < pattern_length; ++idx, ++iter) {
+                                if (static_cast<std::uint8_t>(*iter) != pattern_[idx]) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
+
+                        template<typename TIter>
+                        bool find(TIter iter, std::size_t len, std::size_t &consumed) const {
+                            if ((!valid_) || (len < pattern_length)) {
+                                return false;
+                            }
+
+                            using tag = typename std::conditional<
+                                processing::detail::is_contiguous_byte_access<typename term_field_type::endian_type,
+                                                                              TIter>::value,
+                                contiguous_tag,
+                                generic_tag>::type;
+                            return find_internal(iter, len, consumed, tag());
+                        }
+
+                    private:
+                        struct contiguous_tag { };
+                        struct generic_tag { };
+
+                        static const std::size_t pattern_length = term_field_type::max_length();
+
+                        template<typename TIter>
+                        bool find_internal(TIter iter, std::size_t len, std::size_t &consumed, contiguous_tag) const {
+                            auto *begin = reinterpret_cast<const std::uint8_t *>(iter);
+                            auto *end = begin + len;
+                            auto *pos = begin;
+                            while (pattern_length <= static_cast<std::size_t>(end - pos)) {
+                                auto *found = static_cast<const std::uint8_t *>(std::memchr(
+                                    pos, pattern_[0], static_cast<std::size_t>(end - pos) - (pattern_length - 1U)));
+                                if (found == nullptr) {
+                                    return false;
+                                }
+
+                                if (std::memcmp(found + 1, &pattern_[1], pattern_length - 1U) == 0) {
+                                    consumed = static_cast<std::size_t>(found - begin);
+                                    return true;
+                                }
+
+                                pos = found + 1;
+                            }
+                            return false;
+                        }
+
+                        template<typename TIter>
+                        bool find_internal(TIter iter, std::size_t len, std::size_t &consumed, generic_tag) const {
+                            using byte_type = typename std::iterator_traits<TIter>::value_type;
+                            auto end = iter + len;
+                            auto found = std::search(iter, end, &pattern_[0], &pattern_[0] + pattern_length,
+                                                     [](const byte_type &byte, std::uint8_t patternByte) {
+                                                         return static_cast<std::uint8_t>(byte) == patternByte;
+                                                     });
+                            if (found == end) {
+                                return false;
+                            }
+
+                            consumed = static_cast<std::size_t>(std::distance(iter, found));
+                            return true;
+                        }
+
+                        std::uint8_t pattern_[pattern_length];
+                        bool valid_ = false;
+                    };
+
+                    using term_tag = typename term_field_type::tag;
+
+                    using term_matcher_type = typename std::conditional<
+                        (std::is_same<term_tag, types::tag::integral>::value
+                         || std::is_same<term_tag, types::tag::enumeration>::value)
+                            && types::detail::is_fixed_layout_field<term_field_type>::value,
+                        pattern_term_matcher,
+                        field_term_matcher>::type;
+
                     template<typename TIter>
                     status_type read_internal(TIter &iter, std::size_t len, field_tag) {
                         base_impl_type::clear();
-                        term_field_type termField;
+                        term_matcher_type matcher;
                         while (true) {
-                            auto iterCpy = iter;
-                            status_type es = termField.read(iterCpy, len);
-                            if ((es == status_type::success) && (termField == term_field_type())) {
-                                std::advance(iter, termField.length());
-                                return es;
+                            if (matcher.match(iter, len)) {
+                                std::advance(iter, term_field_type().length());
+                                return status_type::success;
                             }
 
                             auto &elem = base_impl_type::create_back();
-                            es = base_impl_type::read_element(elem, iter, len);
+                            status_type es = base_impl_type::read_element(elem, iter, len);
                             if (es != status_type::success) {
                                 base_impl_type::value().pop_back();
                                 return es;
@@ -142,19 +274,8 @@ namespace nil {
 
                     template<typename TIter>
                     status_type read_internal(TIter &iter, std::size_t len, raw_data_tag) {
-                        term_field_type termField;
                         std::size_t consumed = 0;
-                        while (consumed < len) {
-                            auto iterCpy = iter + consumed;
-                            status_type es = termField.read(iterCpy, len);
-                            if ((es == status_type::success) && (termField == term_field_type())) {
-                                break;
-                            }
-
-                            ++consumed;
-                        }
-
-                        if (len <= consumed) {
+                        if (!term_matcher_type().find(iter, len, consumed)) {
                             return status_type::not_enough_data;
                         }
 
@@ -163,7 +284,7 @@ namespace nil {
                             return es;
                         }
 
-                        std::advance(iter, termField.length());
+                        std::advance(iter, term_field_type().length());
                         return status_type::success;
                     }
                 };
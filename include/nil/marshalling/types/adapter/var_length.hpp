@@ -34,6 +34,7 @@
 #include <nil/marshalling/assert_type.hpp>
 #include <nil/marshalling/processing/size_to_type.hpp>
 #include <nil/marshalling/processing/access.hpp>
+#include <nil/marshalling/processing/detail/var_length_access.hpp>
 #include <nil/marshalling/status_type.hpp>
 
 namespace nil {
@@ -78,11 +79,7 @@ namespace nil {
                     std::size_t length() const {
                         auto serValue
                             = adjust_to_unsigned_serialized_var_length(to_serialized(base_impl_type::value()));
-                        std::size_t len = 0U;
-                        while (0 < serValue) {
-                            serValue >>= var_length_shift;
-                            ++len;
-                        }
+                        std::size_t len = word_access_type::groups_count(serValue);
 
                         MARSHALLING_ASSERT(len <= max_length());
                         return std::max(std::size_t(min_length_), len);
@@ -110,6 +107,56 @@ namespace nil {
 
                     template<typename TIter>
                     status_type read(TIter &iter, std::size_t size) {
+                        return read_internal(iter, size, access_tag<TIter>());
+                    }
+
+                    template<typename TIter>
+                    void read_no_status(TIter &iter) = delete;
+
+                    template<typename TIter>
+                    status_type write(TIter &iter, std::size_t size) const {
+                        return write_internal(iter, size, access_tag<TIter>());
+                    }
+
+                    template<typename TIter>
+                    void write_no_status(TIter &iter) const {
+                        write_no_status_internal(iter, access_tag<TIter>());
+                    }
+
+                private:
+                    struct contiguous_access_tag { };
+                    struct generic_access_tag { };
+
+                    using word_access_type = processing::detail::var_length_word_access<endian_type>;
+
+                    template<typename TIter>
+                    using access_tag = typename std::conditional<
+                        processing::detail::is_contiguous_byte_access<endian_type, TIter>::value,
+                        contiguous_access_tag,
+                        generic_access_tag>::type;
+
+                    template<typename TIter>
+                    status_type read_internal(TIter &iter, std::size_t size, contiguous_access_tag) {
+                        if (size < word_access_type::max_length) {
+                            return read_internal(iter, size, generic_access_tag());
+                        }
+
+                        auto word = word_access_type::load(iter);
+                        auto byteCount = word_access_type::encoded_length(word);
+                        if ((byteCount == 0U) || (max_length_ < byteCount) || (byteCount < min_length())) {
+                            return status_type::protocol_error;
+                        }
+
+                        auto val = static_cast<unsigned_serialized_type>(word_access_type::decode(word, byteCount));
+                        iter += byteCount;
+
+                        auto adjustedValue = sign_ext_unsigned_serialized(val, byteCount, has_sign_tag());
+                        base_impl_type::value() = base_impl_type::from_serialized(adjustedValue);
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    status_type read_internal(TIter &iter, std::size_t size, generic_access_tag) {
                         unsigned_serialized_type val = 0;
                         std::size_t byteCount = 0;
                         while (true) {
@@ -144,10 +191,20 @@ namespace nil {
                     }
 
                     template<typename TIter>
-                    void read_no_status(TIter &iter) = delete;
+                    status_type write_internal(TIter &iter, std::size_t size, contiguous_access_tag) const {
+                        auto val = adjust_to_unsigned_serialized_var_length(
+                            base_impl_type::to_serialized(base_impl_type::value()));
+                        auto len = std::max(std::size_t(min_length_), word_access_type::groups_count(val));
+                        if (size < len) {
+                            return status_type::buffer_overflow;
+                        }
+
+                        write_word(val, len, iter);
+                        return status_type::success;
+                    }
 
                     template<typename TIter>
-                    status_type write(TIter &iter, std::size_t size) const {
+                    status_type write_internal(TIter &iter, std::size_t size, generic_access_tag) const {
                         auto val = adjust_to_unsigned_serialized_var_length(
                             base_impl_type::to_serialized(base_impl_type::value()));
                         std::size_t byteCount = 0;
@@ -174,7 +231,14 @@ namespace nil {
                     }
 
                     template<typename TIter>
-                    void write_no_status(TIter &iter) const {
+                    void write_no_status_internal(TIter &iter, contiguous_access_tag) const {
+                        auto val = adjust_to_unsigned_serialized_var_length(
+                            base_impl_type::to_serialized(base_impl_type::value()));
+                        write_word(val, std::max(std::size_t(min_length_), word_access_type::groups_count(val)), iter);
+                    }
+
+                    template<typename TIter>
+                    void write_no_status_internal(TIter &iter, generic_access_tag) const {
                         auto val = adjust_to_unsigned_serialized_var_length(
                             base_impl_type::to_serialized(base_impl_type::value()));
                         std::size_t byteCount = 0;
@@ -194,7 +258,6 @@ namespace nil {
                         }
                     }
 
-                private:
                     struct unsigned_tag { };
                     struct signed_tag { };
 
@@ -203,6 +266,13 @@ namespace nil {
 
                     using unsigned_serialized_type = typename std::make_unsigned<serialized_type>::type;
 
+                    template<typename TIter>
+                    static void write_word(unsigned_serialized_type val, std::size_t len, TIter &iter) {
+                        MARSHALLING_ASSERT(len <= max_length());
+                        word_access_type::store(word_access_type::encode(val, len), len, iter);
+                        iter += len;
+                    }
+
                     static unsigned_serialized_type adjust_to_unsigned_serialized_var_length(serialized_type val) {
                         static_assert(max_length_ <= sizeof(unsigned_serialized_type),
                                       "max_length is expected to be shorter than size of serialized type.");
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_VARIANT_KEY_DISPATCH_HPP
+#define MARSHALLING_VARIANT_KEY_DISPATCH_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/processing/tuple.hpp>
+#include <nil/marshalling/types/detail/variant_key_table.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace types {
+            namespace adapter {
+
+                template<typename TKeyField, typename TBase>
+                class variant_key_dispatch : public TBase {
+                    using base_impl_type = TBase;
+
+                public:
+                    using value_type = typename base_impl_type::value_type;
+                    using members_type = typename base_impl_type::members_type;
+
+                    variant_key_dispatch() = default;
+
+                    explicit variant_key_dispatch(const value_type &val) : base_impl_type(val) {
+                    }
+
+                    explicit variant_key_dispatch(value_type &&val) : base_impl_type(std::move(val)) {
+                    }
+
+                    variant_key_dispatch(const variant_key_dispatch &) = default;
+
+                    variant_key_dispatch(variant_key_dispatch &&) = default;
+
+                    variant_key_dispatch &operator=(const variant_key_dispatch &) = default;
+
+                    variant_key_dispatch &operator=(variant_key_dispatch &&) = default;
+
+                    template<typename TIter>
+                    status_type read(TIter &iter, std::size_t len) {
+                        key_field_type key;
+                        TIter keyIter = iter;
+                        status_type es = key.read(keyIter, len);
+                        if (es != status_type::success) {
+                            base_impl_type::reset();
+                            return es;
+                        }
+
+                        std::size_t idx = key_table::find(key.value());
+                        if (members_count <= idx) {
+                            return base_impl_type::read(iter, len);
+                        }
+
+                        es = status_type::error_status_amount;
+                        processing::tuple_for_selected_type<members_type>(idx,
+                                                                          read_helper<TIter>(*this, es, iter, len));
+                        return es;
+                    }
+
+                    template<typename TIter>
+                    void read_no_status(TIter &iter) = delete;
+
+                private:
+                    using key_field_type = TKeyField;
+                    using key_table = detail::variant_key_table<key_field_type, members_type>;
+
+                    static const std::size_t members_count = std::tuple_size<members_type>::value;
+
+                    template<typename TIter>
+                    class read_helper {
+                    public:
+                        read_helper(variant_key_dispatch &field, status_type &es, TIter &iter, std::size_t len) :
+                            field_(field), es_(es), iter_(iter), len_(len) {
+                        }
+
+                        template<std::size_t TIdx, typename TField>
+                        void operator()() {
+                            auto &member = field_.template init_field<TIdx>();
+                            TIter iterTmp = iter_;
+                            es_ = member.read(iterTmp, len_);
+                            if (es_ == status_type::success) {
+                                iter_ = iterTmp;
+                                return;
+                            }
+
+                            field_.reset();
+                        }
+
+                    private:
+                        variant_key_dispatch &field_;
+                        status_type &es_;
+                        TIter &iter_;
+                        std::size_t len_ = 0U;
+                    };
+                };
+
+            }    // namespace adapter
+        }        // namespace types
+    }            // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_VARIANT_KEY_DISPATCH_HPP
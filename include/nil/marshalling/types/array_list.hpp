@@ -29,6 +29,7 @@
 #include <vector>
 
 #include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/parallel_policy.hpp>
 #include <nil/marshalling/types/array_list/behaviour.hpp>
 #include <nil/marshalling/types/detail/options_parser.hpp>
 
@@ -71,7 +72,9 @@ namespace nil {
             ///     of the field.@n
             ///     Supported options are:
             ///     @li @ref nil::marshalling::option::fixed_size_storage
+            ///     @li @ref nil::marshalling::option::small_buffer_storage
             ///     @li @ref nil::marshalling::option::custom_storage_type
+            ///     @li @ref nil::marshalling::option::memory_resource_storage
             ///     @li @ref nil::marshalling::option::sequence_size_field_prefix
             ///     @li @ref nil::marshalling::option::sequence_ser_length_field_prefix
             ///     @li @ref nil::marshalling::option::sequence_elem_ser_length_field_prefix
@@ -89,7 +92,11 @@ namespace nil {
             ///     @li @ref nil::marshalling::option::fail_on_invalid
             ///     @li @ref nil::marshalling::option::ignore_invalid
             ///     @li @ref nil::marshalling::option::orig_data_view (valid only if TElement is integral type
-            ///         of 1 byte size.
+            ///         or nil::marshalling::types::integral / nil::marshalling::types::float_value field
+            ///         serialized as plain value, elements wider than 1 byte are viewed using
+            ///         nil::marshalling::container::endian_array_view).
+            ///     @li @ref nil::marshalling::option::lazy_elements_view (valid only if TElement is a field
+            ///         of fixed serialization length).
             ///     @li @ref nil::marshalling::option::empty_serialization
             ///     @li @ref nil::marshalling::option::version_storage
             /// @extends nil::marshalling::field_type
@@ -184,6 +191,21 @@ namespace nil {
                     return base_impl_type::read(iter, len);
                 }
 
+                /// @brief Read field value from input data sequence splitting the work
+                ///     between several threads.
+                /// @details The elements are decoded concurrently only when they have fixed
+                ///     length, the iterator is a pointer and the field has no options
+                ///     modifying the serialization. Otherwise it is equivalent to @ref read().
+                /// @param[in, out] iter Iterator to read the data.
+                /// @param[in] len Number of bytes available for reading.
+                /// @param[in] policy Parallel processing policy.
+                /// @return Status of read operation.
+                /// @post Iterator is advanced.
+                template<typename TIter>
+                status_type read(TIter &iter, std::size_t len, const parallel_policy &policy) {
+                    return read_internal(iter, len, policy, adaptation_tag());
+                }
+
                 /// @brief Read field value from input data sequence without error check and status report.
                 /// @details Similar to @ref read(), but doesn't perform any correctness
                 ///     checks and doesn't report any failures.
@@ -211,6 +233,20 @@ namespace nil {
                     return base_impl_type::write(iter, len);
                 }
 
+                /// @brief Write current field value to output data sequence splitting the
+                ///     work between several threads.
+                /// @details Counterpart of read() with parallel policy, equivalent to
+                ///     @ref write() when parallel processing is not applicable.
+                /// @param[in, out] iter Iterator to write the data.
+                /// @param[in] len Maximal number of bytes that can be written.
+                /// @param[in] policy Parallel processing policy.
+                /// @return Status of write operation.
+                /// @post Iterator is advanced.
+                template<typename TIter>
+                status_type write(TIter &iter, std::size_t len, const parallel_policy &policy) const {
+                    return write_internal(iter, len, policy, adaptation_tag());
+                }
+
                 /// @brief Write current field value to output data sequence  without error check and status report.
                 /// @details Similar to @ref write(), but doesn't perform any correctness
                 ///     checks and doesn't report any failures.
@@ -319,6 +355,38 @@ namespace nil {
                 using base_impl_type::write_data;
 
             private:
+                struct basic_tag { };
+                struct adapted_tag { };
+
+                using adaptation_tag = typename std::conditional<
+                    std::is_same<base_impl_type,
+                                 detail::basic_array_list<TFieldBase, detail::array_list_storage_type_type<
+                                                                          TElement, parsed_options_type,
+                                                                          typename TFieldBase::endian_type>>>::value,
+                    basic_tag, adapted_tag>::type;
+
+                template<typename TIter>
+                status_type read_internal(TIter &iter, std::size_t len, const parallel_policy &policy, basic_tag) {
+                    return base_impl_type::read(iter, len, policy);
+                }
+
+                template<typename TIter>
+                status_type read_internal(TIter &iter, std::size_t len, const parallel_policy &, adapted_tag) {
+                    return read(iter, len);
+                }
+
+                template<typename TIter>
+                status_type write_internal(TIter &iter, std::size_t len, const parallel_policy &policy,
+                                           basic_tag) const {
+                    return base_impl_type::write(iter, len, policy);
+                }
+
+                template<typename TIter>
+                status_type write_internal(TIter &iter, std::size_t len, const parallel_policy &,
+                                           adapted_tag) const {
+                    return write(iter, len);
+                }
+
                 static_assert(
                     !parsed_options_type::has_ser_offset,
                     "nil::marshalling::option::num_value_ser_offset option is not applicable to array_list field");
@@ -339,9 +407,25 @@ namespace nil {
                               "to array_list field");
                 static_assert(
                     (!parsed_options_type::has_orig_data_view)
-                        || (std::is_integral<TElement>::value && (sizeof(TElement) == sizeof(std::uint8_t))),
+                        || (std::is_integral<TElement>::value && (sizeof(TElement) == sizeof(std::uint8_t)))
+                        || detail::array_list_elem_bulk_access<TElement, typename TFieldBase::endian_type>::value,
                     "Usage of nil::marshalling::option::orig_data_view option is allowed only for raw binary data "
-                    "(std::uint8_t) types.");
+                    "(std::uint8_t), raw integral values and plain integral or float_value fields.");
+                static_assert(
+                    (!parsed_options_type::has_lazy_elements_view)
+                        || detail::array_list_elem_is_lazy_decodable<TElement>::value,
+                    "Usage of nil::marshalling::option::lazy_elements_view option is allowed only for the fields "
+                    "of fixed serialization length, which don't depend on the version and don't use (nor have "
+                    "members using) fail_on_invalid, invalid_by_default, custom_value_reader or has_custom_read.");
+                static_assert(
+                    (!parsed_options_type::has_lazy_elements_view)
+                        || ((!parsed_options_type::has_sequence_elem_ser_length_field_prefix)
+                            && (!parsed_options_type::has_sequence_elem_fixed_ser_length_field_prefix)
+                            && (!parsed_options_type::has_sequence_termination_field_suffix)
+                            && (!parsed_options_type::has_sequence_group_varint)),
+                    "nil::marshalling::option::lazy_elements_view option is incompatible with "
+                    "sequence_elem_ser_length_field_prefix, sequence_elem_fixed_ser_length_field_prefix, "
+                    "sequence_termination_field_suffix and sequence_group_varint");
                 static_assert(
                     !parsed_options_type::has_versions_range,
                     "nil::marshalling::option::exists_between_versions (or similar) option is not applicable to "
@@ -349,6 +433,22 @@ namespace nil {
                 static_assert(
                     !parsed_options_type::has_invalid_by_default,
                     "nil::marshalling::option::invalid_by_default option is not applicable to array_list field");
+                static_assert(
+                    (!parsed_options_type::has_sequence_group_varint)
+                        || (parsed_options_type::has_sequence_size_field_prefix
+                            && (!parsed_options_type::has_sequence_fixed_size)
+                            && (!parsed_options_type::has_sequence_size_forcing)
+                            && (!parsed_options_type::has_sequence_length_forcing)
+                            && (!parsed_options_type::has_sequence_elem_length_forcing)
+                            && (!parsed_options_type::has_sequence_ser_length_field_prefix)
+                            && (!parsed_options_type::has_sequence_elem_ser_length_field_prefix)
+                            && (!parsed_options_type::has_sequence_elem_fixed_ser_length_field_prefix)
+                            && (!parsed_options_type::has_sequence_trailing_field_suffix)
+                            && (!parsed_options_type::has_sequence_termination_field_suffix)
+                            && (!parsed_options_type::has_orig_data_view)),
+                    "nil::marshalling::option::sequence_group_varint option must be used with "
+                    "nil::marshalling::option::sequence_size_field_prefix and is incompatible with other sequence "
+                    "length related options");
             };
 
             /// @brief Equivalence comparison operator.
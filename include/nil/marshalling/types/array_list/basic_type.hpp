@@ -26,15 +26,19 @@
 #ifndef MARSHALLING_BASIC_ARRAY_LIST_HPP
 #define MARSHALLING_BASIC_ARRAY_LIST_HPP
 
+#include <cstring>
 #include <type_traits>
 #include <algorithm>
+#include <iterator>
 #include <limits>
 #include <numeric>
 
 #include <nil/marshalling/assert_type.hpp>
 #include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/parallel_policy.hpp>
 #include <nil/marshalling/processing/access.hpp>
 #include <nil/marshalling/types/detail/common_funcs.hpp>
+#include <nil/marshalling/types/detail/num_value_range_table.hpp>
 #include <nil/marshalling/type_traits.hpp>
 #include <nil/marshalling/types/array_list/type_traits.hpp>
 #include <nil/marshalling/container/type_traits.hpp>
@@ -159,24 +163,9 @@ namespace nil {
 
                     template<typename TIter>
                     status_type read(TIter &iter, std::size_t len) {
-
                         using IterType = typename std::decay<decltype(iter)>::type;
-                        using IterCategory = typename std::iterator_traits<IterType>::iterator_category;
-                        static const bool IsRandomAccessIter
-                            = std::is_base_of<std::random_access_iterator_tag, IterCategory>::value;
-                        static const bool IsRawData
-                            = std::is_integral<element_type>::value && (sizeof(element_type) == sizeof(std::uint8_t));
-
-                        using tag = typename std::conditional<IsRandomAccessIter && IsRawData, raw_data_tag,
-                                                              field_elem_tag>::type;
-
-                        auto length = std::is_same<typename std::iterator_traits<IterType>::value_type, bool>::value ? max_bit_length() : max_length();
-
-                        if (len > length){
-                            len = length;
-                        }
-
-                        return read_internal(iter, len, tag());
+                        using tag = read_tag<IterType>;
+                        return read_internal(iter, limit_read_length<IterType>(len), tag());
                     }
 
                     template<typename TIter>
@@ -184,34 +173,26 @@ namespace nil {
 
                     template<typename TIter>
                     status_type read_n(std::size_t count, TIter &iter, std::size_t &len) {
-                        using IterType = typename std::decay<decltype(iter)>::type;
-                        using IterCategory = typename std::iterator_traits<IterType>::iterator_category;
-                        static const bool IsRandomAccessIter
-                            = std::is_base_of<std::random_access_iterator_tag, IterCategory>::value;
-                        static const bool IsRawData
-                            = std::is_integral<element_type>::value && (sizeof(element_type) == sizeof(std::uint8_t));
-
-                        using tag = typename std::conditional<IsRandomAccessIter && IsRawData, raw_data_tag,
-                                                              field_elem_tag>::type;
+                        using tag = read_tag<typename std::decay<decltype(iter)>::type>;
 
                         return read_internal_n(count, iter, len, tag());
                     }
 
                     template<typename TIter>
                     void read_no_status_n(std::size_t count, TIter &iter) {
-                        using IterType = typename std::decay<decltype(iter)>::type;
-                        using IterCategory = typename std::iterator_traits<IterType>::iterator_category;
-                        static const bool IsRandomAccessIter
-                            = std::is_base_of<std::random_access_iterator_tag, IterCategory>::value;
-                        static const bool IsRawData
-                            = std::is_integral<element_type>::value && (sizeof(element_type) == sizeof(std::uint8_t));
-
-                        using tag = typename std::conditional<IsRandomAccessIter && IsRawData, raw_data_tag,
-                                                              field_elem_tag>::type;
+                        using tag = read_tag<typename std::decay<decltype(iter)>::type>;
 
                         return read_no_status_internal_n(count, iter, tag());
                     }
 
+                    template<typename TIter>
+                    status_type read(TIter &iter, std::size_t len, const parallel_policy &policy) {
+                        using IterType = typename std::decay<TIter>::type;
+                        using tag = typename std::conditional<is_parallel_access<IterType>(), bulk_data_tag,
+                                                              field_elem_tag>::type;
+                        return read_internal(iter, limit_read_length<IterType>(len), policy, tag());
+                    }
+
                     template<typename TIter>
                     static status_type write_element(const element_type &elem, TIter &iter, std::size_t &len) {
                         return write_element_internal(elem, iter, len, elem_tag());
@@ -224,22 +205,29 @@ namespace nil {
 
                     template<typename TIter>
                     status_type write(TIter &iter, std::size_t len) const {
-                        return common_funcs::write_sequence(*this, iter, len);
+                        return write_internal(iter, len, write_tag<TIter>());
+                    }
+
+                    template<typename TIter>
+                    status_type write(TIter &iter, std::size_t len, const parallel_policy &policy) const {
+                        using tag = typename std::conditional<is_parallel_access<typename std::decay<TIter>::type>(),
+                                                              bulk_data_tag, field_elem_tag>::type;
+                        return write_internal(iter, len, policy, tag());
                     }
 
                     template<typename TIter>
                     void write_no_status(TIter &iter) const {
-                        common_funcs::write_sequence_no_status(*this, iter);
+                        write_no_status_internal(iter, write_tag<TIter>());
                     }
 
                     template<typename TIter>
                     status_type write_n(std::size_t count, TIter &iter, std::size_t &len) const {
-                        return common_funcs::write_sequence_n(*this, count, iter, len);
+                        return write_internal_n(count, iter, len, write_tag<TIter>());
                     }
 
                     template<typename TIter>
                     void write_no_status_n(std::size_t count, TIter &iter) const {
-                        common_funcs::write_sequence_no_status_n(*this, count, iter);
+                        write_no_status_internal_n(count, iter, write_tag<TIter>());
                     }
 
                     static constexpr bool is_version_dependent() {
@@ -256,10 +244,21 @@ namespace nil {
                     struct fixed_length_tag { };
                     struct var_length_tag { };
                     struct raw_data_tag { };
+                    struct bulk_data_tag { };
+                    struct view_data_tag { };
+                    struct lazy_data_tag { };
+                    struct contiguous_storage_tag { };
+                    struct staged_storage_tag { };
                     struct assign_exists_tag { };
                     struct assign_missing_tag { };
                     struct version_dependent_tag { };
                     struct no_version_dependency_tag { };
+                    struct resize_exists_tag { };
+                    struct resize_missing_tag { };
+                    struct reserve_exists_tag { };
+                    struct reserve_missing_tag { };
+                    struct range_valid_tag { };
+                    struct field_valid_tag { };
 
                     using elem_tag = typename std::conditional<std::is_integral<element_type>::value, integral_elem_tag,
                                                                field_elem_tag>::type;
@@ -272,6 +271,98 @@ namespace nil {
                         typename std::conditional<detail::array_list_element_is_version_dependent<element_type>(),
                                                   version_dependent_tag, no_version_dependency_tag>::type;
 
+                    using resize_tag = typename std::conditional<has_member_function_resize<value_type>::value,
+                                                                 resize_exists_tag, resize_missing_tag>::type;
+
+                    using reserve_tag = typename std::conditional<has_member_function_reserve<value_type>::value,
+                                                                  reserve_exists_tag, reserve_missing_tag>::type;
+
+                    template<typename TIter>
+                    using read_length_tag = typename std::conditional<
+                        std::is_same<field_length_tag, fixed_length_tag>::value && (0U < max_element_length())
+                            && !std::is_same<typename std::iterator_traits<TIter>::value_type, bool>::value,
+                        fixed_length_tag, var_length_tag>::type;
+
+                    using bulk_access_type = detail::array_list_elem_bulk_access<element_type, endian_type>;
+                    using bulk_value_type = typename bulk_access_type::value_type;
+                    using bulk_endian_type = typename bulk_access_type::endian_type;
+
+                    using bulk_storage_tag =
+                        typename std::conditional<std::is_integral<element_type>::value
+                                                      && has_member_function_data<value_type>::value,
+                                                  contiguous_storage_tag, staged_storage_tag>::type;
+
+                    static constexpr std::size_t bulk_block_size() {
+                        return 64U;
+                    }
+
+                    template<typename TIter>
+                    static constexpr bool is_bulk_access() {
+                        return bulk_access_type::value && has_member_function_resize<value_type>::value
+                               && processing::detail::is_bulk_accessible<bulk_endian_type, TIter,
+                                                                         bulk_value_type>::value;
+                    }
+
+                    template<typename TIter>
+                    static constexpr bool is_parallel_access() {
+                        return is_bulk_access<TIter>()
+                               && std::is_base_of<std::random_access_iterator_tag,
+                                                  typename std::iterator_traits<
+                                                      typename value_type::iterator>::iterator_category>::value;
+                    }
+
+                    static constexpr bool is_view_storage() {
+                        return detail::array_list_is_endian_view<value_type>::value;
+                    }
+
+                    static constexpr bool is_lazy_storage() {
+                        return detail::array_list_is_lazy_view<value_type>::value;
+                    }
+
+                    template<typename TIter>
+                    using sequential_read_tag =
+                        typename std::conditional<is_bulk_access<TIter>(), bulk_data_tag, field_elem_tag>::type;
+
+                    template<typename TIter>
+                    using random_access_read_tag = typename std::conditional<
+                        is_view_storage(), view_data_tag,
+                        typename std::conditional<
+                            is_lazy_storage(), lazy_data_tag,
+                            typename std::conditional<std::is_integral<element_type>::value
+                                                          && (sizeof(element_type) == sizeof(std::uint8_t)),
+                                                      raw_data_tag, sequential_read_tag<TIter>>::type>::type>::type;
+
+                    template<typename TIter>
+                    using read_tag = typename std::conditional<
+                        std::is_base_of<std::random_access_iterator_tag,
+                                        typename std::iterator_traits<TIter>::iterator_category>::value,
+                        random_access_read_tag<TIter>, sequential_read_tag<TIter>>::type;
+
+                    template<typename TIter>
+                    using write_tag = typename std::conditional<
+                        is_view_storage()
+                            && processing::detail::is_contiguous_byte_access<bulk_endian_type,
+                                                                             typename std::decay<TIter>::type>::value,
+                        view_data_tag,
+                        typename std::conditional<
+                            is_lazy_storage()
+                                && !std::is_same<
+                                    typename std::iterator_traits<typename std::decay<TIter>::type>::value_type,
+                                    bool>::value,
+                            lazy_data_tag,
+                            typename std::conditional<is_bulk_access<typename std::decay<TIter>::type>(),
+                                                      bulk_data_tag, field_elem_tag>::type>::type>::type;
+
+                    // Both serial and parallel reads don't consume more data than the
+                    // storage can hold.
+                    template<typename TIter>
+                    std::size_t limit_read_length(std::size_t len) const {
+                        std::size_t length = std::is_same<typename std::iterator_traits<TIter>::value_type, bool>::value
+                                                 ? max_bit_length()
+                                                 : max_length();
+                        return std::min(len, length);
+                    }
+
                     constexpr std::size_t length_internal(field_elem_tag) const {
                         return field_length(field_length_tag());
                     }
@@ -436,11 +527,24 @@ namespace nil {
                         return write_no_status_integral_element(elem, iter);
                     }
 
-                    constexpr bool valid_internal(field_elem_tag) const {
+                    bool valid_internal(field_elem_tag) const {
+                        using tag = typename std::conditional<detail::array_list_elem_range_validation<element_type>::value,
+                                                              range_valid_tag, field_valid_tag>::type;
+                        return valid_elements(tag());
+                    }
+
+                    bool valid_elements(field_valid_tag) const {
                         return std::all_of(value_.begin(), value_.end(),
                                            [](const element_type &e) -> bool { return e.valid(); });
                     }
 
+                    bool valid_elements(range_valid_tag) const {
+                        using table_type = detail::num_value_range_table<
+                            typename element_type::value_type,
+                            typename element_type::parsed_options_type::multi_range_validation_ranges>;
+                        return table_type::contains_all(value_.begin(), value_.end());
+                    }
+
                     static constexpr bool valid_internal(integral_elem_tag) {
                         return true;
                     }
@@ -485,6 +589,11 @@ namespace nil {
                         static_assert(has_member_function_clear<value_type>::value,
                                       "The used storage type for basic_array_list must have clear() member function");
                         value_.clear();
+                        return read_elements(iter, len, read_length_tag<TIter>());
+                    }
+
+                    template<typename TIter>
+                    status_type read_elements(TIter &iter, std::size_t len, var_length_tag) {
                         auto remLen = len;
                         while (0 < remLen) {
                             element_type &elem = create_back();
@@ -498,6 +607,65 @@ namespace nil {
                         return status_type::success;
                     }
 
+                    template<typename TIter>
+                    status_type read_elements(TIter &iter, std::size_t len, fixed_length_tag) {
+                        std::size_t count = len / max_element_length();
+                        status_type es = read_fixed_elements(count, iter, resize_tag());
+                        if ((es == status_type::success) && ((count * max_element_length()) != len)) {
+                            return status_type::not_enough_data;
+                        }
+
+                        return es;
+                    }
+
+                    template<typename TIter>
+                    status_type read_fixed_elements(std::size_t count, TIter &iter, resize_exists_tag) {
+                        value_.resize(count);
+                        auto elemIter = value_.begin();
+                        for (std::size_t idx = 0U; idx < count; ++idx, ++elemIter) {
+                            update_elem_version(*elemIter, version_tag());
+                            status_type es = read_fixed_element(*elemIter, iter, elem_tag());
+                            if (es != status_type::success) {
+                                value_.resize(idx);
+                                return es;
+                            }
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    status_type read_fixed_elements(std::size_t count, TIter &iter, resize_missing_tag) {
+                        eval_reserve(count, reserve_tag());
+                        for (std::size_t idx = 0U; idx < count; ++idx) {
+                            status_type es = read_fixed_element(create_back(), iter, elem_tag());
+                            if (es != status_type::success) {
+                                value_.pop_back();
+                                return es;
+                            }
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    static status_type read_fixed_element(element_type &elem, TIter &iter, field_elem_tag) {
+                        return elem.read(iter, max_element_length());
+                    }
+
+                    template<typename TIter>
+                    static status_type read_fixed_element(element_type &elem, TIter &iter, integral_elem_tag) {
+                        read_no_status_integral_element(elem, iter);
+                        return status_type::success;
+                    }
+
+                    void eval_reserve(std::size_t count, reserve_exists_tag) {
+                        value_.reserve(count);
+                    }
+
+                    static void eval_reserve(std::size_t, reserve_missing_tag) {
+                    }
+
                     template<typename TIter>
                     status_type read_internal(TIter &iter, std::size_t len, raw_data_tag) {
                         using tag = typename std::conditional<detail::vector_has_assign<value_type>::value,
@@ -519,9 +687,298 @@ namespace nil {
                         value_ = value_type(data, len);
                     }
 
+                    template<typename TIter>
+                    status_type read_internal(TIter &iter, std::size_t len, bulk_data_tag) {
+                        static const std::size_t ElemLength = sizeof(bulk_value_type);
+                        std::size_t count = len / ElemLength;
+                        read_bulk(count, iter);
+                        if ((count * ElemLength) != len) {
+                            return status_type::not_enough_data;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    status_type read_internal(TIter &iter, std::size_t len, view_data_tag) {
+                        static const std::size_t ElemLength = sizeof(bulk_value_type);
+                        std::size_t count = len / ElemLength;
+                        value_ = value_type(reinterpret_cast<typename value_type::const_pointer>(&(*iter)), count);
+                        std::advance(iter, count * ElemLength);
+                        if ((count * ElemLength) != len) {
+                            return status_type::not_enough_data;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    status_type read_internal(TIter &iter, std::size_t len, lazy_data_tag) {
+                        static const std::size_t ElemLength = max_element_length();
+                        std::size_t count = len / ElemLength;
+                        value_ = value_type(reinterpret_cast<typename value_type::const_pointer>(&(*iter)), count);
+                        std::advance(iter, count * ElemLength);
+                        if ((count * ElemLength) != len) {
+                            return status_type::not_enough_data;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    status_type read_internal(TIter &iter, std::size_t len, const parallel_policy &,
+                                              field_elem_tag) {
+                        return read(iter, len);
+                    }
+
+                    template<typename TIter>
+                    status_type read_internal(TIter &iter, std::size_t len, const parallel_policy &policy,
+                                              bulk_data_tag) {
+                        static const std::size_t ElemLength = sizeof(bulk_value_type);
+                        std::size_t count = len / ElemLength;
+                        value_.resize(count);
+
+                        TIter first = iter;
+                        marshalling::detail::parallel_for(
+                            policy, count, ElemLength, [this, first](std::size_t from, std::size_t to) {
+                                TIter chunkIter = first + (from * ElemLength);
+                                read_bulk_range(from, to - from, chunkIter, bulk_storage_tag());
+                            });
+
+                        iter += count * ElemLength;
+                        if ((count * ElemLength) != len) {
+                            return status_type::not_enough_data;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    void read_bulk(std::size_t count, TIter &iter) {
+                        value_.resize(count);
+                        read_bulk_range(0U, count, iter, bulk_storage_tag());
+                    }
+
+                    template<typename TIter>
+                    void read_bulk_range(std::size_t first, std::size_t count, TIter &iter, contiguous_storage_tag) {
+                        processing::read_data_bulk(value_.data() + first, count, iter, bulk_endian_type());
+                    }
+
+                    template<typename TIter>
+                    void read_bulk_range(std::size_t first, std::size_t count, TIter &iter, staged_storage_tag) {
+                        bulk_value_type block[bulk_block_size()];
+                        auto elemIter = std::next(value_.begin(), first);
+                        while (0U < count) {
+                            auto blockCount = std::min(count, bulk_block_size());
+                            processing::read_data_bulk(&block[0], blockCount, iter, bulk_endian_type());
+                            for (std::size_t idx = 0U; idx < blockCount; ++idx) {
+                                bulk_value(*elemIter, elem_tag()) = block[idx];
+                                ++elemIter;
+                            }
+                            count -= blockCount;
+                        }
+                    }
+
+                    template<typename TIter>
+                    status_type write_internal(TIter &iter, std::size_t len, const parallel_policy &,
+                                               field_elem_tag) const {
+                        return write(iter, len);
+                    }
+
+                    template<typename TIter>
+                    status_type write_internal(TIter &iter, std::size_t len, const parallel_policy &policy,
+                                               bulk_data_tag) const {
+                        static const std::size_t ElemLength = sizeof(bulk_value_type);
+                        std::size_t count = std::min(value_.size(), len / ElemLength);
+
+                        TIter first = iter;
+                        marshalling::detail::parallel_for(
+                            policy, count, ElemLength, [this, first](std::size_t from, std::size_t to) {
+                                TIter chunkIter = first + (from * ElemLength);
+                                write_bulk_range(from, to - from, chunkIter, bulk_storage_tag());
+                            });
+
+                        iter += count * ElemLength;
+                        if (count < value_.size()) {
+                            return status_type::buffer_overflow;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    void write_bulk(std::size_t count, TIter &iter) const {
+                        write_bulk_range(0U, count, iter, bulk_storage_tag());
+                    }
+
+                    template<typename TIter>
+                    void write_bulk_range(std::size_t first, std::size_t count, TIter &iter,
+                                          contiguous_storage_tag) const {
+                        processing::write_data_bulk(value_.data() + first, count, iter, bulk_endian_type());
+                    }
+
+                    template<typename TIter>
+                    void write_bulk_range(std::size_t first, std::size_t count, TIter &iter,
+                                          staged_storage_tag) const {
+                        bulk_value_type block[bulk_block_size()];
+                        auto elemIter = std::next(value_.begin(), first);
+                        while (0U < count) {
+                            auto blockCount = std::min(count, bulk_block_size());
+                            for (std::size_t idx = 0U; idx < blockCount; ++idx) {
+                                block[idx] = bulk_value(*elemIter, elem_tag());
+                                ++elemIter;
+                            }
+                            processing::write_data_bulk(&block[0], blockCount, iter, bulk_endian_type());
+                            count -= blockCount;
+                        }
+                    }
+
+                    static element_type &bulk_value(element_type &elem, integral_elem_tag) {
+                        return elem;
+                    }
+
+                    static const element_type &bulk_value(const element_type &elem, integral_elem_tag) {
+                        return elem;
+                    }
+
+                    static bulk_value_type &bulk_value(element_type &elem, field_elem_tag) {
+                        return elem.value();
+                    }
+
+                    static const bulk_value_type &bulk_value(const element_type &elem, field_elem_tag) {
+                        return elem.value();
+                    }
+
+                    template<typename TIter>
+                    status_type write_internal(TIter &iter, std::size_t len, field_elem_tag) const {
+                        return common_funcs::write_sequence(*this, iter, len);
+                    }
+
+                    template<typename TIter>
+                    status_type write_internal(TIter &iter, std::size_t len, bulk_data_tag) const {
+                        std::size_t count = std::min(value_.size(), len / sizeof(bulk_value_type));
+                        write_bulk(count, iter);
+                        if (count < value_.size()) {
+                            return status_type::buffer_overflow;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    status_type write_internal(TIter &iter, std::size_t len, view_data_tag) const {
+                        std::size_t count = std::min(value_.size(), len / sizeof(bulk_value_type));
+                        write_view(count, iter);
+                        if (count < value_.size()) {
+                            return status_type::buffer_overflow;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    void write_view(std::size_t count, TIter &iter) const {
+                        std::size_t bytesCount = count * sizeof(bulk_value_type);
+                        if (0U < bytesCount) {
+                            std::memcpy(iter, value_.raw_data(), bytesCount);
+                        }
+                        iter += bytesCount;
+                    }
+
+                    template<typename TIter>
+                    status_type write_internal(TIter &iter, std::size_t len, lazy_data_tag) const {
+                        std::size_t count = std::min(value_.size(), len / max_element_length());
+                        value_.write(count, iter);
+                        if (count < value_.size()) {
+                            return status_type::buffer_overflow;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    void write_no_status_internal(TIter &iter, field_elem_tag) const {
+                        common_funcs::write_sequence_no_status(*this, iter);
+                    }
+
+                    template<typename TIter>
+                    void write_no_status_internal(TIter &iter, bulk_data_tag) const {
+                        write_bulk(value_.size(), iter);
+                    }
+
+                    template<typename TIter>
+                    void write_no_status_internal(TIter &iter, view_data_tag) const {
+                        write_view(value_.size(), iter);
+                    }
+
+                    template<typename TIter>
+                    void write_no_status_internal(TIter &iter, lazy_data_tag) const {
+                        value_.write(value_.size(), iter);
+                    }
+
+                    template<typename TIter>
+                    status_type write_internal_n(std::size_t count, TIter &iter, std::size_t &len,
+                                                 field_elem_tag) const {
+                        return common_funcs::write_sequence_n(*this, count, iter, len);
+                    }
+
+                    template<typename TIter>
+                    status_type write_internal_n(std::size_t count, TIter &iter, std::size_t &len,
+                                                 bulk_data_tag) const {
+                        count = std::min(count, value_.size());
+                        std::size_t fitCount = std::min(count, len / sizeof(bulk_value_type));
+                        write_bulk(fitCount, iter);
+                        len -= fitCount * sizeof(bulk_value_type);
+                        if (fitCount < count) {
+                            return status_type::buffer_overflow;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    status_type write_internal_n(std::size_t count, TIter &iter, std::size_t &len,
+                                                 view_data_tag) const {
+                        count = std::min(count, value_.size());
+                        std::size_t fitCount = std::min(count, len / sizeof(bulk_value_type));
+                        write_view(fitCount, iter);
+                        len -= fitCount * sizeof(bulk_value_type);
+                        if (fitCount < count) {
+                            return status_type::buffer_overflow;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    void write_no_status_internal_n(std::size_t count, TIter &iter, field_elem_tag) const {
+                        common_funcs::write_sequence_no_status_n(*this, count, iter);
+                    }
+
+                    template<typename TIter>
+                    void write_no_status_internal_n(std::size_t count, TIter &iter, bulk_data_tag) const {
+                        write_bulk(std::min(count, value_.size()), iter);
+                    }
+
                     template<typename TIter>
                     status_type read_internal_n(std::size_t count, TIter &iter, std::size_t len, field_elem_tag) {
                         clear();
+                        return read_elements_n(count, iter, len, read_length_tag<TIter>());
+                    }
+
+                    template<typename TIter>
+                    status_type read_elements_n(std::size_t count, TIter &iter, std::size_t len, fixed_length_tag) {
+                        std::size_t fitCount = std::min(count, len / max_element_length());
+                        status_type es = read_fixed_elements(fitCount, iter, resize_tag());
+                        if ((es == status_type::success) && (fitCount < count)) {
+                            return status_type::not_enough_data;
+                        }
+
+                        return es;
+                    }
+
+                    template<typename TIter>
+                    status_type read_elements_n(std::size_t count, TIter &iter, std::size_t len, var_length_tag) {
                         while (0 < count) {
                             auto &elem = create_back();
                             status_type es = read_element(elem, iter, len);
@@ -544,6 +1001,52 @@ namespace nil {
                         return read_internal(iter, count, raw_data_tag());
                     }
 
+                    template<typename TIter>
+                    void write_no_status_internal_n(std::size_t count, TIter &iter, view_data_tag) const {
+                        write_view(std::min(count, value_.size()), iter);
+                    }
+
+                    template<typename TIter>
+                    status_type write_internal_n(std::size_t count, TIter &iter, std::size_t &len,
+                                                 lazy_data_tag) const {
+                        count = std::min(count, value_.size());
+                        std::size_t fitCount = std::min(count, len / max_element_length());
+                        value_.write(fitCount, iter);
+                        len -= fitCount * max_element_length();
+                        if (fitCount < count) {
+                            return status_type::buffer_overflow;
+                        }
+
+                        return status_type::success;
+                    }
+
+                    template<typename TIter>
+                    void write_no_status_internal_n(std::size_t count, TIter &iter, lazy_data_tag) const {
+                        value_.write(std::min(count, value_.size()), iter);
+                    }
+
+                    template<typename TIter>
+                    status_type read_internal_n(std::size_t count, TIter &iter, std::size_t len, view_data_tag) {
+                        std::size_t fitCount = std::min(count, len / sizeof(bulk_value_type));
+                        status_type es = read_internal(iter, fitCount * sizeof(bulk_value_type), view_data_tag());
+                        if ((es == status_type::success) && (fitCount < count)) {
+                            return status_type::not_enough_data;
+                        }
+
+                        return es;
+                    }
+
+                    template<typename TIter>
+                    status_type read_internal_n(std::size_t count, TIter &iter, std::size_t len, lazy_data_tag) {
+                        std::size_t fitCount = std::min(count, len / max_element_length());
+                        status_type es = read_internal(iter, fitCount * max_element_length(), lazy_data_tag());
+                        if ((es == status_type::success) && (fitCount < count)) {
+                            return status_type::not_enough_data;
+                        }
+
+                        return es;
+                    }
+
                     template<typename TIter>
                     void read_no_status_internal_n(std::size_t count, TIter &iter, field_elem_tag) {
                         clear();
@@ -554,11 +1057,37 @@ namespace nil {
                         }
                     }
 
+                    template<typename TIter>
+                    status_type read_internal_n(std::size_t count, TIter &iter, std::size_t len, bulk_data_tag) {
+                        std::size_t fitCount = std::min(count, len / sizeof(bulk_value_type));
+                        read_bulk(fitCount, iter);
+                        if (fitCount < count) {
+                            return status_type::not_enough_data;
+                        }
+
+                        return status_type::success;
+                    }
+
                     template<typename TIter>
                     void read_no_status_internal_n(std::size_t count, TIter &iter, raw_data_tag) {
                         read_internal(iter, count, raw_data_tag());
                     }
 
+                    template<typename TIter>
+                    void read_no_status_internal_n(std::size_t count, TIter &iter, view_data_tag) {
+                        read_internal(iter, count * sizeof(bulk_value_type), view_data_tag());
+                    }
+
+                    template<typename TIter>
+                    void read_no_status_internal_n(std::size_t count, TIter &iter, lazy_data_tag) {
+                        read_internal(iter, count * max_element_length(), lazy_data_tag());
+                    }
+
+                    template<typename TIter>
+                    void read_no_status_internal_n(std::size_t count, TIter &iter, bulk_data_tag) {
+                        read_bulk(count, iter);
+                    }
+
                     bool update_elem_version(element_type &elem, version_dependent_tag) {
                         return elem.set_version(version_base_impl::version_);
                     }
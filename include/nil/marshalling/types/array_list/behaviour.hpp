@@ -30,7 +30,11 @@
 
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/container/static_vector.hpp>
+#include <nil/marshalling/container/small_vector.hpp>
 #include <nil/marshalling/container/array_view.hpp>
+#include <nil/marshalling/container/endian_array_view.hpp>
+#include <nil/marshalling/container/lazy_array_view.hpp>
+#include <nil/marshalling/container/memory_resource.hpp>
 #include <nil/marshalling/types/array_list/basic_type.hpp>
 #include <nil/marshalling/types/detail/adapt_basic_field.hpp>
 #include <nil/marshalling/types/detail/options_parser.hpp>
@@ -42,19 +46,87 @@ namespace nil {
         namespace types {
             namespace detail {
 
+                template<bool THasMemoryResourceStorage>
+                struct array_list_memory_resource_storage_type;
+
+                template<>
+                struct array_list_memory_resource_storage_type<true> {
+                    template<typename TElement>
+                    using type = nil::marshalling::container::resource_vector<TElement>;
+                };
+
+                template<>
+                struct array_list_memory_resource_storage_type<false> {
+                    template<typename TElement>
+                    using type = std::vector<TElement>;
+                };
+
+                template<bool THasSmallBufferStorage>
+                struct array_list_small_buffer_storage_type;
+
+                template<>
+                struct array_list_small_buffer_storage_type<true> {
+                    template<typename TElement, typename TOpt>
+                    using type = nil::marshalling::container::small_vector<TElement, TOpt::small_buffer_storage>;
+                };
+
+                template<>
+                struct array_list_small_buffer_storage_type<false> {
+                    template<typename TElement, typename TOpt>
+                    using type = typename array_list_memory_resource_storage_type<
+                        TOpt::has_memory_resource_storage>::template type<TElement>;
+                };
+
+                template<bool THasLazyElementsView>
+                struct array_list_lazy_elements_view_storage_type;
+
+                template<>
+                struct array_list_lazy_elements_view_storage_type<true> {
+                    template<typename TElement, typename TOpt>
+                    using type
+                        = nil::marshalling::container::lazy_array_view<TElement, TOpt::lazy_elements_view_cached>;
+                };
+
+                template<>
+                struct array_list_lazy_elements_view_storage_type<false> {
+                    template<typename TElement, typename TOpt>
+                    using type = typename array_list_small_buffer_storage_type<
+                        TOpt::has_small_buffer_storage>::template type<TElement, TOpt>;
+                };
+
+                template<bool TIsRawData>
+                struct array_list_orig_data_view_container_type;
+
+                template<>
+                struct array_list_orig_data_view_container_type<true> {
+                    template<typename TElement, typename TEndian>
+                    using type = nil::marshalling::container::array_view<TElement>;
+                };
+
+                template<>
+                struct array_list_orig_data_view_container_type<false> {
+                    template<typename TElement, typename TEndian>
+                    using type = nil::marshalling::container::endian_array_view<
+                        TElement, typename array_list_elem_bulk_access<TElement, TEndian>::endian_type,
+                        typename array_list_elem_bulk_access<TElement, TEndian>::value_type>;
+                };
+
                 template<bool THasOrigDataViewStorage>
                 struct array_list_orig_data_view_storage_type;
 
                 template<>
                 struct array_list_orig_data_view_storage_type<true> {
-                    template<typename TElement>
-                    using type = nil::marshalling::container::array_view<TElement>;
+                    template<typename TElement, typename TOpt, typename TEndian>
+                    using type = typename array_list_orig_data_view_container_type<
+                        std::is_integral<TElement>::value
+                        && (sizeof(TElement) == sizeof(std::uint8_t))>::template type<TElement, TEndian>;
                 };
 
                 template<>
                 struct array_list_orig_data_view_storage_type<false> {
-                    template<typename TElement>
-                    using type = std::vector<TElement>;
+                    template<typename TElement, typename TOpt, typename TEndian>
+                    using type = typename array_list_lazy_elements_view_storage_type<
+                        TOpt::has_lazy_elements_view>::template type<TElement, TOpt>;
                 };
 
                 template<bool THasSequenceFixedSizeUseFixedSizeStorage>
@@ -62,16 +134,18 @@ namespace nil {
 
                 template<>
                 struct array_list_sequence_fixed_size_use_fixed_size_storage_type<true> {
-                    template<typename TElement, typename TOpt>
+                    template<typename TElement, typename TOpt, typename TEndian>
                     using type = nil::marshalling::container::static_vector<TElement, TOpt::sequence_fixed_size>;
                 };
 
                 template<>
                 struct array_list_sequence_fixed_size_use_fixed_size_storage_type<false> {
-                    template<typename TElement, typename TOpt>
+                    template<typename TElement, typename TOpt, typename TEndian>
                     using type = typename array_list_orig_data_view_storage_type<
-                        TOpt::has_orig_data_view && std::is_integral<TElement>::value
-                        && (sizeof(TElement) == sizeof(std::uint8_t))>::template type<TElement>;
+                        TOpt::has_orig_data_view
+                        && ((std::is_integral<TElement>::value && (sizeof(TElement) == sizeof(std::uint8_t)))
+                            || array_list_elem_bulk_access<TElement, TEndian>::value)>::template type<TElement, TOpt,
+                                                                                                       TEndian>;
                 };
 
                 template<bool THasFixedSizeStorage>
@@ -79,15 +153,15 @@ namespace nil {
 
                 template<>
                 struct array_list_fixed_size_storage_type<true> {
-                    template<typename TElement, typename TOpt>
+                    template<typename TElement, typename TOpt, typename TEndian>
                     using type = nil::marshalling::container::static_vector<TElement, TOpt::fixed_size_storage>;
                 };
 
                 template<>
                 struct array_list_fixed_size_storage_type<false> {
-                    template<typename TElement, typename TOpt>
+                    template<typename TElement, typename TOpt, typename TEndian>
                     using type = typename array_list_sequence_fixed_size_use_fixed_size_storage_type<
-                        TOpt::has_sequence_fixed_size_use_fixed_size_storage>::template type<TElement, TOpt>;
+                        TOpt::has_sequence_fixed_size_use_fixed_size_storage>::template type<TElement, TOpt, TEndian>;
                 };
 
                 template<bool THasCustomStorage>
@@ -95,25 +169,26 @@ namespace nil {
 
                 template<>
                 struct array_list_custom_array_list_storage_type<true> {
-                    template<typename TElement, typename TOpt>
+                    template<typename TElement, typename TOpt, typename TEndian>
                     using type = typename TOpt::custom_storage_type;
                 };
 
                 template<>
                 struct array_list_custom_array_list_storage_type<false> {
-                    template<typename TElement, typename TOpt>
+                    template<typename TElement, typename TOpt, typename TEndian>
                     using type = typename array_list_fixed_size_storage_type<
-                        TOpt::has_fixed_size_storage>::template type<TElement, TOpt>;
+                        TOpt::has_fixed_size_storage>::template type<TElement, TOpt, TEndian>;
                 };
 
-                template<typename TElement, typename TOpt>
+                template<typename TElement, typename TOpt, typename TEndian>
                 using array_list_storage_type_type = typename array_list_custom_array_list_storage_type<
-                    TOpt::has_custom_storage_type>::template type<TElement, TOpt>;
+                    TOpt::has_custom_storage_type>::template type<TElement, TOpt, TEndian>;
 
                 template<typename TFieldBase, typename TElement, typename... TOptions>
                 using array_list_base_type = adapt_basic_field_type<
-                    basic_array_list<
-                        TFieldBase, array_list_storage_type_type<TElement, options_parser<TOptions...>>>,
+                    basic_array_list<TFieldBase,
+                                     array_list_storage_type_type<TElement, options_parser<TOptions...>,
+                                                                  typename TFieldBase::endian_type>>,
                     TOptions...>;
 
             }    // namespace detail
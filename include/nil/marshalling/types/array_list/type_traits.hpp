@@ -30,17 +30,31 @@
 #include <algorithm>
 #include <limits>
 #include <numeric>
+#include <tuple>
 
 #include <nil/marshalling/assert_type.hpp>
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/processing/access.hpp>
+#include <nil/marshalling/type_traits.hpp>
 #include <nil/marshalling/container/static_vector.hpp>
 #include <nil/marshalling/container/static_string.hpp>
+#include <nil/marshalling/container/endian_array_view.hpp>
+#include <nil/marshalling/container/lazy_array_view.hpp>
 #include <nil/marshalling/types/detail/common_funcs.hpp>
 
 namespace nil {
     namespace marshalling {
         namespace types {
+
+            template<typename TFieldBase, typename T, typename... TOptions>
+            class integral;
+
+            template<typename TFieldBase, typename TEnum, typename... TOptions>
+            class enumeration;
+
+            template<typename TFieldBase, typename T, typename... TOptions>
+            class float_value;
+
             namespace detail {
 
                 template<typename TElemType, bool TIntegral>
@@ -79,6 +93,26 @@ namespace nil {
                     static const std::size_t value = TSize - 1;
                 };
 
+                template<typename TStorage>
+                struct array_list_is_endian_view {
+                    static const bool value = false;
+                };
+
+                template<typename T, typename TEndian, typename TValue>
+                struct array_list_is_endian_view<nil::marshalling::container::endian_array_view<T, TEndian, TValue>> {
+                    static const bool value = true;
+                };
+
+                template<typename TStorage>
+                struct array_list_is_lazy_view {
+                    static const bool value = false;
+                };
+
+                template<typename T, bool TCached>
+                struct array_list_is_lazy_view<nil::marshalling::container::lazy_array_view<T, TCached>> {
+                    static const bool value = true;
+                };
+
                 template<typename T>
                 class vector_has_assign {
                 protected:
@@ -131,6 +165,163 @@ namespace nil {
                     return array_list_elem_version_dependency_helper<TElem, std::is_integral<TElem>::value>::value;
                 }
 
+                template<typename TElem, typename TValue = typename TElem::value_type>
+                struct array_list_elem_read_may_fail;
+
+                template<typename... TMembers>
+                struct array_list_elem_members_read_may_fail {
+                    static const bool value = false;
+                };
+
+                template<typename TFirst, typename... TRest>
+                struct array_list_elem_members_read_may_fail<TFirst, TRest...> {
+                    static const bool value = array_list_elem_read_may_fail<TFirst>::value
+                                              || array_list_elem_members_read_may_fail<TRest...>::value;
+                };
+
+                template<typename TElem>
+                struct array_list_elem_options_read_may_fail {
+                    using parsed_options_type = typename TElem::parsed_options_type;
+
+                    static const bool value
+                        = parsed_options_type::has_fail_on_invalid || parsed_options_type::has_invalid_by_default
+                          || parsed_options_type::has_custom_value_reader || parsed_options_type::has_custom_read;
+                };
+
+                template<typename TElem, typename TValue>
+                struct array_list_elem_read_may_fail {
+                    static const bool value = array_list_elem_options_read_may_fail<TElem>::value;
+                };
+
+                template<typename TElem, typename... TMembers>
+                struct array_list_elem_read_may_fail<TElem, std::tuple<TMembers...>> {
+                    static const bool value = array_list_elem_options_read_may_fail<TElem>::value
+                                              || array_list_elem_members_read_may_fail<TMembers...>::value;
+                };
+
+                template<typename TElem, bool TIsIntegral>
+                struct array_list_elem_lazy_decodable_helper;
+
+                template<typename TElem>
+                struct array_list_elem_lazy_decodable_helper<TElem, true> {
+                    static const bool value = false;
+                };
+
+                template<typename TElem>
+                struct array_list_elem_lazy_decodable_helper<TElem, false> {
+                    static const bool value = (!array_list_field_has_var_length<TElem>::value)
+                                              && (!array_list_element_is_version_dependent<TElem>())
+                                              && (!array_list_elem_read_may_fail<TElem>::value);
+                };
+
+                /// @brief Check whether the elements can be decoded on demand, i.e. they have
+                ///     fixed serialization length and their read (or validity) doesn't depend
+                ///     on anything but the length of the data.
+                template<typename TElem>
+                struct array_list_elem_is_lazy_decodable {
+                    static const bool value
+                        = array_list_elem_lazy_decodable_helper<TElem, std::is_integral<TElem>::value>::value;
+                };
+
+                template<typename TElem, bool TIsNumericField>
+                struct array_list_numeric_field_is_plain_helper {
+                    static const bool value = false;
+                };
+
+                template<typename TElem>
+                struct array_list_numeric_field_is_plain_helper<TElem, true> {
+                    using parsed_options_type = typename TElem::parsed_options_type;
+
+                    static const bool value
+                        = (!parsed_options_type::has_custom_value_reader) && (!parsed_options_type::has_custom_read)
+                          && (!parsed_options_type::has_ser_offset) && (!parsed_options_type::has_fixed_length_limit)
+                          && (!parsed_options_type::has_fixed_bit_length_limit)
+                          && (!parsed_options_type::has_var_length_limits)
+                          && (!parsed_options_type::has_fail_on_invalid) && (!parsed_options_type::has_ignore_invalid)
+                          && (!parsed_options_type::has_empty_serialization)
+                          && (!parsed_options_type::has_versions_range) && (!TElem::is_version_dependent())
+                          && (TElem::min_length() == sizeof(typename TElem::value_type))
+                          && (TElem::max_length() == sizeof(typename TElem::value_type));
+                };
+
+                /// @brief Check whether the elements of the list can be serialized as a
+                ///     single block of values of the same arithmetic type.
+                /// @details It is true for raw integral elements, as well as for
+                ///     nil::marshalling::types::integral and nil::marshalling::types::float_value
+                ///     fields, which don't use any options that change the serialization.
+                template<typename TElem, typename TEndian, bool TIntegral = std::is_integral<TElem>::value>
+                struct array_list_elem_bulk_access;
+
+                template<typename TElem, typename TEndian>
+                struct array_list_elem_bulk_access<TElem, TEndian, true> {
+                    static const bool value = !std::is_same<TElem, bool>::value;
+                    using value_type = TElem;
+                    using endian_type = TEndian;
+                };
+
+                template<typename TElem, typename TEndian>
+                struct array_list_elem_bulk_access<TElem, TEndian, false> {
+                    static const bool value = array_list_numeric_field_is_plain_helper<
+                        TElem, nil::marshalling::is_integral<TElem>::value
+                                   || nil::marshalling::is_float_value<TElem>::value>::value;
+
+                    using value_type = typename std::conditional<value, typename TElem::value_type, std::uint8_t>::type;
+                    using endian_type = typename std::conditional<value, typename TElem::endian_type, TEndian>::type;
+                };
+
+                template<typename TField>
+                struct array_list_is_numeric_field_type {
+                    static const bool value = false;
+                };
+
+                template<typename TFieldBase, typename T, typename... TOptions>
+                struct array_list_is_numeric_field_type<types::integral<TFieldBase, T, TOptions...>> {
+                    static const bool value = true;
+                };
+
+                template<typename TFieldBase, typename TEnum, typename... TOptions>
+                struct array_list_is_numeric_field_type<types::enumeration<TFieldBase, TEnum, TOptions...>> {
+                    static const bool value = true;
+                };
+
+                template<typename TFieldBase, typename T, typename... TOptions>
+                struct array_list_is_numeric_field_type<types::float_value<TFieldBase, T, TOptions...>> {
+                    static const bool value = true;
+                };
+
+                template<typename TElem, bool TIsNumericField>
+                struct array_list_elem_range_validation_helper {
+                    static const bool value = false;
+                };
+
+                template<typename TElem>
+                struct array_list_elem_range_validation_helper<TElem, true> {
+                    template<typename TClass>
+                    static TClass valid_owner(bool (TClass::*)() const);
+
+                    using valid_owner_type = decltype(valid_owner(&TElem::valid));
+                    using parsed_options_type = typename TElem::parsed_options_type;
+
+                    static const bool value = array_list_is_numeric_field_type<valid_owner_type>::value
+                                              && parsed_options_type::has_multi_range_validation
+                                              && (!parsed_options_type::has_custom_validator);
+                };
+
+                /// @brief Check whether the validity of the elements of the list is defined
+                ///     only by the valid values ranges.
+                /// @details It is true for nil::marshalling::types::integral,
+                ///     nil::marshalling::types::enumeration and nil::marshalling::types::float_value
+                ///     fields with nil::marshalling::option::valid_num_value_range options and
+                ///     without custom validator, unless the @b valid() member function is
+                ///     redefined by the element class.
+                template<typename TElem>
+                struct array_list_elem_range_validation {
+                    static const bool value = array_list_elem_range_validation_helper<
+                        TElem, nil::marshalling::is_integral<TElem>::value
+                                   || nil::marshalling::is_enumeration<TElem>::value
+                                   || nil::marshalling::is_float_value<TElem>::value>::value;
+                };
+
             }    // namespace detail
         }        // namespace types
     }            // namespace marshalling
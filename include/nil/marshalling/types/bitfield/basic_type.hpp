@@ -174,6 +174,145 @@ namespace nil {
                     }
 
                 private:
+                    struct direct_member_tag { };
+                    struct buffered_member_tag { };
+                    struct must_sign_ext_tag { };
+                    struct no_sign_ext_tag { };
+
+                    template<typename TField>
+                    using member_access_tag =
+                        typename std::conditional<detail::is_bitfield_member_direct_accessible<TField>::value,
+                                                  direct_member_tag,
+                                                  buffered_member_tag>::type;
+
+                    template<typename TField>
+                    struct member_sign_ext_check {
+                        using raw_type = detail::bitfield_member_raw_type<TField>;
+                        using unsigned_raw_type = typename std::make_unsigned<raw_type>::type;
+
+                        static const bool value
+                            = std::is_signed<raw_type>::value
+                              && (detail::bitfield_member_length_retriever<TField>::value
+                                  < static_cast<std::size_t>(std::numeric_limits<unsigned_raw_type>::digits));
+                    };
+
+                    template<typename TField>
+                    using member_sign_ext_tag = typename std::conditional<member_sign_ext_check<TField>::value,
+                                                                          must_sign_ext_tag,
+                                                                          no_sign_ext_tag>::type;
+
+                    template<std::size_t TIdx, typename TField>
+                    struct member_bits {
+                        static const std::size_t length = detail::bitfield_member_length_retriever<TField>::value;
+                        static const std::size_t pos = detail::get_member_shift_pos<TIdx, value_type>();
+                        static const serialized_type mask = (static_cast<serialized_type>(1) << length) - 1;
+                    };
+
+                    template<typename TField>
+                    static status_type read_member(TField &field, serialized_type fieldSerValue, direct_member_tag) {
+                        read_member_no_status(field, fieldSerValue, direct_member_tag());
+                        return status_type::success;
+                    }
+
+                    template<typename TField>
+                    static status_type read_member(TField &field, serialized_type fieldSerValue, buffered_member_tag) {
+                        static const std::size_t max_length = TField::max_length();
+                        std::uint8_t buf[max_length];
+                        auto *writeIter = &buf[0];
+                        using FieldEndian = typename TField::endian_type;
+                        processing::write_data<max_length>(fieldSerValue, writeIter, FieldEndian());
+
+                        const auto *readIter = &buf[0];
+                        return field.read(readIter, max_length);
+                    }
+
+                    template<typename TField>
+                    static void read_member_no_status(TField &field, serialized_type fieldSerValue,
+                                                      direct_member_tag) {
+                        using raw_type = detail::bitfield_member_raw_type<TField>;
+                        using unsigned_raw_type = typename std::make_unsigned<raw_type>::type;
+
+                        auto rawValue
+                            = sign_ext<TField>(static_cast<unsigned_raw_type>(fieldSerValue), member_sign_ext_tag<TField>());
+                        field.value() = static_cast<typename TField::value_type>(static_cast<raw_type>(rawValue));
+                    }
+
+                    template<typename TField>
+                    static void read_member_no_status(TField &field, serialized_type fieldSerValue,
+                                                      buffered_member_tag) {
+                        static const std::size_t max_length = TField::max_length();
+                        std::uint8_t buf[max_length];
+                        auto *writeIter = &buf[0];
+                        using FieldEndian = typename TField::endian_type;
+                        processing::write_data<max_length>(fieldSerValue, writeIter, FieldEndian());
+
+                        const auto *readIter = &buf[0];
+                        field.read_no_status(readIter);
+                    }
+
+                    template<typename TField, typename TUnsigned>
+                    static TUnsigned sign_ext(TUnsigned val, must_sign_ext_tag) {
+                        static const std::size_t length = detail::bitfield_member_length_retriever<TField>::value;
+                        static const TUnsigned SignExtMask
+                            = static_cast<TUnsigned>(~((static_cast<TUnsigned>(1U) << length) - 1));
+                        static const TUnsigned SignMask
+                            = static_cast<TUnsigned>(static_cast<TUnsigned>(1U) << (length - 1));
+
+                        if ((val & SignMask) != 0) {
+                            val = static_cast<TUnsigned>(val | SignExtMask);
+                        }
+                        return val;
+                    }
+
+                    template<typename TField, typename TUnsigned>
+                    static TUnsigned sign_ext(TUnsigned val, no_sign_ext_tag) {
+                        return val;
+                    }
+
+                    template<typename TField>
+                    static status_type write_member(const TField &field, serialized_type &fieldSerValue,
+                                                    direct_member_tag) {
+                        fieldSerValue = write_member_no_status(field, direct_member_tag());
+                        return status_type::success;
+                    }
+
+                    template<typename TField>
+                    static status_type write_member(const TField &field, serialized_type &fieldSerValue,
+                                                    buffered_member_tag) {
+                        static const std::size_t max_length = TField::max_length();
+                        std::uint8_t buf[max_length];
+                        auto *writeIter = &buf[0];
+                        auto es = field.write(writeIter, max_length);
+                        if (es != status_type::success) {
+                            return es;
+                        }
+
+                        using FieldEndian = typename TField::endian_type;
+                        const auto *readIter = &buf[0];
+                        fieldSerValue = processing::read_data<serialized_type, max_length>(readIter, FieldEndian());
+                        return status_type::success;
+                    }
+
+                    template<typename TField>
+                    static serialized_type write_member_no_status(const TField &field, direct_member_tag) {
+                        using raw_type = detail::bitfield_member_raw_type<TField>;
+                        using unsigned_raw_type = typename std::make_unsigned<raw_type>::type;
+                        return static_cast<serialized_type>(
+                            static_cast<unsigned_raw_type>(static_cast<raw_type>(field.value())));
+                    }
+
+                    template<typename TField>
+                    static serialized_type write_member_no_status(const TField &field, buffered_member_tag) {
+                        static const std::size_t max_length = TField::max_length();
+                        std::uint8_t buf[max_length];
+                        auto *writeIter = &buf[0];
+                        field.write_no_status(writeIter);
+
+                        using FieldEndian = typename TField::endian_type;
+                        const auto *readIter = &buf[0];
+                        return processing::read_data<serialized_type, max_length>(readIter, FieldEndian());
+                    }
+
                     class read_helper {
                     public:
                         read_helper(serialized_type val, status_type &es) : value_(val), es_(es) {
@@ -186,25 +325,13 @@ namespace nil {
                             }
 
                             using field_type = typename std::decay<decltype(field)>::type;
-                            static const auto Pos = detail::get_member_shift_pos<TIdx, value_type>();
-                            static const auto Mask = (static_cast<serialized_type>(1)
-                                                      << detail::bitfield_member_length_retriever<field_type>::value)
-                                                     - 1;
-
-                            auto fieldSerValue = static_cast<serialized_type>((value_ >> Pos) & Mask);
+                            using bits = member_bits<TIdx, field_type>;
 
                             static_assert(field_type::min_length() == field_type::max_length(),
                                           "basic_bitfield doesn't support members with variable length");
 
-                            static const std::size_t max_length = field_type::max_length();
-                            std::uint8_t buf[max_length];
-                            auto *writeIter = &buf[0];
-                            using FieldEndian = typename field_type::endian_type;
-                            processing::write_data<max_length>(
-                                fieldSerValue, writeIter, FieldEndian());
-
-                            const auto *readIter = &buf[0];
-                            es_ = field.read(readIter, max_length);
+                            auto fieldSerValue = static_cast<serialized_type>((value_ >> bits::pos) & bits::mask);
+                            es_ = read_member(field, fieldSerValue, member_access_tag<field_type>());
                         }
 
                     private:
@@ -220,25 +347,13 @@ namespace nil {
                         template<std::size_t TIdx, typename TFieldParam>
                         void operator()(TFieldParam &&field) {
                             using field_type = typename std::decay<decltype(field)>::type;
-                            using FieldOptions = typename field_type::parsed_options_type;
-                            static const auto Pos = detail::get_member_shift_pos<TIdx, value_type>();
-                            static const auto Mask
-                                = (static_cast<serialized_type>(1) << FieldOptions::fixed_bit_length) - 1;
-
-                            auto fieldSerValue = static_cast<serialized_type>((value_ >> Pos) & Mask);
+                            using bits = member_bits<TIdx, field_type>;
 
                             static_assert(field_type::min_length() == field_type::max_length(),
                                           "basic_bitfield doesn't support members with variable length");
 
-                            static const std::size_t max_length = field_type::max_length();
-                            std::uint8_t buf[max_length];
-                            auto *writeIter = &buf[0];
-                            using FieldEndian = typename field_type::endian_type;
-                            processing::write_data<max_length>(
-                                fieldSerValue, writeIter, FieldEndian());
-
-                            const auto *readIter = &buf[0];
-                            field.read_no_status(readIter);
+                            auto fieldSerValue = static_cast<serialized_type>((value_ >> bits::pos) & bits::mask);
+                            read_member_no_status(field, fieldSerValue, member_access_tag<field_type>());
                         }
 
                     private:
@@ -257,34 +372,20 @@ namespace nil {
                             }
 
                             using field_type = typename std::decay<decltype(field)>::type;
+                            using bits = member_bits<TIdx, field_type>;
 
                             static_assert(field_type::min_length() == field_type::max_length(),
                                           "basic_bitfield supports fixed length members only.");
 
-                            static const std::size_t max_length = field_type::max_length();
-                            std::uint8_t buf[max_length];
-                            auto *writeIter = &buf[0];
-                            es_ = field.write(writeIter, max_length);
+                            serialized_type fieldSerValue = 0;
+                            es_ = write_member(field, fieldSerValue, member_access_tag<field_type>());
                             if (es_ != status_type::success) {
                                 return;
                             }
 
-                            using FieldEndian = typename field_type::endian_type;
-                            const auto *readIter = &buf[0];
-                            auto fieldSerValue = processing::read_data<serialized_type, max_length>(
-                                readIter, FieldEndian());
-
-                            static const auto Pos = detail::get_member_shift_pos<TIdx, value_type>();
-                            static const auto Mask = (static_cast<serialized_type>(1)
-                                                      << detail::bitfield_member_length_retriever<field_type>::value)
-                                                     - 1;
-
-                            static const auto ClearMask = ~(Mask << Pos);
-
-                            auto valueMask = (static_cast<serialized_type>(fieldSerValue) & Mask) << Pos;
-
+                            static const auto ClearMask = static_cast<serialized_type>(~(bits::mask << bits::pos));
                             value_ &= ClearMask;
-                            value_ |= valueMask;
+                            value_ |= static_cast<serialized_type>((fieldSerValue & bits::mask) << bits::pos);
                         }
 
                     private:
@@ -299,33 +400,17 @@ namespace nil {
 
                         template<std::size_t TIdx, typename TFieldParam>
                         void operator()(TFieldParam &&field) {
-
                             using field_type = typename std::decay<decltype(field)>::type;
+                            using bits = member_bits<TIdx, field_type>;
 
                             static_assert(field_type::min_length() == field_type::max_length(),
                                           "basic_bitfield supports fixed length members only.");
 
-                            static const std::size_t max_length = field_type::max_length();
-                            std::uint8_t buf[max_length];
-                            auto *writeIter = &buf[0];
-                            field.write_no_status(writeIter);
-
-                            using FieldEndian = typename field_type::endian_type;
-                            const auto *readIter = &buf[0];
-                            auto fieldSerValue = processing::read_data<serialized_type, max_length>(
-                                readIter, FieldEndian());
-
-                            using FieldOptions = typename field_type::parsed_options_type;
-                            static const auto Pos = detail::get_member_shift_pos<TIdx, value_type>();
-                            static const auto Mask
-                                = (static_cast<serialized_type>(1) << FieldOptions::fixed_bit_length) - 1;
-
-                            static const auto ClearMask = ~(Mask << Pos);
-
-                            auto valueMask = (static_cast<serialized_type>(fieldSerValue) & Mask) << Pos;
+                            auto fieldSerValue = write_member_no_status(field, member_access_tag<field_type>());
 
+                            static const auto ClearMask = static_cast<serialized_type>(~(bits::mask << bits::pos));
                             value_ &= ClearMask;
-                            value_ |= valueMask;
+                            value_ |= static_cast<serialized_type>((fieldSerValue & bits::mask) << bits::pos);
                         }
 
                     private:
@@ -38,6 +38,7 @@
 #include <nil/marshalling/status_type.hpp>
 
 #include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/types/tag.hpp>
 
 namespace nil {
     namespace marshalling {
@@ -108,6 +109,72 @@ namespace nil {
                     return bitfield_pos_retrieve_helper<TIdx, TMembers>::value;
                 }
 
+                template<typename TField, bool TIsEnum>
+                struct bitfield_member_raw_type_retrieve_helper {
+                    using type = typename TField::value_type;
+                };
+
+                template<typename TField>
+                struct bitfield_member_raw_type_retrieve_helper<TField, true> {
+                    using type = typename std::underlying_type<typename TField::value_type>::type;
+                };
+
+                /// @brief Integral type used to store the value of the bitfield member.
+                /// @details Same as value_type for integral and bitmask members, underlying
+                ///     type of the enum for enumeration members.
+                template<typename TField>
+                using bitfield_member_raw_type = typename bitfield_member_raw_type_retrieve_helper<
+                    TField,
+                    std::is_enum<typename TField::value_type>::value>::type;
+
+                template<typename TField>
+                struct bitfield_member_tag_check {
+                    using tag = typename TField::tag;
+                    static const bool value = std::is_same<tag, types::tag::integral>::value
+                                              || std::is_same<tag, types::tag::enumeration>::value
+                                              || std::is_same<tag, types::tag::bitmask>::value;
+                };
+
+                template<typename TField, bool TIsNumeric>
+                struct bitfield_member_direct_access_helper {
+                    static const bool value = false;
+                };
+
+                template<typename TField>
+                struct bitfield_member_direct_access_helper<TField, true> {
+                    using parsed_options_type = typename TField::parsed_options_type;
+
+                    static const bool has_plain_read
+                        = (!parsed_options_type::has_ser_offset) && (!parsed_options_type::has_custom_value_reader)
+                          && (!parsed_options_type::has_custom_read) && (!parsed_options_type::has_fail_on_invalid)
+                          && (!parsed_options_type::has_ignore_invalid)
+                          && (!parsed_options_type::has_var_length_limits)
+                          && (!parsed_options_type::has_versions_range)
+                          && (!parsed_options_type::has_empty_serialization);
+
+                    static const bool has_plain_length
+                        = parsed_options_type::has_fixed_bit_length_limit
+                          || ((!parsed_options_type::has_fixed_length_limit)
+                              && (!std::is_signed<bitfield_member_raw_type<TField>>::value));
+
+                    static const bool value = has_plain_read && has_plain_length;
+                };
+
+                /// @brief Check whether the bitfield member can be extracted from / inserted
+                ///     into the serialized value of the bitfield using plain shift and mask.
+                /// @details Applicable to integral, enumeration and bitmask members, which
+                ///     don't use any option that modifies the way the value is serialized
+                ///     (serialization offset, custom readers, validity checks on read, etc...).
+                ///     Signed members are expected to specify their length using
+                ///     nil::marshalling::option::fixed_bit_length, the sign extension is
+                ///     performed the same way as the nil::marshalling::option::fixed_bit_length
+                ///     adapter does.
+                template<typename TField>
+                struct is_bitfield_member_direct_accessible {
+                    static const bool value
+                        = bitfield_member_direct_access_helper<TField, bitfield_member_tag_check<TField>::value>::value;
+                };
+
             }    // namespace detail
         }        // namespace types
     }            // namespace marshalling
@@ -35,6 +35,7 @@
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/processing/tuple.hpp>
 
+#include <nil/marshalling/types/bundle/type_traits.hpp>
 #include <nil/marshalling/types/detail/common_funcs.hpp>
 
 namespace nil {
@@ -158,33 +159,22 @@ namespace nil {
 
                     template<typename TIter>
                     status_type read(TIter &iter, std::size_t len) {
-                        status_type es = status_type::success;
-                        processing::tuple_for_each(value(), make_read_helper(es, iter, len));
-                        return es;
+                        return read_from_until<0, std::tuple_size<value_type>::value>(iter, len);
                     }
 
                     template<std::size_t TFromIdx, typename TIter>
                     status_type read_from(TIter &iter, std::size_t len) {
-                        status_type es = status_type::success;
-                        processing::template tuple_for_each_from<TFromIdx>(
-                            value(), make_read_helper(es, iter, len));
-                        return es;
+                        return read_from_until<TFromIdx, std::tuple_size<value_type>::value>(iter, len);
                     }
 
                     template<std::size_t TUntilIdx, typename TIter>
                     status_type read_until(TIter &iter, std::size_t len) {
-                        status_type es = status_type::success;
-                        processing::template tuple_for_each_until<TUntilIdx>(
-                            value(), make_read_helper(es, iter, len));
-                        return es;
+                        return read_from_until<0, TUntilIdx>(iter, len);
                     }
 
                     template<std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter>
                     status_type read_from_until(TIter &iter, std::size_t len) {
-                        status_type es = status_type::success;
-                        processing::template tuple_for_each_from_until<TFromIdx, TUntilIdx>(
-                            value(), make_read_helper(es, iter, len));
-                        return es;
+                        return read_from_until_internal<TFromIdx, TUntilIdx>(iter, len, layout_tag());
                     }
 
                     template<typename TIter>
@@ -212,33 +202,22 @@ namespace nil {
 
                     template<typename TIter>
                     status_type write(TIter &iter, std::size_t len) const {
-                        status_type es = status_type::success;
-                        processing::tuple_for_each(value(), make_write_helper(es, iter, len));
-                        return es;
+                        return write_from_until<0, std::tuple_size<value_type>::value>(iter, len);
                     }
 
                     template<std::size_t TFromIdx, typename TIter>
                     status_type write_from(TIter &iter, std::size_t len) const {
-                        status_type es = status_type::success;
-                        processing::template tuple_for_each_from<TFromIdx>(
-                            value(), make_write_helper(es, iter, len));
-                        return es;
+                        return write_from_until<TFromIdx, std::tuple_size<value_type>::value>(iter, len);
                     }
 
                     template<std::size_t TUntilIdx, typename TIter>
                     status_type write_until(TIter &iter, std::size_t len) const {
-                        status_type es = status_type::success;
-                        processing::template tuple_for_each_until<TUntilIdx>(
-                            value(), make_write_helper(es, iter, len));
-                        return es;
+                        return write_from_until<0, TUntilIdx>(iter, len);
                     }
 
                     template<std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter>
                     status_type write_from_until(TIter &iter, std::size_t len) const {
-                        status_type es = status_type::success;
-                        processing::template tuple_for_each_from_until<TFromIdx, TUntilIdx>(
-                            value(), make_write_helper(es, iter, len));
-                        return es;
+                        return write_from_until_internal<TFromIdx, TUntilIdx>(iter, len, layout_tag());
                     }
 
                     template<typename TIter>
@@ -273,6 +252,49 @@ namespace nil {
                     }
 
                 private:
+                    struct fixed_layout_tag { };
+                    struct variable_layout_tag { };
+
+                    using layout_tag = typename std::conditional<detail::are_fixed_layout_members<value_type>::value,
+                                                                 fixed_layout_tag,
+                                                                 variable_layout_tag>::type;
+
+                    template<std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter>
+                    status_type read_from_until_internal(TIter &iter, std::size_t len, variable_layout_tag) {
+                        status_type es = status_type::success;
+                        processing::template tuple_for_each_from_until<TFromIdx, TUntilIdx>(
+                            value(), make_read_helper(es, iter, len));
+                        return es;
+                    }
+
+                    template<std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter>
+                    status_type read_from_until_internal(TIter &iter, std::size_t len, fixed_layout_tag) {
+                        if (len < max_length_from_until<TFromIdx, TUntilIdx>()) {
+                            return status_type::not_enough_data;
+                        }
+
+                        read_from_until_no_status<TFromIdx, TUntilIdx>(iter);
+                        return status_type::success;
+                    }
+
+                    template<std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter>
+                    status_type write_from_until_internal(TIter &iter, std::size_t len, variable_layout_tag) const {
+                        status_type es = status_type::success;
+                        processing::template tuple_for_each_from_until<TFromIdx, TUntilIdx>(
+                            value(), make_write_helper(es, iter, len));
+                        return es;
+                    }
+
+                    template<std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter>
+                    status_type write_from_until_internal(TIter &iter, std::size_t len, fixed_layout_tag) const {
+                        if (len < max_length_from_until<TFromIdx, TUntilIdx>()) {
+                            return status_type::buffer_overflow;
+                        }
+
+                        write_from_until_no_status<TFromIdx, TUntilIdx>(iter);
+                        return status_type::success;
+                    }
+
                     struct length_calc_helper {
                         template<typename TField>
                         constexpr std::size_t operator()(std::size_t sum, const TField &field) const {
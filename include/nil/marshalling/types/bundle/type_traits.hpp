@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_BASIC_BUNDLE_TYPE_TRAITS_HPP
+#define MARSHALLING_BASIC_BUNDLE_TYPE_TRAITS_HPP
+
+#include <tuple>
+#include <type_traits>
+
+#include <nil/marshalling/types/tag.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace types {
+            namespace detail {
+
+                template<typename TField>
+                struct is_fixed_layout_field;
+
+                template<typename TMembers>
+                struct are_fixed_layout_members;
+
+                template<>
+                struct are_fixed_layout_members<std::tuple<>> {
+                    static const bool value = true;
+                };
+
+                template<typename TFirst, typename... TRest>
+                struct are_fixed_layout_members<std::tuple<TFirst, TRest...>> {
+                    static const bool value
+                        = is_fixed_layout_field<TFirst>::value && are_fixed_layout_members<std::tuple<TRest...>>::value;
+                };
+
+                template<typename TField, typename TTag>
+                struct fixed_layout_field_tag_check {
+                    static const bool value = std::is_same<TTag, types::tag::integral>::value
+                                              || std::is_same<TTag, types::tag::enumeration>::value
+                                              || std::is_same<TTag, types::tag::bitmask>::value
+                                              || std::is_same<TTag, types::tag::floating_point>::value
+                                              || std::is_same<TTag, types::tag::no_value>::value;
+                };
+
+                template<typename TField>
+                struct fixed_layout_field_tag_check<TField, types::tag::bitfield> {
+                    static const bool value = are_fixed_layout_members<typename TField::value_type>::value;
+                };
+
+                template<typename TField>
+                struct fixed_layout_field_tag_check<TField, types::tag::bundle> {
+                    static const bool value = are_fixed_layout_members<typename TField::value_type>::value;
+                };
+
+                /// @brief Check whether the field has constant serialization length and
+                ///     its @b read() can fail only due to insufficient input.
+                /// @details Such fields can be read with @b read_no_status() once the
+                ///     availability of the required amount of data is checked. Bitfields and
+                ///     bundles are checked recursively, so the nested ones are merged into
+                ///     the fixed layout of the parent bundle.
+                template<typename TField>
+                struct is_fixed_layout_field {
+                    using parsed_options_type = typename TField::parsed_options_type;
+
+                    static const bool has_plain_read
+                        = (!parsed_options_type::has_custom_read) && (!parsed_options_type::has_custom_value_reader)
+                          && (!parsed_options_type::has_fail_on_invalid)
+                          && (!parsed_options_type::has_ignore_invalid)
+                          && (!parsed_options_type::has_versions_range);
+
+                    static const bool value = (TField::min_length() == TField::max_length()) && has_plain_read
+                                              && fixed_layout_field_tag_check<TField, typename TField::tag>::value;
+                };
+
+            }    // namespace detail
+        }        // namespace types
+    }            // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_BASIC_BUNDLE_TYPE_TRAITS_HPP
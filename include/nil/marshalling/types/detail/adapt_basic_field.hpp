@@ -41,16 +41,19 @@
 #include <nil/marshalling/types/adapter/sequence_elem_fixed_ser_length_field_prefix.hpp>
 #include <nil/marshalling/types/adapter/sequence_trailing_field_suffix.hpp>
 #include <nil/marshalling/types/adapter/sequence_termination_field_suffix.hpp>
+#include <nil/marshalling/types/adapter/sequence_group_varint.hpp>
 #include <nil/marshalling/types/adapter/default_value_initializer.hpp>
 #include <nil/marshalling/types/adapter/num_value_multi_range_validator.hpp>
 #include <nil/marshalling/types/adapter/custom_validator.hpp>
 #include <nil/marshalling/types/adapter/custom_refresher.hpp>
 #include <nil/marshalling/types/adapter/fail_on_invalid.hpp>
 #include <nil/marshalling/types/adapter/ignore_invalid.hpp>
+#include <nil/marshalling/types/adapter/memory_resource_binding.hpp>
 #include <nil/marshalling/types/adapter/empty_serialization.hpp>
 #include <nil/marshalling/types/adapter/exists_between_versions.hpp>
 #include <nil/marshalling/types/adapter/invalid_by_default.hpp>
 #include <nil/marshalling/types/adapter/version_storage.hpp>
+#include <nil/marshalling/types/adapter/variant_key_dispatch.hpp>
 
 #include <nil/marshalling/types/detail/options_parser.hpp>
 
@@ -90,6 +93,26 @@ namespace nil {
                 using adapt_field_version_storage_type =
                     typename adapt_field_version_storage<TOpts::has_version_storage>::template type<TField>;
 
+                template<bool THasVariantKeyDispatch>
+                struct adapt_field_variant_key_dispatch;
+
+                template<>
+                struct adapt_field_variant_key_dispatch<true> {
+                    template<typename TField, typename TOpts>
+                    using type = types::adapter::variant_key_dispatch<typename TOpts::variant_key_field, TField>;
+                };
+
+                template<>
+                struct adapt_field_variant_key_dispatch<false> {
+                    template<typename TField, typename TOpts>
+                    using type = TField;
+                };
+
+                template<typename TField, typename TOpts>
+                using adapt_field_variant_key_dispatch_type =
+                    typename adapt_field_variant_key_dispatch<TOpts::has_variant_key_dispatch>::template type<TField,
+                                                                                                           TOpts>;
+
                 template<bool THasInvalidByDefault>
                 struct adapt_field_invalid_by_default;
 
@@ -249,6 +272,25 @@ namespace nil {
                 using adapt_field_sequence_elem_length_forcing_type = typename adapt_field_sequence_elem_length_forcing<
                     TOpts::has_sequence_elem_length_forcing>::template type<TField>;
 
+                template<bool THasSequenceGroupVarint>
+                struct adapt_field_sequence_group_varint;
+
+                template<>
+                struct adapt_field_sequence_group_varint<true> {
+                    template<typename TField>
+                    using type = types::adapter::sequence_group_varint<TField>;
+                };
+
+                template<>
+                struct adapt_field_sequence_group_varint<false> {
+                    template<typename TField>
+                    using type = TField;
+                };
+
+                template<typename TField, typename TOpts>
+                using adapt_field_sequence_group_varint_type =
+                    typename adapt_field_sequence_group_varint<TOpts::has_sequence_group_varint>::template type<TField>;
+
                 template<bool THasSequenceSizeForcing>
                 struct adapt_field_sequence_size_forcing;
 
@@ -547,6 +589,25 @@ namespace nil {
                 using adapt_field_fail_on_invalid_type =
                     typename adapt_field_fail_on_invalid<TOpts::has_fail_on_invalid>::template type<TField, TOpts>;
 
+                template<bool THasMemoryResourceStorage>
+                struct adapt_field_memory_resource_binding;
+
+                template<>
+                struct adapt_field_memory_resource_binding<true> {
+                    template<typename TField>
+                    using type = types::adapter::memory_resource_binding<TField>;
+                };
+
+                template<>
+                struct adapt_field_memory_resource_binding<false> {
+                    template<typename TField>
+                    using type = TField;
+                };
+
+                template<typename TField, typename TOpts>
+                using adapt_field_memory_resource_binding_type = typename adapt_field_memory_resource_binding<
+                    TOpts::has_memory_resource_storage>::template type<TField>;
+
                 template<bool THasIgnoreInvalid>
                 struct adapt_field_ignore_invalid;
 
@@ -652,11 +713,16 @@ namespace nil {
                                   "fail_on_invalid, ignore_invalid");
 
                     static_assert(
-                        1U >= fields_options_compatibility_calc<parsed_options_type::has_custom_value_reader,
-                                                                parsed_options_type::has_fixed_size_storage,
-                                                                parsed_options_type::has_orig_data_view>::value,
+                        1U >= fields_options_compatibility_calc<
+                                  parsed_options_type::has_custom_value_reader,
+                                  parsed_options_type::has_fixed_size_storage,
+                                  parsed_options_type::has_orig_data_view,
+                                  parsed_options_type::has_memory_resource_storage,
+                                  parsed_options_type::has_small_buffer_storage,
+                                  parsed_options_type::has_lazy_elements_view>::value,
                         "The following options are incompatible, cannot be used together: "
-                        "custom_storage_type, fixed_size_storage, orig_data_view");
+                        "custom_storage_type, fixed_size_storage, orig_data_view, memory_resource_storage, "
+                        "small_buffer_storage, lazy_elements_view");
 
                     static_assert(
                         (!parsed_options_type::has_sequence_fixed_size_use_fixed_size_storage)
@@ -668,7 +734,10 @@ namespace nil {
                                   "The following options are incompatible, cannot be used together: "
                                   "SequenceFixedSizeUseFixedSizeStorage, fixed_size_storage");
 
-                    using invalid_by_default_adapted = adapt_field_invalid_by_default_type<TBasic, parsed_options_type>;
+                    using variant_key_dispatch_adapted
+                        = adapt_field_variant_key_dispatch_type<TBasic, parsed_options_type>;
+                    using invalid_by_default_adapted
+                        = adapt_field_invalid_by_default_type<variant_key_dispatch_adapted, parsed_options_type>;
                     using version_storage_adapted
                         = adapt_field_version_storage_type<invalid_by_default_adapted, parsed_options_type>;
                     using custom_reader_adapted
@@ -691,9 +760,11 @@ namespace nil {
                         = adapt_field_sequence_elem_fixed_ser_length_field_prefix_type<
                             sequence_elem_ser_length_field_prefix_adapted,
                             parsed_options_type>;
-                    using sequence_size_forcing_adapted
-                        = adapt_field_sequence_size_forcing_type<sequence_elem_fixed_ser_length_field_prefix_adapted,
+                    using sequence_group_varint_adapted
+                        = adapt_field_sequence_group_varint_type<sequence_elem_fixed_ser_length_field_prefix_adapted,
                                                                  parsed_options_type>;
+                    using sequence_size_forcing_adapted
+                        = adapt_field_sequence_size_forcing_type<sequence_group_varint_adapted, parsed_options_type>;
                     using sequence_length_forcing_adapted
                         = adapt_field_sequence_length_forcing_type<sequence_size_forcing_adapted, parsed_options_type>;
                     using sequence_fixed_size_adapted
@@ -720,8 +791,10 @@ namespace nil {
                                                             parsed_options_type>;
                     using custom_refresher_adapted
                         = adapt_field_custom_refresher_type<custom_validator_adapted, parsed_options_type>;
+                    using memory_resource_binding_adapted
+                        = adapt_field_memory_resource_binding_type<custom_refresher_adapted, parsed_options_type>;
                     using fail_on_invalid_adapted
-                        = adapt_field_fail_on_invalid_type<custom_refresher_adapted, parsed_options_type>;
+                        = adapt_field_fail_on_invalid_type<memory_resource_binding_adapted, parsed_options_type>;
                     using ignore_invalid_adapted
                         = adapt_field_ignore_invalid_type<fail_on_invalid_adapted, parsed_options_type>;
                     using empty_serialization_adapted
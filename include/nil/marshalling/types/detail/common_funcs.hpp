@@ -85,7 +85,7 @@ namespace nil {
                                                                         std::size_t len) {
                         status_type es = status_type::success;
                         auto remainingLen = len;
-                        for (auto &elem : field.value()) {
+                        for (const auto &elem : field.value()) {
                             es = field.write_element(elem, iter, remainingLen);
                             if (es != status_type::success) {
                                 break;
@@ -97,7 +97,7 @@ namespace nil {
 
                     template<typename TField, typename TIter>
                     static void write_sequence_no_status(TField &field, TIter &iter) {
-                        for (auto &elem : field.value()) {
+                        for (const auto &elem : field.value()) {
                             field.write_element_no_status(elem, iter);
                         }
                     }
@@ -106,7 +106,7 @@ namespace nil {
                     static status_type write_sequence_n(const TField &field, std::size_t count,
                                                                           TIter &iter, std::size_t &len) {
                         status_type es = status_type::success;
-                        for (auto &elem : field.value()) {
+                        for (const auto &elem : field.value()) {
                             if (count == 0) {
                                 break;
                             }
@@ -124,7 +124,7 @@ namespace nil {
 
                     template<typename TField, typename TIter>
                     static void write_sequence_no_status_n(const TField &field, std::size_t count, TIter &iter) {
-                        for (auto &elem : field.value()) {
+                        for (const auto &elem : field.value()) {
                             if (count == 0) {
                                 break;
                             }
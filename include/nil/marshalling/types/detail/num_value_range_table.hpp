@@ -0,0 +1,438 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_NUM_VALUE_RANGE_TABLE_HPP
+#define MARSHALLING_NUM_VALUE_RANGE_TABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include <nil/detail/type_traits.hpp>
+
+#include <nil/marshalling/processing/tuple.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace types {
+            namespace detail {
+
+                template<typename T, bool TIsEnum = std::is_enum<T>::value>
+                struct num_value_range_compare_type {
+                    using type = T;
+                };
+
+                template<typename T>
+                struct num_value_range_compare_type<T, true> {
+                    using type = typename std::underlying_type<T>::type;
+                };
+
+                /// @brief Bounds of the single valid values range converted to the value type.
+                template<typename T, typename TRange>
+                struct num_value_range_bounds {
+                    static_assert(nil::detail::is_tuple<TRange>::value, "TRange must be a tuple");
+                    static_assert(std::tuple_size<TRange>::value == 2, "Tuple with 2 elements is expected");
+
+                    using compare_type = typename num_value_range_compare_type<T>::type;
+                    using min_type = typename std::tuple_element<0, TRange>::type;
+                    using max_type = typename std::tuple_element<1, TRange>::type;
+
+                    static_assert(min_type::value <= max_type::value, "Invalid range");
+
+                    static constexpr compare_type min() {
+                        return static_cast<compare_type>(static_cast<T>(min_type::value));
+                    }
+
+                    static constexpr compare_type max() {
+                        return static_cast<compare_type>(static_cast<T>(max_type::value));
+                    }
+
+                    // The conversion to the narrow value type may invert the range,
+                    // then it doesn't contain any value.
+                    static constexpr bool empty() {
+                        return max() < min();
+                    }
+                };
+
+                template<typename TFirst, typename TRest>
+                struct num_value_ranges_prepend;
+
+                template<typename TFirst, typename... TRest>
+                struct num_value_ranges_prepend<TFirst, std::tuple<TRest...>> {
+                    using type = std::tuple<TFirst, TRest...>;
+                };
+
+                template<typename T, typename TRange, typename TSorted, bool TBefore>
+                struct num_value_ranges_insert_step;
+
+                template<typename T, typename TRange, typename TSorted>
+                struct num_value_ranges_insert;
+
+                template<typename T, typename TRange>
+                struct num_value_ranges_insert<T, TRange, std::tuple<>> {
+                    using type = std::tuple<TRange>;
+                };
+
+                template<typename T, typename TRange, typename TFirst, typename... TRest>
+                struct num_value_ranges_insert<T, TRange, std::tuple<TFirst, TRest...>> {
+                    using type = typename num_value_ranges_insert_step<
+                        T, TRange, std::tuple<TFirst, TRest...>,
+                        (num_value_range_bounds<T, TRange>::min() <= num_value_range_bounds<T, TFirst>::min())>::type;
+                };
+
+                template<typename T, typename TRange, typename TFirst, typename... TRest>
+                struct num_value_ranges_insert_step<T, TRange, std::tuple<TFirst, TRest...>, true> {
+                    using type = std::tuple<TRange, TFirst, TRest...>;
+                };
+
+                template<typename T, typename TRange, typename TFirst, typename... TRest>
+                struct num_value_ranges_insert_step<T, TRange, std::tuple<TFirst, TRest...>, false> {
+                    using type = typename num_value_ranges_prepend<
+                        TFirst, typename num_value_ranges_insert<T, TRange, std::tuple<TRest...>>::type>::type;
+                };
+
+                /// @brief Sort the ranges by their minimal value dropping the empty ones.
+                template<typename T, typename TRanges>
+                struct num_value_ranges_sort;
+
+                template<typename T>
+                struct num_value_ranges_sort<T, std::tuple<>> {
+                    using type = std::tuple<>;
+                };
+
+                template<typename T, typename TFirst, typename... TRest>
+                struct num_value_ranges_sort<T, std::tuple<TFirst, TRest...>> {
+                    using rest_type = typename num_value_ranges_sort<T, std::tuple<TRest...>>::type;
+                    using type = typename std::conditional<
+                        num_value_range_bounds<T, TFirst>::empty(), rest_type,
+                        typename num_value_ranges_insert<T, TFirst, rest_type>::type>::type;
+                };
+
+                template<typename T, typename TFirst, typename TSecond>
+                struct num_value_ranges_joinable {
+                    using first_bounds = num_value_range_bounds<T, TFirst>;
+                    using second_bounds = num_value_range_bounds<T, TSecond>;
+                    using compare_type = typename first_bounds::compare_type;
+
+                    static const bool value
+                        = (second_bounds::min() <= first_bounds::max())
+                          || (std::is_integral<compare_type>::value
+                              && (first_bounds::max() < std::numeric_limits<compare_type>::max())
+                              && (second_bounds::min() == static_cast<compare_type>(first_bounds::max() + 1)));
+                };
+
+                template<typename T, typename TFirst, typename TSecond>
+                struct num_value_ranges_join {
+                    using max_type = typename std::conditional<(num_value_range_bounds<T, TFirst>::max()
+                                                                < num_value_range_bounds<T, TSecond>::max()),
+                                                               typename std::tuple_element<1, TSecond>::type,
+                                                               typename std::tuple_element<1, TFirst>::type>::type;
+                    using type = std::tuple<typename std::tuple_element<0, TFirst>::type, max_type>;
+                };
+
+                template<typename T, typename TSorted, bool TJoinable>
+                struct num_value_ranges_merge_step;
+
+                /// @brief Merge overlapping and adjacent sorted ranges.
+                template<typename T, typename TSorted>
+                struct num_value_ranges_merge {
+                    using type = TSorted;
+                };
+
+                template<typename T, typename TFirst, typename TSecond, typename... TRest>
+                struct num_value_ranges_merge<T, std::tuple<TFirst, TSecond, TRest...>> {
+                    using type = typename num_value_ranges_merge_step<
+                        T, std::tuple<TFirst, TSecond, TRest...>,
+                        num_value_ranges_joinable<T, TFirst, TSecond>::value>::type;
+                };
+
+                template<typename T, typename TFirst, typename TSecond, typename... TRest>
+                struct num_value_ranges_merge_step<T, std::tuple<TFirst, TSecond, TRest...>, true> {
+                    using type = typename num_value_ranges_merge<
+                        T, std::tuple<typename num_value_ranges_join<T, TFirst, TSecond>::type, TRest...>>::type;
+                };
+
+                template<typename T, typename TFirst, typename TSecond, typename... TRest>
+                struct num_value_ranges_merge_step<T, std::tuple<TFirst, TSecond, TRest...>, false> {
+                    using type = typename num_value_ranges_prepend<
+                        TFirst, typename num_value_ranges_merge<T, std::tuple<TSecond, TRest...>>::type>::type;
+                };
+
+                constexpr std::uint64_t num_value_ranges_bitmap_join() {
+                    return 0U;
+                }
+
+                template<typename... TRest>
+                constexpr std::uint64_t num_value_ranges_bitmap_join(std::uint64_t first, TRest... rest) {
+                    return first | num_value_ranges_bitmap_join(rest...);
+                }
+
+                template<typename TBitmap, typename TIndices>
+                struct num_value_ranges_bitmap_words;
+
+                template<typename TBitmap, std::size_t... TIndices>
+                struct num_value_ranges_bitmap_words<TBitmap, processing::detail::tuple_index_sequence<TIndices...>> {
+                    static constexpr std::uint64_t words_[sizeof...(TIndices)] = {TBitmap::word(TIndices)...};
+                };
+
+                template<typename TBitmap, std::size_t... TIndices>
+                constexpr std::uint64_t num_value_ranges_bitmap_words<
+                    TBitmap, processing::detail::tuple_index_sequence<TIndices...>>::words_[];
+
+                /// @brief Bitmap of the valid values, applicable when the sorted integral
+                ///     ranges span a small number of values.
+                template<typename T, typename TRanges,
+                         bool TIntegral = std::is_integral<typename num_value_range_compare_type<T>::type>::value>
+                struct num_value_ranges_bitmap {
+                    static const bool applicable = false;
+                };
+
+                template<typename T, typename TFirst, typename... TRest>
+                struct num_value_ranges_bitmap<T, std::tuple<TFirst, TRest...>, true> {
+                    using compare_type = typename num_value_range_compare_type<T>::type;
+                    using last_range_type =
+                        typename std::tuple_element<sizeof...(TRest), std::tuple<TFirst, TRest...>>::type;
+
+                    static const std::size_t word_length = std::numeric_limits<std::uint64_t>::digits;
+                    static const std::size_t max_length = 4096U;
+
+                    static const std::uintmax_t last_offset
+                        = static_cast<std::uintmax_t>(num_value_range_bounds<T, last_range_type>::max())
+                          - static_cast<std::uintmax_t>(num_value_range_bounds<T, TFirst>::min());
+
+                    static const bool applicable = (last_offset < max_length);
+
+                    static const std::size_t words_count
+                        = applicable ? static_cast<std::size_t>(last_offset / word_length) + 1U : 1U;
+
+                    static constexpr std::uintmax_t offset(compare_type value) {
+                        return static_cast<std::uintmax_t>(value)
+                               - static_cast<std::uintmax_t>(num_value_range_bounds<T, TFirst>::min());
+                    }
+
+                    template<typename TRange>
+                    static constexpr std::uint64_t range_word(std::size_t wordIdx) {
+                        return range_word_bits(offset(num_value_range_bounds<T, TRange>::min()),
+                                               offset(num_value_range_bounds<T, TRange>::max()),
+                                               wordIdx * word_length);
+                    }
+
+                    static constexpr std::uint64_t word(std::size_t wordIdx) {
+                        return num_value_ranges_bitmap_join(range_word<TFirst>(wordIdx), range_word<TRest>(wordIdx)...);
+                    }
+
+                    static bool contains(compare_type value) {
+                        using words_type = num_value_ranges_bitmap_words<
+                            num_value_ranges_bitmap,
+                            typename processing::detail::tuple_make_index_sequence<words_count>::type>;
+
+                        auto pos = offset(value);
+                        return (pos <= last_offset)
+                               && (((words_type::words_[pos / word_length] >> (pos % word_length)) & 0x1U) != 0U);
+                    }
+
+                private:
+                    static constexpr std::uint64_t range_word_bits(std::uintmax_t from, std::uintmax_t to,
+                                                                   std::uintmax_t wordStart) {
+                        return ((to < wordStart) || ((wordStart + (word_length - 1U)) < from)) ?
+                                   0U :
+                                   ((std::numeric_limits<std::uint64_t>::max()
+                                     >> ((word_length - 1U)
+                                         - ((wordStart + (word_length - 1U)) < to ? word_length - 1U :
+                                                                                   to - wordStart)))
+                                    & (std::numeric_limits<std::uint64_t>::max()
+                                       << (from < wordStart ? 0U : from - wordStart)));
+                    }
+                };
+
+                /// @brief Check of the value against every range.
+                template<typename T, typename... TRanges>
+                struct num_value_ranges_linear {
+                    using compare_type = typename num_value_range_compare_type<T>::type;
+
+                    static constexpr bool contains(compare_type value) {
+                        return static_cast<void>(value), false;
+                    }
+
+                    static constexpr bool matches(compare_type value) {
+                        return static_cast<void>(value), false;
+                    }
+                };
+
+                template<typename T, typename TFirst, typename... TRest>
+                struct num_value_ranges_linear<T, TFirst, TRest...> {
+                    using compare_type = typename num_value_range_compare_type<T>::type;
+                    using bounds_type = num_value_range_bounds<T, TFirst>;
+
+                    static constexpr bool contains(compare_type value) {
+                        return ((bounds_type::min() <= value) && (value <= bounds_type::max()))
+                               || num_value_ranges_linear<T, TRest...>::contains(value);
+                    }
+
+                    // Same as contains() but without branching, suitable for vectorisation
+                    static constexpr bool matches(compare_type value) {
+                        return ((bounds_type::min() <= value) & (value <= bounds_type::max()))
+                               | num_value_ranges_linear<T, TRest...>::matches(value);
+                    }
+                };
+
+                template<typename T, typename TRanges>
+                class num_value_range_table_impl;
+
+                template<typename T>
+                class num_value_range_table_impl<T, std::tuple<>> {
+                public:
+                    static constexpr bool contains(T value) {
+                        return static_cast<void>(value), false;
+                    }
+
+                    template<typename TIter>
+                    static bool contains_all(TIter first, TIter last) {
+                        return first == last;
+                    }
+                };
+
+                template<typename T, typename TFirst, typename... TRest>
+                class num_value_range_table_impl<T, std::tuple<TFirst, TRest...>> {
+                    using ranges_type = std::tuple<TFirst, TRest...>;
+                    using compare_type = typename num_value_range_compare_type<T>::type;
+
+                public:
+                    static bool contains(T value) {
+                        return contains_internal(static_cast<compare_type>(value), lookup_tag());
+                    }
+
+                    /// @brief Check that values of all the fields in the range are valid.
+                    template<typename TIter>
+                    static bool contains_all(TIter first, TIter last) {
+                        return contains_all_internal(first, last, lookup_tag());
+                    }
+
+                private:
+                    struct bitmap_tag { };
+                    struct linear_tag { };
+                    struct binary_search_tag { };
+
+                    using bitmap_type = num_value_ranges_bitmap<T, ranges_type>;
+
+                    static const std::size_t ranges_count = sizeof...(TRest) + 1U;
+                    static const std::size_t linear_ranges_limit = 16U;
+
+                    using lookup_tag = typename std::conditional<
+                        bitmap_type::applicable, bitmap_tag,
+                        typename std::conditional<(ranges_count <= linear_ranges_limit), linear_tag,
+                                                  binary_search_tag>::type>::type;
+
+                    static bool contains_internal(compare_type value, bitmap_tag) {
+                        return bitmap_type::contains(value);
+                    }
+
+                    static bool contains_internal(compare_type value, linear_tag) {
+                        return num_value_ranges_linear<T, TFirst, TRest...>::contains(value);
+                    }
+
+                    template<typename TIter, typename TTag>
+                    static bool contains_all_internal(TIter first, TIter last, TTag tag) {
+                        using elem_type = typename std::iterator_traits<TIter>::value_type;
+                        return std::all_of(first, last, [tag](const elem_type &elem) {
+                            return contains_internal(static_cast<compare_type>(elem.value()), tag);
+                        });
+                    }
+
+                    template<typename TIter>
+                    static bool contains_all_internal(TIter first, TIter last, linear_tag) {
+                        // The values are staged into the fixed size block, which is checked
+                        // without branching, so the compiler can use vector comparisons.
+                        static const std::size_t BlockSize = 64U;
+                        compare_type block[BlockSize];
+                        while (first != last) {
+                            std::size_t count = 0U;
+                            for (; (count < BlockSize) && (first != last); ++count, ++first) {
+                                block[count] = static_cast<compare_type>(first->value());
+                            }
+
+                            std::fill(&block[count], &block[BlockSize], mins_[0]);
+
+                            unsigned mismatches = 0U;
+                            for (std::size_t idx = 0U; idx < BlockSize; ++idx) {
+                                mismatches |= static_cast<unsigned>(
+                                    !num_value_ranges_linear<T, TFirst, TRest...>::matches(block[idx]));
+                            }
+
+                            if (mismatches != 0U) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    static bool contains_internal(compare_type value, binary_search_tag) {
+                        // Branchless search of the last range starting not after the value
+                        std::size_t base = 0U;
+                        for (std::size_t count = ranges_count; 1U < count; count -= count / 2U) {
+                            auto mid = base + (count / 2U);
+                            base = (mins_[mid] <= value) ? mid : base;
+                        }
+                        return (mins_[base] <= value) & (value <= maxs_[base]);
+                    }
+
+                    static constexpr compare_type mins_[ranges_count]
+                        = {num_value_range_bounds<T, TFirst>::min(), num_value_range_bounds<T, TRest>::min()...};
+
+                    static constexpr compare_type maxs_[ranges_count]
+                        = {num_value_range_bounds<T, TFirst>::max(), num_value_range_bounds<T, TRest>::max()...};
+                };
+
+                template<typename T, typename TFirst, typename... TRest>
+                constexpr typename num_value_range_table_impl<T, std::tuple<TFirst, TRest...>>::compare_type
+                    num_value_range_table_impl<T, std::tuple<TFirst, TRest...>>::mins_[];
+
+                template<typename T, typename TFirst, typename... TRest>
+                constexpr typename num_value_range_table_impl<T, std::tuple<TFirst, TRest...>>::compare_type
+                    num_value_range_table_impl<T, std::tuple<TFirst, TRest...>>::maxs_[];
+
+                /// @brief Lookup table of the valid values ranges.
+                /// @details The ranges provided with multiple
+                ///     nil::marshalling::option::valid_num_value_range options are sorted
+                ///     and merged at compile time. The value is checked against every
+                ///     range when there are few of them, against the bitmap of valid values
+                ///     when the integral ranges span less than 4096 values, and using
+                ///     branchless binary search otherwise.
+                /// @tparam T Type of the checked value.
+                /// @tparam TRanges Tuple of tuples of two std::integral_constant values.
+                template<typename T, typename TRanges>
+                using num_value_range_table = num_value_range_table_impl<
+                    T,
+                    typename num_value_ranges_merge<T, typename num_value_ranges_sort<T, TRanges>::type>::type>;
+
+            }    // namespace detail
+        }        // namespace types
+    }            // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_NUM_VALUE_RANGE_TABLE_HPP
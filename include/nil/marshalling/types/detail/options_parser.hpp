@@ -59,6 +59,7 @@ namespace nil {
                     static const bool has_sequence_elem_fixed_ser_length_field_prefix = false;
                     static const bool has_sequence_trailing_field_suffix = false;
                     static const bool has_sequence_termination_field_suffix = false;
+                    static const bool has_sequence_group_varint = false;
                     static const bool has_default_value_initializer = false;
                     static const bool has_custom_validator = false;
                     static const bool has_contents_refresher = false;
@@ -68,14 +69,18 @@ namespace nil {
                     static const bool has_invalid_by_default = false;
                     static const bool has_fixed_size_storage = false;
                     static const bool has_custom_storage_type = false;
+                    static const bool has_small_buffer_storage = false;
                     static const bool has_scaling_ratio = false;
                     static const bool has_units = false;
                     static const bool has_orig_data_view = false;
+                    static const bool has_lazy_elements_view = false;
+                    static const bool has_memory_resource_storage = false;
                     static const bool has_empty_serialization = false;
                     static const bool has_multi_range_validation = false;
                     static const bool has_custom_version_update = false;
                     static const bool has_versions_range = false;
                     static const bool has_version_storage = false;
+                    static const bool has_variant_key_dispatch = false;
                 };
 
                 template<typename T, typename... TOptions>
@@ -220,6 +225,13 @@ namespace nil {
                     using sequence_termination_field_suffix = TTermField;
                 };
 
+                template<typename... TOptions>
+                class options_parser<nil::marshalling::option::sequence_group_varint, TOptions...>
+                    : public options_parser<TOptions...> {
+                public:
+                    static const bool has_sequence_group_varint = true;
+                };
+
                 template<typename TInitialiser, typename... TOptions>
                 class options_parser<nil::marshalling::option::default_value_initializer<TInitialiser>, TOptions...>
                     : public options_parser<TOptions...> {
@@ -281,6 +293,14 @@ namespace nil {
                     static const std::size_t fixed_size_storage = TSize;
                 };
 
+                template<std::size_t TSize, typename... TOptions>
+                class options_parser<nil::marshalling::option::small_buffer_storage<TSize>, TOptions...>
+                    : public options_parser<TOptions...> {
+                public:
+                    static const bool has_small_buffer_storage = true;
+                    static const std::size_t small_buffer_storage = TSize;
+                };
+
                 template<typename TType, typename... TOptions>
                 class options_parser<nil::marshalling::option::custom_storage_type<TType>, TOptions...>
                     : public options_parser<TOptions...> {
@@ -313,6 +333,21 @@ namespace nil {
                     static const bool has_orig_data_view = true;
                 };
 
+                template<bool TCached, typename... TOptions>
+                class options_parser<nil::marshalling::option::lazy_elements_view<TCached>, TOptions...>
+                    : public options_parser<TOptions...> {
+                public:
+                    static const bool has_lazy_elements_view = true;
+                    static const bool lazy_elements_view_cached = TCached;
+                };
+
+                template<typename... TOptions>
+                class options_parser<nil::marshalling::option::memory_resource_storage, TOptions...>
+                    : public options_parser<TOptions...> {
+                public:
+                    static const bool has_memory_resource_storage = true;
+                };
+
                 template<typename... TOptions>
                 class options_parser<nil::marshalling::option::empty_serialization, TOptions...>
                     : public options_parser<TOptions...> {
@@ -414,6 +449,14 @@ namespace nil {
                     static const bool has_version_storage = true;
                 };
 
+                template<typename TKeyField, typename... TOptions>
+                class options_parser<nil::marshalling::option::variant_key_dispatch<TKeyField>, TOptions...>
+                    : public options_parser<TOptions...> {
+                public:
+                    static const bool has_variant_key_dispatch = true;
+                    using variant_key_field = TKeyField;
+                };
+
                 template<typename... TOptions>
                 class options_parser<nil::marshalling::option::empty_option, TOptions...>
                     : public options_parser<TOptions...> { };
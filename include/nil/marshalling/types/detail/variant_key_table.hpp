@@ -0,0 +1,169 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2017-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef MARSHALLING_VARIANT_KEY_TABLE_HPP
+#define MARSHALLING_VARIANT_KEY_TABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include <nil/marshalling/options.hpp>
+#include <nil/marshalling/processing/tuple.hpp>
+
+namespace nil {
+    namespace marshalling {
+        namespace types {
+            namespace detail {
+
+                template<typename TInitializer>
+                struct variant_member_key_value {
+                    static const bool defined = false;
+                    static constexpr std::intmax_t value = 0;
+                };
+
+                template<typename T, T TVal>
+                struct variant_member_key_value<option::detail::default_num_value_initializer<T, TVal>> {
+                    static const bool defined = true;
+                    static constexpr T value = TVal;
+                };
+
+                template<typename TField,
+                         bool THasInitializer = TField::parsed_options_type::has_default_value_initializer>
+                struct variant_member_key_initializer {
+                    using type = option::detail::default_num_value_initializer<std::intmax_t, 0>;
+                };
+
+                template<typename TField>
+                struct variant_member_key_initializer<TField, true> {
+                    using type = typename TField::parsed_options_type::default_value_initializer;
+                };
+
+                /// @brief Key of the variant member, i.e. default value of its leading field.
+                template<typename TKeyField, typename TMember>
+                struct variant_member_key {
+                    using member_key_type = typename std::tuple_element<0, typename TMember::value_type>::type;
+                    using value_type = typename TKeyField::value_type;
+                    using key_value_type =
+                        variant_member_key_value<typename variant_member_key_initializer<member_key_type>::type>;
+
+                    static_assert(member_key_type::max_length() == TKeyField::max_length(),
+                                  "The leading field of every variant member must have the same length "
+                                  "as the key field");
+                    static_assert(key_value_type::defined,
+                                  "The key of every variant member must be defined using default_num_value option");
+
+                    static constexpr value_type value() {
+                        return static_cast<value_type>(
+                            static_cast<typename member_key_type::value_type>(key_value_type::value));
+                    }
+                };
+
+                template<typename TKeyField, typename TMembers>
+                struct variant_key_order;
+
+                /// @brief Order of the variant members by their keys, equal keys keep
+                ///     the order of the members.
+                template<typename TKeyField, typename... TMembers>
+                struct variant_key_order<TKeyField, std::tuple<TMembers...>> {
+                    using value_type = typename TKeyField::value_type;
+
+                    static const std::size_t members_count = sizeof...(TMembers);
+
+                    static constexpr value_type key(std::size_t idx) {
+                        return keys_[idx];
+                    }
+
+                    /// @brief Index of the member placed at provided position of the sorted table.
+                    static constexpr std::size_t member_at(std::size_t pos, std::size_t idx = 0U) {
+                        return (members_count <= idx) ? members_count :
+                                                        ((rank(idx) == pos) ? idx : member_at(pos, idx + 1U));
+                    }
+
+                private:
+                    static constexpr bool precedes(std::size_t idx, std::size_t other) {
+                        return (key(other) < key(idx)) || ((!(key(idx) < key(other))) && (other < idx));
+                    }
+
+                    static constexpr std::size_t rank(std::size_t idx, std::size_t other = 0U) {
+                        return (members_count <= other) ?
+                                   0U :
+                                   (precedes(idx, other) ? 1U : 0U) + rank(idx, other + 1U);
+                    }
+
+                    static constexpr value_type keys_[members_count]
+                        = {variant_member_key<TKeyField, TMembers>::value()...};
+                };
+
+                template<typename TKeyField, typename... TMembers>
+                constexpr typename TKeyField::value_type
+                    variant_key_order<TKeyField, std::tuple<TMembers...>>::keys_[];
+
+                template<typename TKeyField, typename TMembers,
+                         typename TIndices = typename processing::detail::tuple_make_index_sequence<
+                             std::tuple_size<TMembers>::value>::type>
+                struct variant_key_table;
+
+                /// @brief Keys of the variant members sorted at compile time along with
+                ///     indices of the corresponding members.
+                template<typename TKeyField, typename TMembers, std::size_t... TIndices>
+                struct variant_key_table<TKeyField, TMembers, processing::detail::tuple_index_sequence<TIndices...>> {
+                    using order_type = variant_key_order<TKeyField, TMembers>;
+                    using value_type = typename TKeyField::value_type;
+
+                    static const std::size_t members_count = order_type::members_count;
+
+                    /// @brief Index of the member with provided key, members_count if not found.
+                    static std::size_t find(value_type key) {
+                        const value_type *end = &keys_[0] + members_count;
+                        const value_type *iter = std::lower_bound(&keys_[0], end, key);
+                        if ((iter == end) || (*iter != key)) {
+                            return members_count;
+                        }
+
+                        return indices_[iter - &keys_[0]];
+                    }
+
+                private:
+                    static constexpr value_type keys_[members_count]
+                        = {order_type::key(order_type::member_at(TIndices))...};
+                    static constexpr std::size_t indices_[members_count] = {order_type::member_at(TIndices)...};
+                };
+
+                template<typename TKeyField, typename TMembers, std::size_t... TIndices>
+                constexpr typename TKeyField::value_type variant_key_table<
+                    TKeyField, TMembers, processing::detail::tuple_index_sequence<TIndices...>>::keys_[];
+
+                template<typename TKeyField, typename TMembers, std::size_t... TIndices>
+                constexpr std::size_t variant_key_table<
+                    TKeyField, TMembers, processing::detail::tuple_index_sequence<TIndices...>>::indices_[];
+
+            }    // namespace detail
+        }        // namespace types
+    }            // namespace marshalling
+}    // namespace nil
+#endif    // MARSHALLING_VARIANT_KEY_TABLE_HPP
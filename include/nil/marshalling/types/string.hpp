@@ -50,7 +50,9 @@ namespace nil {
             ///     of the field.@n
             ///     Supported options are:
             ///     @li @ref nil::marshalling::option::fixed_size_storage
+            ///     @li @ref nil::marshalling::option::small_buffer_storage
             ///     @li @ref nil::marshalling::option::custom_storage_type
+            ///     @li @ref nil::marshalling::option::memory_resource_storage
             ///     @li @ref nil::marshalling::option::sequence_size_field_prefix
             ///     @li @ref nil::marshalling::option::sequence_ser_length_field_prefix
             ///     @li @ref nil::marshalling::option::sequence_size_forcing_enabled
@@ -348,6 +350,8 @@ namespace nil {
                 static_assert(!parsed_options_type::has_versions_range,
                               "nil::marshalling::option::exists_between_versions (or similar) option is not applicable "
                               "to string field");
+                static_assert(!parsed_options_type::has_lazy_elements_view,
+                              "nil::marshalling::option::lazy_elements_view option is not applicable to string field");
             };
 
             /// @brief Equality comparison operator.
@@ -31,7 +31,9 @@
 #include <nil/marshalling/type_traits.hpp>
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/container/static_string.hpp>
+#include <nil/marshalling/container/small_string.hpp>
 #include <nil/marshalling/container/string_view.hpp>
+#include <nil/marshalling/container/memory_resource.hpp>
 #include <nil/marshalling/types/string/basic_type.hpp>
 #include <nil/marshalling/types/detail/adapt_basic_field.hpp>
 #include <nil/marshalling/types/detail/options_parser.hpp>
@@ -43,17 +45,48 @@ namespace nil {
         namespace types {
             namespace detail {
 
+                template<bool THasMemoryResourceStorage>
+                struct string_memory_resource_storage_type;
+
+                template<>
+                struct string_memory_resource_storage_type<true> {
+                    using type = nil::marshalling::container::resource_string;
+                };
+
+                template<>
+                struct string_memory_resource_storage_type<false> {
+                    using type = std::string;
+                };
+
+                template<bool THasSmallBufferStorage>
+                struct string_small_buffer_storage_type;
+
+                template<>
+                struct string_small_buffer_storage_type<true> {
+                    template<typename TOpt>
+                    using type = nil::marshalling::container::small_string<TOpt::small_buffer_storage>;
+                };
+
+                template<>
+                struct string_small_buffer_storage_type<false> {
+                    template<typename TOpt>
+                    using type = typename string_memory_resource_storage_type<TOpt::has_memory_resource_storage>::type;
+                };
+
                 template<bool THasOrigDataViewStorage>
                 struct string_orig_data_view_storage_type;
 
                 template<>
                 struct string_orig_data_view_storage_type<true> {
+                    template<typename TOpt>
                     using type = nil::marshalling::container::string_view;
                 };
 
                 template<>
                 struct string_orig_data_view_storage_type<false> {
-                    using type = std::string;
+                    template<typename TOpt>
+                    using type =
+                        typename string_small_buffer_storage_type<TOpt::has_small_buffer_storage>::template type<TOpt>;
                 };
 
                 template<bool THasSequenceFixedSizeUseFixedSizeStorage>
@@ -68,7 +101,8 @@ namespace nil {
                 template<>
                 struct string_fixed_size_use_fixed_size_storage_type<false> {
                     template<typename TOpt>
-                    using type = typename string_orig_data_view_storage_type<TOpt::has_orig_data_view>::type;
+                    using type =
+                        typename string_orig_data_view_storage_type<TOpt::has_orig_data_view>::template type<TOpt>;
                 };
 
                 template<bool THasFixedSizeStorage>
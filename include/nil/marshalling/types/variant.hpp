@@ -85,6 +85,9 @@ namespace nil {
             ///     @li @ref nil::marshalling::option::default_variant_index - By default the variant field
             ///         doesn't have any valid contents. This option may be used to specify
             ///         the index of the default member field.
+            ///     @li @ref nil::marshalling::option::variant_key_dispatch - Select the member to read
+            ///         by the value of the leading key field shared by all the members instead of
+            ///         trying to read every member in turn.
             ///     @li @ref nil::marshalling::option::has_custom_read
             ///     @li @ref nil::marshalling::option::has_custom_refresh
             ///     @li @ref nil::marshalling::option::empty_serialization
@@ -434,6 +437,10 @@ namespace nil {
                               "to variant field");
                 static_assert(!parsed_options_type::has_invalid_by_default,
                               "nil::marshalling::option::invalid_by_default option is not applicable to variant field");
+                static_assert((!parsed_options_type::has_variant_key_dispatch)
+                                  || (!parsed_options_type::has_custom_value_reader),
+                              "The following options are incompatible, cannot be used together: "
+                              "variant_key_dispatch, custom_value_reader");
             };
 
             namespace detail {
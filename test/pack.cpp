@@ -49,9 +49,75 @@
 #include <nil/marshalling/algorithms/pack.hpp>
 
 #include <cstdio>
+#include <list>
 
 using namespace nil::marshalling;
 
+template<typename TEndian, typename T>
+void serialize_word(T value, std::vector<std::uint8_t> &bytes) {
+    using unsigned_type = typename std::make_unsigned<T>::type;
+    for (std::size_t idx = 0; idx < sizeof(T); ++idx) {
+        std::size_t shift = std::is_same<TEndian, option::big_endian>::value ? (sizeof(T) - 1 - idx) : idx;
+        bytes.push_back(static_cast<std::uint8_t>(static_cast<unsigned_type>(value) >> (8 * shift)));
+    }
+}
+
+template<typename TEndian, typename T>
+T deserialize_word(std::vector<std::uint8_t>::const_iterator iter) {
+    using unsigned_type = typename std::make_unsigned<T>::type;
+    unsigned_type value = 0;
+    for (std::size_t idx = 0; idx < sizeof(T); ++idx, ++iter) {
+        std::size_t shift = std::is_same<TEndian, option::big_endian>::value ? (sizeof(T) - 1 - idx) : idx;
+        value = static_cast<unsigned_type>(value | (static_cast<unsigned_type>(*iter) << (8 * shift)));
+    }
+    return static_cast<T>(value);
+}
+
+template<typename TInputEndian, typename TOutputEndian, typename TInput, typename TOutput>
+void check_regroup(std::size_t count) {
+    std::vector<TInput> in;
+    std::vector<std::uint8_t> bytes;
+    for (std::size_t idx = 0; idx < count; ++idx) {
+        in.push_back(static_cast<TInput>(0x0123456789abcdefULL * (idx + 1) + idx));
+        serialize_word<TInputEndian>(in.back(), bytes);
+    }
+
+    std::vector<TOutput> res;
+    for (std::size_t idx = 0; (idx + sizeof(TOutput)) <= bytes.size(); idx += sizeof(TOutput)) {
+        res.push_back(deserialize_word<TOutputEndian, TOutput>(bytes.cbegin() + idx));
+    }
+    status_type expected_status
+        = ((bytes.size() % sizeof(TOutput)) == 0) ? status_type::success : status_type::not_enough_data;
+
+    status_type status;
+    std::vector<TOutput> out = pack<TOutputEndian, TInputEndian>(in, status);
+    BOOST_CHECK(status == expected_status);
+    BOOST_CHECK(out == res);
+
+    const TInput *first = in.data();
+    std::vector<TOutput> out_ptr = pack<TOutputEndian, TInputEndian>(first, first + in.size(), status);
+    BOOST_CHECK(status == expected_status);
+    BOOST_CHECK(out_ptr == res);
+
+    std::array<TOutput, 2> out_arr = pack<TOutputEndian, TInputEndian>(in, status);
+    BOOST_CHECK(status == ((res.size() < 2) ? status_type::not_enough_data : status_type::success));
+    for (std::size_t idx = 0; idx < out_arr.size(); ++idx) {
+        BOOST_CHECK(out_arr[idx] == ((idx < res.size()) ? res[idx] : TOutput()));
+    }
+}
+
+template<typename TInputEndian, typename TOutputEndian>
+void check_regroup_all(std::size_t count) {
+    check_regroup<TInputEndian, TOutputEndian, std::uint16_t, std::uint16_t>(count);
+    check_regroup<TInputEndian, TOutputEndian, std::uint16_t, std::uint32_t>(count);
+    check_regroup<TInputEndian, TOutputEndian, std::uint16_t, std::int64_t>(count);
+    check_regroup<TInputEndian, TOutputEndian, std::uint32_t, std::uint16_t>(count);
+    check_regroup<TInputEndian, TOutputEndian, std::int32_t, std::uint64_t>(count);
+    check_regroup<TInputEndian, TOutputEndian, std::uint64_t, std::int16_t>(count);
+    check_regroup<TInputEndian, TOutputEndian, std::uint64_t, std::uint32_t>(count);
+    check_regroup<TInputEndian, TOutputEndian, std::uint64_t, std::uint64_t>(count);
+}
+
 BOOST_AUTO_TEST_SUITE(pack_imploder_test_suite)
 
 BOOST_AUTO_TEST_CASE(be_to_be_1) {
@@ -294,6 +360,264 @@ BOOST_AUTO_TEST_CASE(lubb_to_lubb_2) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(value_to_buffer_1) {
+
+    std::uint32_t in = 0x12345678;
+    std::array<std::uint8_t, 6> out = {{0xff, 0xff, 0xff, 0xff, 0xff, 0xff}};
+    std::array<std::uint8_t, 6> res = {{0x12, 0x34, 0x56, 0x78, 0xff, 0xff}};
+
+    std::size_t written = 0;
+    status_type status = pack<option::big_endian>(in, out.data(), out.size(), written);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(written == 4);
+    BOOST_CHECK(out == res);
+
+    status = pack<option::little_endian>(in, out.data(), 3, written);
+
+    BOOST_CHECK(status == status_type::buffer_overflow);
+    BOOST_CHECK(written == 0);
+    BOOST_CHECK(out == res);
+
+    types::integral<field_type<option::little_endian>, std::uint16_t> field(0x1234);
+    status = pack(field, out.data() + 4, 2, written);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(written == 2);
+    BOOST_CHECK(out[4] == 0x34);
+    BOOST_CHECK(out[5] == 0x12);
+}
+
+BOOST_AUTO_TEST_CASE(range_to_buffer_1) {
+
+    std::vector<std::uint16_t> in = {{0x1234, 0x5678, 0x90ab, 0xcdef}};
+    std::uint8_t out[8] = {0};
+    std::vector<std::uint8_t> res_be = {{0x12, 0x34, 0x56, 0x78, 0x90, 0xab, 0xcd, 0xef}};
+    std::vector<std::uint8_t> res_le = {{0x34, 0x12, 0x78, 0x56, 0xab, 0x90, 0xef, 0xcd}};
+
+    std::size_t written = 0;
+    status_type status = pack<option::big_endian>(in, out, sizeof(out), written);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(written == sizeof(out));
+    BOOST_CHECK(std::equal(res_be.begin(), res_be.end(), out));
+
+    status = pack<option::little_endian>(in.begin(), in.end(), out, sizeof(out), written);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(written == sizeof(out));
+    BOOST_CHECK(std::equal(res_le.begin(), res_le.end(), out));
+
+    std::vector<std::uint8_t> expected = pack<option::little_endian>(in, status);
+    BOOST_CHECK(std::equal(expected.begin(), expected.end(), out));
+
+    status = pack<option::big_endian>(in.begin(), in.end(), out, sizeof(out) - 1, written);
+
+    BOOST_CHECK(status == status_type::buffer_overflow);
+    BOOST_CHECK(written == 0);
+    BOOST_CHECK(std::equal(res_le.begin(), res_le.end(), out));
+}
+
+BOOST_AUTO_TEST_CASE(regroup_words_1) {
+
+    for (std::size_t count : {1, 3, 4, 17, 1000}) {
+        check_regroup_all<option::big_endian, option::big_endian>(count);
+        check_regroup_all<option::big_endian, option::little_endian>(count);
+        check_regroup_all<option::little_endian, option::big_endian>(count);
+        check_regroup_all<option::little_endian, option::little_endian>(count);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(regroup_words_2) {
+
+    std::uint64_t in = 0x1234567890abcdef;
+    std::vector<std::uint16_t> res = {{0x3412, 0x7856, 0xab90, 0xefcd}};
+
+    status_type status;
+    std::vector<std::uint16_t> out = pack<option::little_endian, option::big_endian>(in, status);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(out == res);
+
+    std::array<std::uint32_t, 2> out_arr = pack<option::big_endian, option::little_endian>(in, status);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(out_arr[0] == 0xefcdab90);
+    BOOST_CHECK(out_arr[1] == 0x78563412);
+}
+
+BOOST_AUTO_TEST_CASE(unpack_words_1) {
+
+    std::vector<std::uint32_t> in = {{0x12345678, 0x90abcdef, 0x0a0b0c0d}};
+    std::vector<std::uint8_t> res_be = {{0x12, 0x34, 0x56, 0x78, 0x90, 0xab, 0xcd, 0xef, 0x0a, 0x0b, 0x0c, 0x0d}};
+    std::vector<std::uint8_t> res_le = {{0x78, 0x56, 0x34, 0x12, 0xef, 0xcd, 0xab, 0x90, 0x0d, 0x0c, 0x0b, 0x0a}};
+
+    status_type status;
+    std::vector<std::uint8_t> out = pack<option::big_endian, option::big_endian>(in, status);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(out == res_be);
+
+    std::list<std::uint8_t> out_list = pack<option::little_endian, option::little_endian>(in, status);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(std::equal(out_list.begin(), out_list.end(), res_le.begin()));
+    BOOST_CHECK(out_list.size() == res_le.size());
+
+    std::array<std::uint8_t, 12> out_arr = pack<option::little_endian, option::little_endian>(in, status);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(std::equal(out_arr.begin(), out_arr.end(), res_le.begin()));
+
+    std::array<std::uint8_t, 10> out_short = pack<option::big_endian, option::big_endian>(in, status);
+
+    BOOST_CHECK(status == status_type::buffer_overflow);
+    BOOST_CHECK(std::equal(out_short.begin(), out_short.begin() + 8, res_be.begin()));
+    BOOST_CHECK(out_short[8] == 0);
+    BOOST_CHECK(out_short[9] == 0);
+
+    std::vector<std::uint32_t> empty_in;
+    std::vector<std::uint8_t> empty_out = pack<option::big_endian, option::big_endian>(empty_in, status);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(empty_out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(pack_words_1) {
+
+    std::vector<std::uint8_t> in = {{0x12, 0x34, 0x56, 0x78, 0x90, 0xab, 0xcd, 0xef, 0x0a, 0x0b}};
+    std::vector<std::uint16_t> res_be = {{0x1234, 0x5678, 0x90ab, 0xcdef, 0x0a0b}};
+    std::vector<std::uint32_t> res_le = {{0x78563412, 0xefcdab90}};
+
+    status_type status;
+    std::vector<std::uint16_t> out = pack<option::big_endian>(in, status);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(out == res_be);
+
+    const std::uint8_t *first = in.data();
+    std::vector<std::uint32_t> out_ptr = pack<option::little_endian>(first, first + in.size(), status);
+
+    BOOST_CHECK(status == status_type::not_enough_data);
+    BOOST_CHECK(out_ptr == res_le);
+
+    std::list<std::uint16_t> out_list = pack<option::big_endian>(in, status);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(std::equal(out_list.begin(), out_list.end(), res_be.begin()));
+    BOOST_CHECK(out_list.size() == res_be.size());
+
+    std::array<std::uint16_t, 3> out_arr = pack<option::big_endian>(in, status);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(std::equal(out_arr.begin(), out_arr.end(), res_be.begin()));
+
+    std::array<std::uint16_t, 6> out_long = pack<option::big_endian>(in, status);
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(std::equal(res_be.begin(), res_be.end(), out_long.begin()));
+    BOOST_CHECK(out_long[5] == 0);
+
+    boost::array<std::uint32_t, 3> out_barr = pack<option::little_endian>(first, first + in.size(), status);
+
+    BOOST_CHECK(status == status_type::not_enough_data);
+    BOOST_CHECK(out_barr[0] == res_le[0]);
+    BOOST_CHECK(out_barr[1] == res_le[1]);
+    BOOST_CHECK(out_barr[2] == 0);
+}
+
+BOOST_AUTO_TEST_CASE(pack_to_static_1) {
+
+    using field_type_be = types::integral<field_type<option::big_endian>, std::uint16_t>;
+    using list_type = types::array_list<field_type<option::big_endian>, field_type_be,
+                                       option::fixed_size_storage<4>>;
+
+    static_assert(packed_size<std::uint32_t>() == 4, "Invalid packed size");
+    static_assert(packed_size<field_type_be>() == 2, "Invalid packed size");
+    static_assert(packed_size<std::array<std::uint16_t, 3>>() == 6, "Invalid packed size");
+    static_assert(max_packed_size<list_type>() == 8, "Invalid packed size");
+
+    std::vector<std::uint64_t> in_vec(5);
+    BOOST_CHECK(packed_size(in_vec) == 40);
+    BOOST_CHECK(packed_size(std::uint16_t(0)) == 2);
+
+    list_type list;
+    list.value().resize(3);
+    BOOST_CHECK(packed_size(list) == 6);
+
+    status_type status;
+    std::array<std::uint8_t, 4> out = pack_to_static<option::little_endian>(std::uint32_t(0x12345678), status);
+    std::array<std::uint8_t, 4> res = {{0x78, 0x56, 0x34, 0x12}};
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(out == res);
+
+    std::array<std::uint16_t, 3> in_arr = {{0x1234, 0x5678, 0x9abc}};
+    std::array<std::uint8_t, 6> out_arr = pack_to_static(in_arr, status);
+    std::array<std::uint8_t, 6> res_arr = {{0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc}};
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(out_arr == res_arr);
+
+    list.value()[0].value() = 0x0102;
+    list.value()[2].value() = 0x0304;
+    std::array<std::uint8_t, 8> out_list = pack_to_static(list, status);
+    std::array<std::uint8_t, 8> res_list = {{0x01, 0x02, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00}};
+
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(out_list == res_list);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_pack_1) {
+
+    std::vector<std::uint32_t> in(1000);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<std::uint32_t>(i * 0x01020305U);
+    }
+
+    std::size_t tasks = 0;
+    parallel_policy policy(
+        [&tasks](std::size_t count, const parallel_policy::task_type &task) {
+            tasks = count;
+            for (std::size_t i = 0; i < count; ++i) {
+                task(i);
+            }
+        },
+        4, 0);
+
+    std::vector<std::uint8_t> serial(in.size() * 4);
+    std::vector<std::uint8_t> parallel(in.size() * 4);
+    std::size_t written = 0;
+
+    BOOST_CHECK(pack<option::little_endian>(in, serial.data(), serial.size(), written) == status_type::success);
+    BOOST_CHECK(pack<option::little_endian>(policy, in, parallel.data(), parallel.size(), written)
+                == status_type::success);
+    BOOST_CHECK(tasks == 4);
+    BOOST_CHECK(written == parallel.size());
+    BOOST_CHECK(serial == parallel);
+
+    BOOST_CHECK(pack(policy, in, parallel.data(), parallel.size() - 1, written) == status_type::buffer_overflow);
+    BOOST_CHECK(written == 0);
+
+    std::vector<std::uint32_t> out(in.size());
+    std::size_t read = 0;
+    BOOST_CHECK(pack<option::little_endian>(policy, serial, out.data(), out.size(), read) == status_type::success);
+    BOOST_CHECK(read == in.size());
+    BOOST_CHECK(out == in);
+
+    std::vector<std::uint8_t> tail(serial.begin(), serial.begin() + 10);
+    BOOST_CHECK(pack<option::little_endian>(policy, tail, out.data(), out.size(), read)
+                == status_type::not_enough_data);
+    BOOST_CHECK(read == 2);
+    BOOST_CHECK(pack<option::little_endian>(policy, serial, out.data(), 3, read) == status_type::buffer_overflow);
+    BOOST_CHECK(read == 3);
+
+    parallel_policy threads(3, 0);
+    std::fill(out.begin(), out.end(), 0);
+    BOOST_CHECK(pack<option::little_endian>(threads, serial, out.data(), out.size(), read) == status_type::success);
+    BOOST_CHECK(out == in);
+}
+
 // /*
 // BOOST_AUTO_TEST_CASE(lubb_to_lulb_1) {
 //     std::array<std::uint8_t, 8> inp_seed_blank = {{0x12, 0x34, 0x56, 0x78, 0x90, 0xab, 0xcd, 0xef}};
@@ -27,6 +27,13 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cstring>
+#include <list>
+#include <thread>
+#include <vector>
+
+#include <nil/marshalling/processing/access.hpp>
+#include <nil/marshalling/processing/tuple.hpp>
 #include <nil/marshalling/type_traits.hpp>
 #include <nil/marshalling/status_type.hpp>
 
@@ -35,6 +42,8 @@
 
 #include <nil/marshalling/container/array_view.hpp>
 #include <nil/marshalling/container/static_vector.hpp>
+#include <nil/marshalling/container/static_queue.hpp>
+#include <nil/marshalling/container/static_spsc_queue.hpp>
 #include <nil/marshalling/container/static_string.hpp>
 #include <nil/marshalling/container/string_view.hpp>
 #include <nil/marshalling/container/type_traits.hpp>
@@ -43,6 +52,81 @@ using namespace nil::marshalling;
 
 BOOST_TEST_DONT_PRINT_LOG_VALUE(status_type)
 
+template<typename T, std::size_t TSize, typename TEndian>
+void check_word_access(const std::vector<T> &values) {
+    std::vector<std::uint8_t> wordBuf(values.size() * TSize);
+    std::list<std::uint8_t> byteBuf;
+
+    auto *writeIter = &wordBuf[0];
+    auto listIter = std::back_inserter(byteBuf);
+    for (auto v : values) {
+        processing::write_data<TSize>(v, writeIter, TEndian());
+        processing::write_data<TSize>(v, listIter, TEndian());
+    }
+    BOOST_CHECK(writeIter == &wordBuf[0] + wordBuf.size());
+    BOOST_CHECK(std::equal(wordBuf.begin(), wordBuf.end(), byteBuf.begin()));
+
+    const auto *readIter = &wordBuf[0];
+    auto listReadIter = byteBuf.cbegin();
+    for (auto v : values) {
+        BOOST_CHECK(v == (processing::read_data<T, TSize>(readIter, TEndian())));
+        BOOST_CHECK(v == (processing::read_data<T, TSize>(listReadIter, TEndian())));
+    }
+    BOOST_CHECK(readIter == &wordBuf[0] + wordBuf.size());
+}
+
+template<typename T, typename TEndian>
+void check_word_access() {
+    static const std::size_t Count = 1000U;
+    static const std::size_t Size = sizeof(T);
+    std::vector<std::uint8_t> wordBuf(Count * Size);
+    std::vector<std::uint8_t> byteBuf(Count * Size);
+
+    auto *wordIter = &wordBuf[0];
+    auto *byteIter = &byteBuf[0];
+    for (std::size_t i = 0; i < Count; ++i) {
+        auto value = static_cast<T>(0x0102030405060708ULL * (i + 1));
+        processing::write_data<Size>(value, wordIter, TEndian());
+        processing::detail::write<TEndian>(value, Size, byteIter);
+    }
+    BOOST_CHECK(wordBuf == byteBuf);
+
+    const auto *wordReadIter = &wordBuf[0];
+    const auto *byteReadIter = &byteBuf[0];
+    for (std::size_t i = 0; i < Count; ++i) {
+        auto value = static_cast<T>(0x0102030405060708ULL * (i + 1));
+        BOOST_CHECK((processing::read_data<T, Size>(wordReadIter, TEndian()) == value));
+        BOOST_CHECK((processing::detail::read<TEndian, T>(Size, byteReadIter) == value));
+    }
+}
+
+template<typename T, typename TEndian>
+void check_bulk_access(std::size_t count) {
+    std::vector<T> values(count);
+    for (std::size_t idx = 0; idx < count; ++idx) {
+        values[idx] = static_cast<T>(0x0102030405060708ULL * (idx + 1));
+    }
+
+    std::vector<std::uint8_t> bulkBuf(count * sizeof(T));
+    std::vector<std::uint8_t> wordBuf(count * sizeof(T));
+    auto *bulkIter = &bulkBuf[0];
+    auto *wordIter = &wordBuf[0];
+    processing::write_data_bulk(&values[0], count, bulkIter, TEndian());
+    for (auto v : values) {
+        typename processing::detail::size_to_type_helper<sizeof(T)>::type bits;
+        std::memcpy(&bits, &v, sizeof(T));
+        processing::write_data(bits, wordIter, TEndian());
+    }
+    BOOST_CHECK(bulkIter == &bulkBuf[0] + bulkBuf.size());
+    BOOST_CHECK(bulkBuf == wordBuf);
+
+    std::vector<T> readValues(count);
+    const auto *readIter = &bulkBuf[0];
+    processing::read_data_bulk(&readValues[0], count, readIter, TEndian());
+    BOOST_CHECK(readIter == &bulkBuf[0] + bulkBuf.size());
+    BOOST_CHECK(readValues == values);
+}
+
 BOOST_AUTO_TEST_SUITE(marshalling_processing_test_suite)
 
 BOOST_AUTO_TEST_CASE(test1) {
@@ -882,4 +966,243 @@ BOOST_AUTO_TEST_CASE(test25) {
     BOOST_CHECK(beg + 1 == str.data());
 }
 
+BOOST_AUTO_TEST_CASE(test26) {
+    static const std::vector<std::uint16_t> Values16 = {0x0000, 0x0102, 0xff00, 0xffff};
+    static const std::vector<std::int32_t> Values32 = {0, 1, -1, 0x01020304, -0x01020304};
+    static const std::vector<std::uint64_t> Values64 = {0, 0x0102030405060708ULL, 0xffffffffffffffffULL};
+    static const std::vector<std::int64_t> Values48 = {0, 1, -1, 0x010203040506LL, -0x010203040506LL};
+
+    check_word_access<std::uint16_t, 2, endian::big_endian>(Values16);
+    check_word_access<std::uint16_t, 2, endian::little_endian>(Values16);
+    check_word_access<std::int32_t, 4, endian::big_endian>(Values32);
+    check_word_access<std::int32_t, 4, endian::little_endian>(Values32);
+    check_word_access<std::int32_t, 2, endian::big_endian>({0, 1, -1, 0x7fff, -0x8000});
+    check_word_access<std::uint64_t, 8, endian::big_endian>(Values64);
+    check_word_access<std::uint64_t, 8, endian::little_endian>(Values64);
+    check_word_access<std::int64_t, 6, endian::big_endian>(Values48);
+    check_word_access<std::int64_t, 6, endian::little_endian>(Values48);
+
+    static const std::uint8_t Buf[] = {0x01, 0x02, 0x03, 0x04};
+    const char *signedIter = reinterpret_cast<const char *>(&Buf[0]);
+    BOOST_CHECK(processing::read_big_endian<std::uint32_t>(signedIter) == 0x01020304U);
+    BOOST_CHECK(signedIter == reinterpret_cast<const char *>(&Buf[0]) + 4);
+}
+
+BOOST_AUTO_TEST_CASE(test27) {
+    check_word_access<std::uint16_t, endian::big_endian>();
+    check_word_access<std::uint16_t, endian::little_endian>();
+    check_word_access<std::int32_t, endian::big_endian>();
+    check_word_access<std::uint32_t, endian::little_endian>();
+    check_word_access<std::uint64_t, endian::big_endian>();
+    check_word_access<std::int64_t, endian::little_endian>();
+}
+
+BOOST_AUTO_TEST_CASE(test28) {
+    static const std::size_t Counts[] = {1, 7, 16, 37, 1000};
+    for (auto count : Counts) {
+        check_bulk_access<std::uint8_t, endian::big_endian>(count);
+        check_bulk_access<std::uint16_t, endian::big_endian>(count);
+        check_bulk_access<std::uint16_t, endian::little_endian>(count);
+        check_bulk_access<std::int32_t, endian::big_endian>(count);
+        check_bulk_access<std::uint32_t, endian::little_endian>(count);
+        check_bulk_access<std::uint64_t, endian::big_endian>(count);
+        check_bulk_access<std::int64_t, endian::little_endian>(count);
+        check_bulk_access<float, endian::big_endian>(count);
+        check_bulk_access<double, endian::big_endian>(count);
+    }
+}
+
+template<std::size_t TIdx>
+struct test29_type {
+    static const std::size_t value = TIdx;
+};
+
+struct test29_selector {
+    template<std::size_t TIdx, typename T>
+    void operator()() {
+        idx_ = TIdx;
+        value_ = T::value;
+    }
+
+    std::size_t idx_ = 0U;
+    std::size_t value_ = 0U;
+};
+
+BOOST_AUTO_TEST_CASE(test29) {
+    using tuple_type = std::tuple<test29_type<0>, test29_type<1>, test29_type<2>, test29_type<3>, test29_type<4>,
+                                  test29_type<5>, test29_type<6>, test29_type<7>, test29_type<8>, test29_type<9>,
+                                  test29_type<10>, test29_type<11>, test29_type<12>>;
+
+    for (std::size_t idx = 0U; idx < std::tuple_size<tuple_type>::value; ++idx) {
+        test29_selector selector;
+        processing::tuple_for_selected_type<tuple_type>(idx, selector);
+        BOOST_CHECK_EQUAL(selector.idx_, idx);
+        BOOST_CHECK_EQUAL(selector.value_, idx);
+    }
+
+    test29_selector selector;
+    processing::tuple_for_selected_type<std::tuple<test29_type<7>>>(0U, selector);
+    BOOST_CHECK_EQUAL(selector.value_, 7U);
+    processing::tuple_for_selected_type<tuple_type>(3U, test29_selector());
+}
+
+BOOST_AUTO_TEST_CASE(test30) {
+    typedef container::static_vector<std::uint16_t, 16> Vec1;
+    typedef container::static_vector<std::uint16_t, 32> Vec2;
+    typedef container::static_vector<std::int8_t, 16> Vec3;
+
+    static const std::uint16_t Data[] = {0x100, 0x201, 0x302, 0x403, 0x504};
+    static const auto DataSize = std::extent<decltype(Data)>::value;
+
+    Vec1 vec1(std::begin(Data), std::end(Data));
+    BOOST_CHECK(vec1.size() == DataSize);
+    BOOST_CHECK(std::equal(vec1.begin(), vec1.end(), std::begin(Data)));
+
+    // Inserted value references the element being shifted
+    auto iter = vec1.insert(vec1.begin() + 1, vec1[3]);
+    BOOST_CHECK(iter == vec1.begin() + 1);
+    static const std::uint16_t Expected1[] = {0x100, 0x403, 0x201, 0x302, 0x403, 0x504};
+    BOOST_CHECK(vec1.size() == std::extent<decltype(Expected1)>::value);
+    BOOST_CHECK(std::equal(vec1.begin(), vec1.end(), std::begin(Expected1)));
+
+    iter = vec1.insert(vec1.begin() + 2, 3U, vec1.front());
+    BOOST_CHECK(iter == vec1.begin() + 2);
+    static const std::uint16_t Expected2[] = {0x100, 0x403, 0x100, 0x100, 0x100, 0x201, 0x302, 0x403, 0x504};
+    BOOST_CHECK(vec1.size() == std::extent<decltype(Expected2)>::value);
+    BOOST_CHECK(std::equal(vec1.begin(), vec1.end(), std::begin(Expected2)));
+
+    iter = vec1.erase(vec1.begin() + 1, vec1.begin() + 5);
+    BOOST_CHECK(iter == vec1.begin() + 1);
+    BOOST_CHECK(vec1.size() == DataSize);
+    BOOST_CHECK(std::equal(vec1.begin(), vec1.end(), std::begin(Data)));
+
+    vec1.resize(8U, 0xffff);
+    BOOST_CHECK(vec1.size() == 8U);
+    BOOST_CHECK(std::equal(std::begin(Data), std::end(Data), vec1.begin()));
+    BOOST_CHECK(
+        std::all_of(vec1.begin() + DataSize, vec1.end(), [](std::uint16_t val) -> bool { return val == 0xffff; }));
+
+    Vec2 vec2(vec1);
+    BOOST_CHECK(std::equal(vec1.begin(), vec1.end(), vec2.begin()));
+    vec2.resize(2U);
+    vec2.insert(vec2.end(), std::begin(Data), std::end(Data));
+    BOOST_CHECK(vec2.size() == DataSize + 2U);
+
+    vec1.swap(vec2);
+    BOOST_CHECK(vec1.size() == DataSize + 2U);
+    BOOST_CHECK(vec2.size() == 8U);
+    BOOST_CHECK(std::equal(std::begin(Data), std::end(Data), vec1.begin() + 2));
+    BOOST_CHECK(std::equal(std::begin(Data), std::end(Data), vec2.begin()));
+    BOOST_CHECK(vec2.back() == 0xffff);
+
+    Vec3 vec3 = {-1, -2, -3};
+    vec3.insert(vec3.begin() + 1, {-4, -5});
+    static const std::int8_t Expected3[] = {-1, -4, -5, -2, -3};
+    BOOST_CHECK(vec3.size() == std::extent<decltype(Expected3)>::value);
+    BOOST_CHECK(std::equal(vec3.begin(), vec3.end(), std::begin(Expected3)));
+}
+
+BOOST_AUTO_TEST_CASE(test31) {
+    typedef container::static_queue<std::uint16_t, 8> Queue;
+    typedef container::static_spsc_queue<std::uint16_t, 8> SpscQueue;
+    typedef container::static_spsc_queue<std::string, 4> StrSpscQueue;
+
+    static const std::uint16_t Data[] = {0x100, 0x201, 0x302, 0x403, 0x504, 0x605};
+    static const auto DataSize = std::extent<decltype(Data)>::value;
+
+    Queue queue;
+    queue.push_back(std::begin(Data), std::end(Data));
+    BOOST_CHECK(queue.size() == DataSize);
+    BOOST_CHECK(std::equal(std::begin(Data), std::end(Data), queue.lbegin()));
+
+    // Bulk push wraps around the end of the storage
+    queue.pop_front(4U);
+    queue.push_back(std::begin(Data), std::end(Data));
+    BOOST_CHECK(queue.full());
+    BOOST_CHECK(!queue.linearised());
+    BOOST_CHECK(queue.front() == 0x504);
+    BOOST_CHECK(queue.back() == 0x605);
+    for (std::size_t idx = 0U; idx < DataSize; ++idx) {
+        BOOST_CHECK(queue[idx + 2U] == Data[idx]);
+    }
+
+    queue.pop_back(3U);
+    queue.pop_front(2U);
+    BOOST_CHECK(queue.size() == 3U);
+    BOOST_CHECK(std::equal(std::begin(Data), std::begin(Data) + 3U, queue.begin()));
+
+    SpscQueue spscQueue;
+    BOOST_CHECK(spscQueue.empty());
+    BOOST_CHECK(spscQueue.push_back(std::begin(Data), std::end(Data)) == DataSize);
+    BOOST_CHECK(spscQueue.push_back(std::begin(Data), std::end(Data)) == spscQueue.capacity() - DataSize);
+    BOOST_CHECK(spscQueue.full());
+    BOOST_CHECK(!spscQueue.push_back(std::uint16_t(0)));
+
+    std::uint16_t buf[DataSize] = {0};
+    BOOST_CHECK(spscQueue.pop_front(&buf[0], DataSize) == DataSize);
+    BOOST_CHECK(std::equal(std::begin(Data), std::end(Data), &buf[0]));
+    BOOST_CHECK(spscQueue.push_back(std::begin(Data), std::end(Data)) == DataSize);
+
+    // Readable elements wrap around the end of the storage
+    auto one = spscQueue.array_one();
+    auto two = spscQueue.array_two();
+    BOOST_CHECK(one.second == one.first + 2U);
+    BOOST_CHECK(two.second == two.first + DataSize);
+    BOOST_CHECK(std::equal(std::begin(Data), std::begin(Data) + 2U, one.first));
+    BOOST_CHECK(std::equal(std::begin(Data), std::end(Data), two.first));
+    BOOST_CHECK(spscQueue.pop_front(2U) == 2U);
+    BOOST_CHECK(spscQueue.front() == Data[0]);
+
+    std::uint16_t value = 0U;
+    BOOST_CHECK(spscQueue.pop_front(value));
+    BOOST_CHECK(value == Data[0]);
+    BOOST_CHECK(spscQueue.size() == DataSize - 1U);
+    spscQueue.clear();
+    BOOST_CHECK(spscQueue.empty());
+    BOOST_CHECK(!spscQueue.pop_front(value));
+
+    StrSpscQueue strQueue;
+    BOOST_CHECK(strQueue.emplace_back(3U, 'a'));
+    BOOST_CHECK(strQueue.push_back(std::string("bb")));
+    std::string str;
+    BOOST_CHECK(strQueue.pop_front(str));
+    BOOST_CHECK(str == "aaa");
+    BOOST_CHECK(strQueue.front() == "bb");
+}
+
+BOOST_AUTO_TEST_CASE(test32) {
+    typedef container::static_spsc_queue<std::uint32_t, 16> SpscQueue;
+
+    static const std::uint32_t Count = 100000U;
+
+    SpscQueue queue;
+    std::thread producer([&queue]() {
+        std::uint32_t next = 0U;
+        while (next < Count) {
+            if (queue.push_back(next)) {
+                ++next;
+                continue;
+            }
+            std::this_thread::yield();
+        }
+    });
+
+    std::uint32_t received = 0U;
+    bool ordered = true;
+    while (received < Count) {
+        std::uint32_t value = 0U;
+        if (!queue.pop_front(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ordered = ordered && (value == received);
+        ++received;
+    }
+
+    producer.join();
+    BOOST_CHECK(ordered);
+    BOOST_CHECK(received == Count);
+    BOOST_CHECK(queue.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
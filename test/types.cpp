@@ -32,6 +32,7 @@
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <list>
 #include <memory>
 #include <type_traits>
 
@@ -51,12 +52,18 @@
 #include <nil/marshalling/units.hpp>
 #include <nil/marshalling/version.hpp>
 #include <nil/marshalling/inference.hpp>
+#include <nil/marshalling/marshalling_state.hpp>
 
 #include <nil/marshalling/algorithms/pack.hpp>
 
 #include <nil/marshalling/container/array_view.hpp>
+#include <nil/marshalling/container/endian_array_view.hpp>
+#include <nil/marshalling/container/lazy_array_view.hpp>
+#include <nil/marshalling/container/memory_resource.hpp>
 #include <nil/marshalling/container/static_vector.hpp>
+#include <nil/marshalling/container/small_vector.hpp>
 #include <nil/marshalling/container/static_string.hpp>
+#include <nil/marshalling/container/small_string.hpp>
 #include <nil/marshalling/container/string_view.hpp>
 #include <nil/marshalling/container/type_traits.hpp>
 
@@ -67,6 +74,9 @@ static_assert(has_member_function_clear<std::vector<std::uint8_t>>::value, "Inva
 static_assert(has_member_function_clear<container::static_string<5>>::value, "Invalid function presence detection");
 static_assert(has_member_function_clear<container::static_vector<std::uint8_t, 5>>::value,
               "Invalid function presence detection");
+static_assert(has_member_function_clear<container::small_string<5>>::value, "Invalid function presence detection");
+static_assert(has_member_function_clear<container::small_vector<std::uint8_t, 5>>::value,
+              "Invalid function presence detection");
 static_assert(!has_member_function_clear<container::string_view>::value, "Invalid function presence detection");
 static_assert(!has_member_function_clear<container::array_view<std::uint8_t>>::value,
               "Invalid function presence detection");
@@ -76,6 +86,9 @@ static_assert(has_member_function_resize<std::vector<std::uint8_t>>::value, "Inv
 static_assert(has_member_function_resize<container::static_string<5>>::value, "Invalid function presence detection");
 static_assert(has_member_function_resize<container::static_vector<std::uint8_t, 5>>::value,
               "Invalid function presence detection");
+static_assert(has_member_function_resize<container::small_string<5>>::value, "Invalid function presence detection");
+static_assert(has_member_function_resize<container::small_vector<std::uint8_t, 5>>::value,
+              "Invalid function presence detection");
 static_assert(!has_member_function_resize<container::string_view>::value, "Invalid function presence detection");
 static_assert(!has_member_function_resize<container::array_view<std::uint8_t>>::value,
               "Invalid function presence detection");
@@ -85,10 +98,20 @@ static_assert(has_member_function_reserve<std::vector<std::uint8_t>>::value, "In
 static_assert(has_member_function_reserve<container::static_string<5>>::value, "Invalid function presence detection");
 static_assert(has_member_function_reserve<container::static_vector<std::uint8_t, 5>>::value,
               "Invalid function presence detection");
+static_assert(has_member_function_reserve<container::small_string<5>>::value, "Invalid function presence detection");
+static_assert(has_member_function_reserve<container::small_vector<std::uint8_t, 5>>::value,
+              "Invalid function presence detection");
 static_assert(!has_member_function_reserve<container::string_view>::value, "Invalid function presence detection");
 static_assert(!has_member_function_reserve<container::array_view<std::uint8_t>>::value,
               "Invalid function presence detection");
 
+static_assert(std::is_nothrow_move_constructible<container::small_vector<std::uint8_t, 5>>::value,
+              "Invalid move noexcept specification");
+static_assert(std::is_nothrow_move_assignable<container::small_vector<std::uint8_t, 5>>::value,
+              "Invalid move noexcept specification");
+static_assert(std::is_nothrow_move_constructible<container::small_vector<std::string, 5>>::value,
+              "Invalid move noexcept specification");
+
 struct types_fixture {
     typedef option::big_endian BigEndianOpt;
     typedef option::little_endian LittleEndianOpt;
@@ -3626,4 +3649,1120 @@ BOOST_AUTO_TEST_CASE(test100) {
     BOOST_CHECK(std::abs(field.get_scaled<double>() - 2.67) < 0.1);
 }
 
+BOOST_AUTO_TEST_CASE(test101) {
+    typedef types::array_list<field_type<option::big_endian>,
+                              types::integral<field_type<option::big_endian>, std::uint32_t>>
+        Field1;
+
+    std::vector<std::uint8_t> buf(4 * 100 + 3);
+    for (std::size_t idx = 0; idx < buf.size(); ++idx) {
+        buf[idx] = static_cast<std::uint8_t>(idx);
+    }
+
+    Field1 field1;
+    const std::uint8_t *readIter = &buf[0];
+    BOOST_CHECK(field1.read(readIter, 4 * 100) == status_type::success);
+    BOOST_CHECK(readIter == &buf[0] + 4 * 100);
+    BOOST_CHECK(field1.value().size() == 100U);
+    BOOST_CHECK(field1.value()[0].value() == 0x00010203U);
+    BOOST_CHECK(field1.value()[99].value() == 0x8c8d8e8fU);
+
+    readIter = &buf[0];
+    BOOST_CHECK(field1.read(readIter, buf.size()) == status_type::not_enough_data);
+    BOOST_CHECK(field1.value().size() == 100U);
+
+    std::vector<std::uint8_t> outBuf(buf.size());
+    std::uint8_t *writeIter = &outBuf[0];
+    BOOST_CHECK(field1.write(writeIter, outBuf.size()) == status_type::success);
+    BOOST_CHECK(writeIter == &outBuf[0] + field1.length());
+    BOOST_CHECK(std::equal(outBuf.begin(), outBuf.begin() + field1.length(), buf.begin()));
+
+    writeIter = &outBuf[0];
+    BOOST_CHECK(field1.write(writeIter, 10) == status_type::buffer_overflow);
+    BOOST_CHECK(writeIter == &outBuf[0] + 8);
+
+    typedef types::array_list<field_type<option::little_endian>, std::int16_t,
+                              option::sequence_size_field_prefix<
+                                  types::integral<field_type<option::little_endian>, std::uint8_t>>>
+        Field2;
+
+    static const std::uint8_t Buf2[] = {0x3, 0x01, 0x02, 0xff, 0xff, 0x00, 0x80};
+    const std::uint8_t *readIter2 = &Buf2[0];
+    Field2 field2;
+    BOOST_CHECK(field2.read(readIter2, sizeof(Buf2)) == status_type::success);
+    BOOST_CHECK(field2.value().size() == 3U);
+    BOOST_CHECK(field2.value()[0] == 0x0201);
+    BOOST_CHECK(field2.value()[1] == -1);
+    BOOST_CHECK(field2.value()[2] == std::numeric_limits<std::int16_t>::min());
+
+    std::uint8_t outBuf2[sizeof(Buf2)] = {0};
+    std::uint8_t *writeIter2 = &outBuf2[0];
+    BOOST_CHECK(field2.write(writeIter2, sizeof(outBuf2)) == status_type::success);
+    BOOST_CHECK(std::equal(std::begin(Buf2), std::end(Buf2), &outBuf2[0]));
+
+    typedef types::array_list<field_type<option::big_endian>,
+                              types::float_value<field_type<option::big_endian>, double>,
+                              option::fixed_size_storage<4>>
+        Field3;
+
+    Field3 field3;
+    field3.value().resize(3);
+    field3.value()[0].value() = 1.5;
+    field3.value()[1].value() = -2.25;
+    field3.value()[2].value() = 1e100;
+
+    std::uint8_t outBuf3[Field3::max_length()] = {0};
+    std::uint8_t *writeIter3 = &outBuf3[0];
+    BOOST_CHECK(field3.write(writeIter3, sizeof(outBuf3)) == status_type::success);
+    BOOST_CHECK(outBuf3[0] == 0x3f);
+    BOOST_CHECK(outBuf3[1] == 0xf8);
+
+    Field3 field4;
+    const std::uint8_t *readIter3 = &outBuf3[0];
+    BOOST_CHECK(field4.read(readIter3, field3.length()) == status_type::success);
+    BOOST_CHECK(field3 == field4);
+}
+
+BOOST_AUTO_TEST_CASE(test102) {
+    typedef types::array_list<field_type<option::big_endian>,
+                              types::integral<field_type<option::big_endian>, std::uint16_t>>
+        Field1;
+
+    std::vector<std::uint8_t> buf(2 * 1000);
+    for (std::size_t idx = 0; idx < buf.size(); ++idx) {
+        buf[idx] = static_cast<std::uint8_t>(idx * 7);
+    }
+
+    std::size_t tasks = 0;
+    parallel_policy policy(
+        [&tasks](std::size_t count, const parallel_policy::task_type &task) {
+            tasks += count;
+            for (std::size_t idx = count; idx > 0; --idx) {
+                task(idx - 1);
+            }
+        },
+        8, 0);
+
+    Field1 serial;
+    const std::uint8_t *readIter = &buf[0];
+    BOOST_CHECK(serial.read(readIter, buf.size()) == status_type::success);
+
+    Field1 field1;
+    readIter = &buf[0];
+    BOOST_CHECK(field1.read(readIter, buf.size(), policy) == status_type::success);
+    BOOST_CHECK(readIter == &buf[0] + buf.size());
+    BOOST_CHECK(tasks == 8U);
+    BOOST_CHECK(field1 == serial);
+
+    std::vector<std::uint8_t> outBuf(buf.size());
+    std::uint8_t *writeIter = &outBuf[0];
+    BOOST_CHECK(field1.write(writeIter, outBuf.size(), policy) == status_type::success);
+    BOOST_CHECK(writeIter == &outBuf[0] + outBuf.size());
+    BOOST_CHECK(tasks == 16U);
+    BOOST_CHECK(outBuf == buf);
+
+    writeIter = &outBuf[0];
+    BOOST_CHECK(field1.write(writeIter, 11, policy) == status_type::buffer_overflow);
+
+    parallel_policy threads(4, 0);
+    Field1 field2;
+    readIter = &buf[0];
+    BOOST_CHECK(field2.read(readIter, buf.size() - 1, threads) == status_type::not_enough_data);
+    readIter = &buf[0];
+    BOOST_CHECK(field2.read(readIter, buf.size(), threads) == status_type::success);
+    BOOST_CHECK(field2 == serial);
+
+    typedef types::array_list<field_type<option::big_endian>,
+                              types::integral<field_type<option::big_endian>, std::uint16_t>,
+                              option::sequence_size_field_prefix<
+                                  types::integral<field_type<option::big_endian>, std::uint16_t>>>
+        Field2;
+
+    Field2 field3;
+    field3.value() = serial.value();
+    std::vector<std::uint8_t> outBuf2(field3.length());
+    writeIter = &outBuf2[0];
+    BOOST_CHECK(field3.write(writeIter, outBuf2.size(), threads) == status_type::success);
+
+    Field2 field4;
+    readIter = &outBuf2[0];
+    BOOST_CHECK(field4.read(readIter, outBuf2.size(), threads) == status_type::success);
+    BOOST_CHECK(field3 == field4);
+    typedef types::array_list<field_type<option::big_endian>,
+                              types::integral<field_type<option::big_endian>, std::uint16_t>,
+                              option::fixed_size_storage<100>>
+        Field3;
+
+    Field3 field5;
+    const std::uint8_t *serialIter = &buf[0];
+    auto serialStatus = field5.read(serialIter, buf.size());
+
+    Field3 field6;
+    readIter = &buf[0];
+    BOOST_CHECK(field6.read(readIter, buf.size(), threads) == serialStatus);
+    BOOST_CHECK(readIter == serialIter);
+    BOOST_CHECK(field6 == field5);
+}
+
+BOOST_AUTO_TEST_CASE(test103) {
+    using FieldBase = field_type<option::big_endian>;
+    using SizePrefix = types::integral<FieldBase, std::uint8_t>;
+    typedef types::bundle<
+        FieldBase,
+        std::tuple<types::integral<FieldBase, std::uint16_t>,
+                   types::array_list<FieldBase, std::uint8_t, option::sequence_size_field_prefix<SizePrefix>>,
+                   types::string<FieldBase, option::sequence_size_field_prefix<SizePrefix>>,
+                   types::integral<FieldBase, std::uint32_t, option::var_length<1, 4>>,
+                   types::array_list<FieldBase, types::integral<FieldBase, std::uint32_t>>>>
+        Field1;
+
+    Field1 field;
+    std::get<0>(field.value()).value() = 0x1234;
+    std::get<1>(field.value()).value() = {1, 2, 3, 4, 5};
+    std::get<2>(field.value()).value() = "hello";
+    std::get<3>(field.value()).value() = 0x12345;
+    for (std::uint32_t idx = 0; idx < 10; ++idx) {
+        std::get<4>(field.value()).value().emplace_back(idx * 0x01010101U);
+    }
+
+    std::vector<std::uint8_t> buf(field.length());
+    std::uint8_t *writeIter = &buf[0];
+    BOOST_CHECK(field.write(writeIter, buf.size()) == status_type::success);
+
+    for (std::size_t chunk : {std::size_t(1), std::size_t(3), std::size_t(7), buf.size()}) {
+        accumulator_set<Field1> acc;
+        for (std::size_t pos = 0; pos < buf.size(); pos += chunk) {
+            std::size_t len = std::min(chunk, buf.size() - pos);
+            std::vector<std::uint8_t> part(buf.begin() + pos, buf.begin() + pos + len);
+            if ((pos + len) < buf.size()) {
+                acc(part);
+                BOOST_CHECK(accumulators::status<Field1>(acc) == status_type::not_enough_data);
+            } else {
+                acc(part, accumulators::expected_status = status_type::success);
+            }
+        }
+
+        BOOST_CHECK(accumulators::status<Field1>(acc) == status_type::success);
+        BOOST_CHECK(accumulators::consumed<Field1>(acc) == buf.size());
+        BOOST_CHECK(accumulators::marshalling<Field1>(acc) == field);
+    }
+
+    typedef types::integral<FieldBase, std::uint32_t> Field2;
+
+    static const std::uint8_t Buf2[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+    accumulator_set<Field2> acc2;
+    acc2(&Buf2[0], accumulators::buffer_length = 3);
+    BOOST_CHECK(accumulators::status<Field2>(acc2) == status_type::not_enough_data);
+    acc2(&Buf2[3], accumulators::buffer_length = 2);
+    BOOST_CHECK(accumulators::status<Field2>(acc2) == status_type::success);
+    BOOST_CHECK(accumulators::leftover<Field2>(acc2) == 1U);
+    BOOST_CHECK(accumulators::marshalling<Field2>(acc2).value() == 0x01020304U);
+
+    typedef types::array_list<FieldBase, std::uint8_t, option::fixed_size_storage<3>> Field3;
+
+    static const std::uint8_t Buf3[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+    Field3 field3;
+    const std::uint8_t *readIter = &Buf3[0];
+    status_type es3 = field3.read(readIter, sizeof(Buf3));
+
+    accumulator_set<Field3> acc3;
+    for (std::size_t pos = 0; pos < sizeof(Buf3); ++pos) {
+        acc3(&Buf3[pos], accumulators::buffer_length = 1);
+    }
+    acc3(&Buf3[0], accumulators::buffer_length = 0, accumulators::expected_status = status_type::success);
+    BOOST_CHECK(accumulators::status<Field3>(acc3) == es3);
+    BOOST_CHECK(accumulators::consumed<Field3>(acc3) == static_cast<std::size_t>(readIter - &Buf3[0]));
+    BOOST_CHECK(accumulators::marshalling<Field3>(acc3) == field3);
+
+    typedef types::array_list<FieldBase, types::integral<FieldBase, std::uint16_t>,
+                              option::sequence_ser_length_field_prefix<SizePrefix>>
+        Field4;
+
+    Field4 field4;
+    for (std::uint16_t idx = 0; idx < 100; ++idx) {
+        field4.value().emplace_back(idx);
+    }
+
+    std::vector<std::uint8_t> buf4(field4.length() + 1U);
+    writeIter = &buf4[0];
+    BOOST_CHECK(field4.write(writeIter, buf4.size()) == status_type::success);
+
+    accumulator_set<Field4> acc4;
+    for (std::size_t pos = 0; pos < buf4.size(); ++pos) {
+        acc4(&buf4[pos], accumulators::buffer_length = 1);
+        BOOST_CHECK((accumulators::status<Field4>(acc4) == status_type::success) == ((pos + 2U) >= buf4.size()));
+    }
+
+    BOOST_CHECK(accumulators::consumed<Field4>(acc4) == field4.length());
+    BOOST_CHECK(accumulators::leftover<Field4>(acc4) == 1U);
+    BOOST_CHECK(accumulators::marshalling<Field4>(acc4) == field4);
+}
+
+BOOST_AUTO_TEST_CASE(test104) {
+    using FieldBase = field_type<option::big_endian>;
+    typedef types::bundle<FieldBase, std::tuple<types::integral<FieldBase, std::uint16_t>,
+                                                types::integral<FieldBase, std::uint8_t, option::valid_num_value_range<0, 10>,
+                                                                option::fail_on_invalid<>>>>
+        Element;
+
+    typedef types::array_list<FieldBase, Element> Field1;
+    typedef types::array_list<FieldBase, Element, option::fixed_size_storage<4>> Field2;
+
+    static const std::uint8_t Buf[] = {0x00, 0x01, 0x02, 0x00, 0x03, 0x04, 0x00, 0x05, 0x06, 0x00, 0x07};
+
+    Field1 field1;
+    const std::uint8_t *readIter = &Buf[0];
+    BOOST_CHECK(field1.read(readIter, 9) == status_type::success);
+    BOOST_CHECK(readIter == &Buf[0] + 9);
+    BOOST_CHECK(field1.value().size() == 3U);
+    BOOST_CHECK(std::get<0>(field1.value()[2].value()).value() == 0x0005);
+    BOOST_CHECK(std::get<1>(field1.value()[2].value()).value() == 6U);
+
+    readIter = &Buf[0];
+    BOOST_CHECK(field1.read(readIter, sizeof(Buf)) == status_type::not_enough_data);
+    BOOST_CHECK(field1.value().size() == 3U);
+
+    static const std::uint8_t Buf2[] = {0x00, 0x01, 0x02, 0x00, 0x03, 0x0b, 0x00, 0x05, 0x06};
+    readIter = &Buf2[0];
+    BOOST_CHECK(field1.read(readIter, sizeof(Buf2)) == status_type::invalid_msg_data);
+    BOOST_CHECK(field1.value().size() == 1U);
+
+    Field2 field2;
+    readIter = &Buf[0];
+    BOOST_CHECK(field2.read(readIter, sizeof(Buf)) == status_type::not_enough_data);
+    BOOST_CHECK(field2.value().size() == 3U);
+
+    std::list<std::uint8_t> bufList(std::begin(Buf), std::end(Buf));
+    auto listIter = bufList.cbegin();
+    BOOST_CHECK(field2.read(listIter, 9) == status_type::success);
+    BOOST_CHECK(field2.value().size() == 3U);
+    BOOST_CHECK(field1.value()[0] == field2.value()[0]);
+}
+
+BOOST_AUTO_TEST_CASE(test105) {
+    using testing_type = Test70_Field<option::variant_key_dispatch<types::integral<Test70_FieldBase, std::uint8_t>>>;
+
+    static const std::vector<char> Buf = {0x1, 0x2, 0x3};
+
+    status_type status;
+    testing_type field;
+    field = pack<testing_type>(Buf, status);
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(field.current_field() == 0U);
+    BOOST_CHECK(std::get<1>(field.accessField_mem1().value()).value() == 0x0203);
+
+    static const std::vector<char> Buf2 = {0x2, 0x3, 0x4};
+    field = pack<testing_type>(Buf2, status);
+    BOOST_CHECK(status == status_type::not_enough_data);
+    BOOST_CHECK(!field.current_field_valid());
+
+    static const std::vector<char> Buf3 = {0x2, 0x3, 0x4, 0x5, 0x6};
+    field = pack<testing_type>(Buf3, status);
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(field.current_field() == 1U);
+    BOOST_CHECK(std::get<1>(field.accessField_mem2().value()).value() == 0x03040506U);
+
+    static const std::vector<char> Buf4 = {0x3, 0x3, 0x4, 0x5, 0x6};
+    field = pack<testing_type>(Buf4, status);
+    BOOST_CHECK(status == status_type::invalid_msg_data);
+    BOOST_CHECK(!field.current_field_valid());
+
+    static const std::vector<char> Buf5 = {};
+    field = pack<testing_type>(Buf5, status);
+    BOOST_CHECK(status == status_type::not_enough_data);
+    BOOST_CHECK(!field.current_field_valid());
+
+    Test70_Field<> field2;
+    field2 = pack<Test70_Field<>>(Buf3, status);
+    field = pack<testing_type>(Buf3, status);
+    std::vector<std::uint8_t> outBuf = pack(field2, status);
+    std::vector<std::uint8_t> outBuf2 = pack(field, status);
+    BOOST_CHECK(outBuf == outBuf2);
+}
+
+BOOST_AUTO_TEST_CASE(test106) {
+    enum class Test106_Enum : std::uint8_t { V0, V1, V2, V3 };
+
+    using Mem1 = types::integral<field_type<option::big_endian>, std::int16_t, option::fixed_bit_length<5>>;
+    using Mem2 = types::enumeration<field_type<option::big_endian>, Test106_Enum, option::fixed_bit_length<2>>;
+    using Mem3 = types::integral<field_type<option::big_endian>, std::uint8_t, option::fixed_bit_length<3>,
+                                 option::num_value_ser_offset<1>>;
+    using Mem4 = types::integral<field_type<option::big_endian>, std::uint8_t, option::fixed_bit_length<6>,
+                                 option::valid_num_value_range<0, 10>, option::fail_on_invalid<>>;
+
+    static_assert(types::detail::is_bitfield_member_direct_accessible<Mem1>::value, "Invalid access assumption");
+    static_assert(types::detail::is_bitfield_member_direct_accessible<Mem2>::value, "Invalid access assumption");
+    static_assert(!types::detail::is_bitfield_member_direct_accessible<Mem3>::value, "Invalid access assumption");
+    static_assert(!types::detail::is_bitfield_member_direct_accessible<Mem4>::value, "Invalid access assumption");
+
+    typedef types::bitfield<field_type<option::big_endian>, std::tuple<Mem1, Mem2, Mem3, Mem4>> testing_type;
+
+    testing_type field;
+    BOOST_CHECK(field.length() == 2U);
+
+    // Mem1 = -3 (0b11101), Mem2 = V2, Mem3 = 2 (serialised as 3), Mem4 = 9
+    static const std::vector<char> Buf = {(char)0x25, (char)0xdd};
+
+    status_type status;
+    field = pack<testing_type>(Buf, status);
+    BOOST_CHECK(status == status_type::success);
+    auto &members = field.value();
+    BOOST_CHECK(std::get<0>(members).value() == -3);
+    BOOST_CHECK(std::get<1>(members).value() == Test106_Enum::V2);
+    BOOST_CHECK(std::get<2>(members).value() == 2U);
+    BOOST_CHECK(std::get<3>(members).value() == 9U);
+
+    std::vector<std::uint8_t> outBuf = pack(field, status);
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(outBuf.size() == 2U);
+    BOOST_CHECK(outBuf[0] == 0x25);
+    BOOST_CHECK(outBuf[1] == 0xdd);
+
+    std::get<0>(members).value() = 15;
+    std::get<1>(members).value() = Test106_Enum::V3;
+    std::vector<std::uint8_t> outBuf2 = pack(field, status);
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(outBuf2.size() == 2U);
+    BOOST_CHECK(outBuf2[0] == 0x25);
+    BOOST_CHECK(outBuf2[1] == 0xef);
+
+    static const std::vector<char> Buf2 = {(char)0x6d, (char)0xdd};
+    field = pack<testing_type>(Buf2, status);
+    BOOST_CHECK(status == status_type::invalid_msg_data);
+}
+
+BOOST_AUTO_TEST_CASE(test107) {
+    using Mem1 = types::integral<field_type<option::big_endian>, std::uint16_t>;
+    using Mem2 = types::bitfield<
+        field_type<option::big_endian>,
+        std::tuple<types::integral<field_type<option::big_endian>, std::uint8_t, option::fixed_bit_length<4>>,
+                   types::integral<field_type<option::big_endian>, std::uint8_t, option::fixed_bit_length<4>>>>;
+    using Mem3 = types::bundle<field_type<option::big_endian>,
+                               std::tuple<types::integral<field_type<option::big_endian>, std::uint8_t>,
+                                          types::integral<field_type<option::big_endian>, std::int32_t,
+                                                          option::fixed_length<3>>>>;
+    using Mem4 = types::integral<field_type<option::big_endian>, std::uint8_t, option::valid_num_value_range<0, 10>,
+                                 option::fail_on_invalid<>>;
+
+    using testing_type = types::bundle<field_type<option::big_endian>, std::tuple<Mem1, Mem2, Mem3>>;
+    using checked_type = types::bundle<field_type<option::big_endian>, std::tuple<Mem1, Mem4>>;
+
+    static_assert(types::detail::are_fixed_layout_members<testing_type::value_type>::value,
+                  "Invalid layout assumption");
+    static_assert(!types::detail::are_fixed_layout_members<checked_type::value_type>::value,
+                  "Invalid layout assumption");
+
+    static const std::vector<char> Buf = {0x01, 0x02, 0x34, 0x05, (char)0xff, (char)0xff, (char)0xfe};
+
+    status_type status;
+    testing_type field;
+    field = pack<testing_type>(Buf, status);
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(std::get<0>(field.value()).value() == 0x0102);
+    BOOST_CHECK(std::get<0>(std::get<1>(field.value()).value()).value() == 0x4);
+    BOOST_CHECK(std::get<1>(std::get<1>(field.value()).value()).value() == 0x3);
+    BOOST_CHECK(std::get<0>(std::get<2>(field.value()).value()).value() == 0x05);
+    BOOST_CHECK(std::get<1>(std::get<2>(field.value()).value()).value() == -2);
+
+    std::vector<std::uint8_t> outBuf = pack(field, status);
+    BOOST_CHECK(status == status_type::success);
+    BOOST_CHECK(outBuf.size() == Buf.size());
+    BOOST_CHECK(std::equal(outBuf.begin(), outBuf.end(), Buf.begin(),
+                           [](std::uint8_t v1, char v2) { return v1 == static_cast<std::uint8_t>(v2); }));
+
+    const auto *readIter = reinterpret_cast<const std::uint8_t *>(&Buf[0]);
+    BOOST_CHECK(field.read(readIter, Buf.size() - 1) == status_type::not_enough_data);
+    BOOST_CHECK(field.read_from<1>(readIter, 5U) == status_type::success);
+    BOOST_CHECK(std::get<0>(std::get<2>(field.value()).value()).value() == 0x02);
+
+    std::vector<std::uint8_t> outBuf2(testing_type::max_length() - 1);
+    auto writeIter = &outBuf2[0];
+    BOOST_CHECK(field.write(writeIter, outBuf2.size()) == status_type::buffer_overflow);
+
+    static const std::vector<char> Buf2 = {0x01, 0x02, 0x0b};
+    checked_type field2;
+    field2 = pack<checked_type>(Buf2, status);
+    BOOST_CHECK(status == status_type::invalid_msg_data);
+}
+
+BOOST_AUTO_TEST_CASE(test108) {
+    typedef types::integral<field_type<option::little_endian>, std::uint32_t, option::var_length<1, 4>> le_type;
+    typedef types::integral<field_type<option::big_endian>, std::int32_t, option::var_length<2, 4>> be_type;
+
+    // Trailing bytes allow whole word access to the buffer
+    static const std::uint8_t Buf1[] = {0x80, 0x80, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55};
+
+    le_type leField;
+    const std::uint8_t *readIter = &Buf1[0];
+    BOOST_CHECK(leField.read(readIter, sizeof(Buf1)) == status_type::success);
+    BOOST_CHECK(leField.value() == 0x4000U);
+    BOOST_CHECK(readIter == &Buf1[3]);
+
+    std::uint8_t outBuf[sizeof(Buf1)] = {0};
+    std::uint8_t *writeIter = &outBuf[0];
+    BOOST_CHECK(leField.write(writeIter, sizeof(outBuf)) == status_type::success);
+    BOOST_CHECK(writeIter == &outBuf[3]);
+    BOOST_CHECK(std::equal(&outBuf[0], writeIter, &Buf1[0]));
+    BOOST_CHECK(outBuf[3] == 0U);
+
+    writeIter = &outBuf[0];
+    BOOST_CHECK(leField.write(writeIter, 2U) == status_type::buffer_overflow);
+
+    static const std::uint8_t Buf2[] = {0x80, 0x80, 0x80, 0x80, 0x01, 0x55, 0x55, 0x55, 0x55};
+    readIter = &Buf2[0];
+    BOOST_CHECK(leField.read(readIter, sizeof(Buf2)) == status_type::protocol_error);
+
+    static const std::uint8_t Buf3[] = {0xff, 0x7f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55};
+    be_type beField;
+    readIter = &Buf3[0];
+    BOOST_CHECK(beField.read(readIter, sizeof(Buf3)) == status_type::success);
+    BOOST_CHECK(beField.value() == -1);
+    BOOST_CHECK(readIter == &Buf3[2]);
+
+    static const std::uint8_t Buf4[] = {0x7f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55};
+    readIter = &Buf4[0];
+    BOOST_CHECK(beField.read(readIter, sizeof(Buf4)) == status_type::protocol_error);
+
+    beField.value() = 0x40000;
+    BOOST_CHECK(beField.length() == 3U);
+    writeIter = &outBuf[0];
+    BOOST_CHECK(beField.write(writeIter, sizeof(outBuf)) == status_type::success);
+    BOOST_CHECK(writeIter == &outBuf[3]);
+    BOOST_CHECK(outBuf[0] == 0x90);
+    BOOST_CHECK(outBuf[1] == 0x80);
+    BOOST_CHECK(outBuf[2] == 0x00);
+
+    be_type beField2;
+    readIter = &outBuf[0];
+    BOOST_CHECK(beField2.read(readIter, sizeof(outBuf)) == status_type::success);
+    BOOST_CHECK(beField2.value() == 0x40000);
+}
+
+BOOST_AUTO_TEST_CASE(test109) {
+    typedef types::integral<field_type<option::little_endian>, std::uint8_t> le_size_type;
+    typedef types::array_list<field_type<option::little_endian>, std::uint32_t,
+                              option::sequence_size_field_prefix<le_size_type>, option::sequence_group_varint>
+        le_type;
+
+    static const std::uint8_t Buf1[] = {0x05, 0xe4, 0x01, 0x2c, 0x01, 0x70, 0x11,
+                                        0x01, 0x04, 0x03, 0x02, 0x01, 0x00, 0x05};
+
+    le_type leField;
+    const std::uint8_t *readIter = &Buf1[0];
+    BOOST_CHECK(leField.read(readIter, sizeof(Buf1)) == status_type::success);
+    BOOST_CHECK(readIter == &Buf1[0] + sizeof(Buf1));
+    BOOST_CHECK(leField.value().size() == 5U);
+    BOOST_CHECK(leField.value()[0] == 1U);
+    BOOST_CHECK(leField.value()[1] == 300U);
+    BOOST_CHECK(leField.value()[2] == 70000U);
+    BOOST_CHECK(leField.value()[3] == 0x01020304U);
+    BOOST_CHECK(leField.value()[4] == 5U);
+    BOOST_CHECK(leField.length() == sizeof(Buf1));
+
+    std::uint8_t outBuf[sizeof(Buf1)] = {0};
+    std::uint8_t *writeIter = &outBuf[0];
+    BOOST_CHECK(leField.write(writeIter, sizeof(outBuf)) == status_type::success);
+    BOOST_CHECK(writeIter == &outBuf[0] + sizeof(outBuf));
+    BOOST_CHECK(std::equal(&outBuf[0], writeIter, &Buf1[0]));
+
+    writeIter = &outBuf[0];
+    BOOST_CHECK(leField.write(writeIter, sizeof(outBuf) - 1U) == status_type::buffer_overflow);
+
+    readIter = &Buf1[0];
+    BOOST_CHECK(leField.read(readIter, sizeof(Buf1) - 1U) == status_type::not_enough_data);
+
+    // Full groups followed by enough bytes are decoded as a whole
+    le_type leField2;
+    for (std::uint32_t idx = 0U; idx < 32U; ++idx) {
+        leField2.value().push_back(idx << idx);
+    }
+
+    std::vector<std::uint8_t> outBuf2(leField2.length() + 16U, 0U);
+    writeIter = &outBuf2[0];
+    BOOST_CHECK(leField2.write(writeIter, outBuf2.size()) == status_type::success);
+    BOOST_CHECK(writeIter == &outBuf2[0] + leField2.length());
+
+    le_type leField3;
+    readIter = &outBuf2[0];
+    BOOST_CHECK(leField3.read(readIter, outBuf2.size()) == status_type::success);
+    BOOST_CHECK(readIter == &outBuf2[0] + leField2.length());
+    BOOST_CHECK(leField3 == leField2);
+
+    typedef types::integral<field_type<option::big_endian>, std::uint8_t> be_size_type;
+    typedef types::array_list<field_type<option::big_endian>, std::uint16_t,
+                              option::sequence_size_field_prefix<be_size_type>, option::sequence_group_varint>
+        be_type;
+
+    static const std::uint8_t Buf2[] = {0x02, 0x04, 0x7f, 0x12, 0x34};
+    be_type beField;
+    readIter = &Buf2[0];
+    BOOST_CHECK(beField.read(readIter, sizeof(Buf2)) == status_type::success);
+    BOOST_CHECK(beField.value().size() == 2U);
+    BOOST_CHECK(beField.value()[0] == 0x7fU);
+    BOOST_CHECK(beField.value()[1] == 0x1234U);
+
+    static const std::uint8_t Buf3[] = {0x01, 0x03, 0x01, 0x02, 0x03, 0x04};
+    readIter = &Buf3[0];
+    BOOST_CHECK(beField.read(readIter, sizeof(Buf3)) == status_type::protocol_error);
+
+    // Full groups of big endian values are decoded as a whole as well
+    typedef types::array_list<field_type<option::big_endian>, std::uint32_t,
+                              option::sequence_size_field_prefix<be_size_type>, option::sequence_group_varint>
+        be32_type;
+
+    static const std::uint8_t Buf4[] = {0x05, 0xe4, 0x01, 0x01, 0x2c, 0x01, 0x11, 0x70,
+                                        0x01, 0x02, 0x03, 0x04, 0x00, 0x05};
+    be32_type be32Field;
+    readIter = &Buf4[0];
+    BOOST_CHECK(be32Field.read(readIter, sizeof(Buf4)) == status_type::success);
+    BOOST_CHECK(readIter == &Buf4[0] + sizeof(Buf4));
+    BOOST_CHECK(be32Field.value().size() == 5U);
+    BOOST_CHECK(be32Field.value()[1] == 300U);
+    BOOST_CHECK(be32Field.value()[2] == 70000U);
+    BOOST_CHECK(be32Field.value()[3] == 0x01020304U);
+
+    be32_type be32Field2;
+    for (std::uint32_t idx = 0U; idx < 32U; ++idx) {
+        be32Field2.value().push_back(idx << idx);
+    }
+
+    std::vector<std::uint8_t> outBuf3(be32Field2.length() + 16U, 0U);
+    writeIter = &outBuf3[0];
+    BOOST_CHECK(be32Field2.write(writeIter, outBuf3.size()) == status_type::success);
+    BOOST_CHECK(writeIter == &outBuf3[0] + be32Field2.length());
+
+    be32_type be32Field3;
+    readIter = &outBuf3[0];
+    BOOST_CHECK(be32Field3.read(readIter, outBuf3.size()) == status_type::success);
+    BOOST_CHECK(readIter == &outBuf3[0] + be32Field2.length());
+    BOOST_CHECK(be32Field3 == be32Field2);
+}
+
+BOOST_AUTO_TEST_CASE(test110) {
+    typedef types::integral<field_type<option::big_endian>, std::uint16_t, option::default_num_value<0x0d0a>>
+        term_type;
+    typedef types::string<field_type<option::big_endian>, option::sequence_termination_field_suffix<term_type>>
+        testing_type;
+
+    static const char Buf1[] = {'a', 0x0d, 'b', 0x0a, 'c', 0x0d, 0x0a, 'd'};
+    testing_type field;
+    const char *readIter = &Buf1[0];
+    BOOST_CHECK(field.read(readIter, sizeof(Buf1)) == status_type::success);
+    BOOST_CHECK(field.value() == std::string(&Buf1[0], 5U));
+    BOOST_CHECK(readIter == &Buf1[7]);
+
+    std::vector<char> buf2(&Buf1[0], &Buf1[0] + sizeof(Buf1));
+    testing_type field2;
+    auto vecIter = buf2.cbegin();
+    BOOST_CHECK(field2.read(vecIter, buf2.size()) == status_type::success);
+    BOOST_CHECK(field2 == field);
+    BOOST_CHECK(vecIter == buf2.cbegin() + 7);
+
+    // Terminator must not be accessed beyond the end of the input
+    readIter = &Buf1[0];
+    BOOST_CHECK(field.read(readIter, 6U) == status_type::not_enough_data);
+
+    typedef types::integral<field_type<option::big_endian>, std::uint16_t> elem_type;
+    typedef types::integral<field_type<option::big_endian>, std::uint8_t> list_term_type;
+    typedef types::array_list<field_type<option::big_endian>, elem_type,
+                              option::sequence_termination_field_suffix<list_term_type>>
+        list_type;
+
+    static const char Buf3[] = {0x01, 0x00, 0x02, 0x00, 0x00, 0x03};
+    list_type listField;
+    readIter = &Buf3[0];
+    BOOST_CHECK(listField.read(readIter, sizeof(Buf3)) == status_type::success);
+    BOOST_CHECK(listField.value().size() == 2U);
+    BOOST_CHECK(listField.value()[0].value() == 0x0100U);
+    BOOST_CHECK(listField.value()[1].value() == 0x0200U);
+    BOOST_CHECK(readIter == &Buf3[5]);
+}
+
+BOOST_AUTO_TEST_CASE(test111) {
+    typedef types::integral<field_type<option::big_endian>, std::uint8_t, option::valid_num_value_range<0, 5>>
+        elem_type;
+    typedef types::integral<field_type<option::big_endian>, std::uint8_t> size_type;
+    typedef types::array_list<field_type<option::big_endian>, elem_type, option::sequence_size_field_prefix<size_type>,
+                              option::ignore_invalid>
+        testing_type;
+
+    static const char Buf1[] = {0x2, 0x1, 0x2};
+    testing_type field;
+    const char *readIter = &Buf1[0];
+    BOOST_CHECK(field.read(readIter, sizeof(Buf1)) == status_type::success);
+    BOOST_CHECK(field.value().size() == 2U);
+    BOOST_CHECK(field.value()[1].value() == 0x2);
+
+    static const char Buf2[] = {0x3, 0x3, 0x4, 0x9};
+    readIter = &Buf2[0];
+    BOOST_CHECK(field.read(readIter, sizeof(Buf2)) == status_type::success);
+    BOOST_CHECK(readIter == &Buf2[0] + sizeof(Buf2));
+    BOOST_CHECK(field.value().size() == 2U);
+    BOOST_CHECK(field.value()[0].value() == 0x1);
+    BOOST_CHECK(field.value()[1].value() == 0x2);
+
+    readIter = &Buf2[0];
+    BOOST_CHECK(field.read(readIter, sizeof(Buf2) - 1U) == status_type::not_enough_data);
+    BOOST_CHECK(field.value().size() == 2U);
+    BOOST_CHECK(field.value()[0].value() == 0x1);
+
+    // The storage of the empty field is kept by the invalid read
+    field.value().clear();
+    field.value().reserve(8U);
+    auto capacity = field.value().capacity();
+    readIter = &Buf2[0];
+    BOOST_CHECK(field.read(readIter, sizeof(Buf2)) == status_type::success);
+    BOOST_CHECK(field.value().empty());
+    BOOST_CHECK(field.value().capacity() == capacity);
+
+    // The capacity is kept when the populated field is read again
+    readIter = &Buf1[0];
+    BOOST_CHECK(field.read(readIter, sizeof(Buf1)) == status_type::success);
+    for (int idx = 0; idx < 4; ++idx) {
+        readIter = &Buf1[0];
+        BOOST_CHECK(field.read(readIter, sizeof(Buf1)) == status_type::success);
+        BOOST_CHECK(field.value().size() == 2U);
+        BOOST_CHECK(field.value()[1].value() == 0x2);
+    }
+
+    readIter = &Buf2[0];
+    BOOST_CHECK(field.read(readIter, sizeof(Buf2)) == status_type::success);
+    BOOST_CHECK(field.value().size() == 2U);
+    BOOST_CHECK(field.value()[1].value() == 0x2);
+
+    testing_type fieldCopy(field);
+    BOOST_CHECK(fieldCopy == field);
+
+    typedef types::array_list<field_type<option::big_endian>, elem_type, option::sequence_size_field_prefix<size_type>,
+                              option::fixed_size_storage<4>, option::ignore_invalid>
+        static_testing_type;
+
+    static_testing_type staticField;
+    readIter = &Buf1[0];
+    BOOST_CHECK(staticField.read(readIter, sizeof(Buf1)) == status_type::success);
+    BOOST_CHECK(staticField.value().size() == 2U);
+
+    readIter = &Buf2[0];
+    BOOST_CHECK(staticField.read(readIter, sizeof(Buf2)) == status_type::success);
+    BOOST_CHECK(staticField.value().size() == 2U);
+    BOOST_CHECK(staticField.value()[1].value() == 0x2);
+
+    staticField.value().clear();
+    readIter = &Buf2[0];
+    BOOST_CHECK(staticField.read(readIter, sizeof(Buf2)) == status_type::success);
+    BOOST_CHECK(staticField.value().empty());
+}
+
+BOOST_AUTO_TEST_CASE(test112) {
+    typedef types::integral<field_type<option::big_endian>, std::int16_t, option::valid_num_value_range<40, 50>,
+                            option::valid_num_value_range<-10, -5>, option::valid_num_value_range<45, 60>,
+                            option::valid_num_value_range<61, 61>, option::valid_num_value_range<100, 100>,
+                            option::valid_num_value_range<-4, -4>>
+        testing_type;
+
+    testing_type field;
+    static const std::int16_t ValidValues[] = {-10, -5, -4, 40, 50, 55, 61, 100};
+    for (auto val : ValidValues) {
+        field.value() = val;
+        BOOST_CHECK(field.valid());
+    }
+
+    static const std::int16_t InvalidValues[] = {-11, -3, 0, 39, 62, 99, 101, 1000, -1000};
+    for (auto val : InvalidValues) {
+        field.value() = val;
+        BOOST_CHECK(!field.valid());
+    }
+
+    typedef types::integral<field_type<option::big_endian>, std::uint32_t, option::valid_num_value_range<0, 10>,
+                            option::valid_num_value_range<100000, 200000>>
+        wide_type;
+
+    wide_type wideField;
+    wideField.value() = 150000U;
+    BOOST_CHECK(wideField.valid());
+    wideField.value() = 50000U;
+    BOOST_CHECK(!wideField.valid());
+
+    typedef types::array_list<field_type<option::big_endian>, testing_type> list_type;
+    list_type list;
+    for (unsigned idx = 0U; idx < 100U; ++idx) {
+        list.value().emplace_back(ValidValues[idx % (sizeof(ValidValues) / sizeof(ValidValues[0]))]);
+    }
+    BOOST_CHECK(list.valid());
+
+    list.value()[70].value() = 62;
+    BOOST_CHECK(!list.valid());
+
+    typedef types::array_list<field_type<option::big_endian>, wide_type> wide_list_type;
+    wide_list_type wideList;
+    wideList.value().resize(130U);
+    BOOST_CHECK(wideList.valid());
+
+    wideList.value()[129].value() = 11U;
+    BOOST_CHECK(!wideList.valid());
+
+    // More than 16 ranges spanning too many values for the bitmap
+    typedef types::integral<field_type<option::big_endian>, std::uint16_t,
+                            option::valid_num_value_range<9000, 9010>, option::valid_num_value_range<0, 10>,
+                            option::valid_num_value_range<17000, 17010>, option::valid_num_value_range<4000, 4010>,
+                            option::valid_num_value_range<12000, 12010>, option::valid_num_value_range<1000, 1010>,
+                            option::valid_num_value_range<15000, 15010>, option::valid_num_value_range<7000, 7010>,
+                            option::valid_num_value_range<3000, 3010>, option::valid_num_value_range<10000, 10010>,
+                            option::valid_num_value_range<16000, 16010>, option::valid_num_value_range<2000, 2010>,
+                            option::valid_num_value_range<14000, 14010>, option::valid_num_value_range<5000, 5010>,
+                            option::valid_num_value_range<11000, 11010>, option::valid_num_value_range<8000, 8010>,
+                            option::valid_num_value_range<13000, 13010>, option::valid_num_value_range<6000, 6010>>
+        many_ranges_type;
+
+    many_ranges_type manyField;
+    for (std::uint16_t idx = 0U; idx < 18U; ++idx) {
+        manyField.value() = static_cast<std::uint16_t>(idx * 1000U);
+        BOOST_CHECK(manyField.valid());
+        manyField.value() = static_cast<std::uint16_t>((idx * 1000U) + 5U);
+        BOOST_CHECK(manyField.valid());
+        manyField.value() = static_cast<std::uint16_t>((idx * 1000U) + 10U);
+        BOOST_CHECK(manyField.valid());
+        manyField.value() = static_cast<std::uint16_t>((idx * 1000U) + 11U);
+        BOOST_CHECK(!manyField.valid());
+        manyField.value() = static_cast<std::uint16_t>((idx * 1000U) + 999U);
+        BOOST_CHECK(!manyField.valid());
+    }
+    manyField.value() = std::numeric_limits<std::uint16_t>::max();
+    BOOST_CHECK(!manyField.valid());
+
+    typedef types::array_list<field_type<option::big_endian>, many_ranges_type> many_list_type;
+    many_list_type manyList;
+    for (unsigned idx = 0U; idx < 100U; ++idx) {
+        manyList.value().emplace_back(static_cast<std::uint16_t>(((idx % 18U) * 1000U) + (idx % 11U)));
+    }
+    BOOST_CHECK(manyList.valid());
+
+    manyList.value()[99].value() = 17011U;
+    BOOST_CHECK(!manyList.valid());
+}
+
+BOOST_AUTO_TEST_CASE(test113) {
+    class counting_resource : public container::memory_resource {
+    public:
+        std::size_t allocations_ = 0U;
+
+    private:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++allocations_;
+            return container::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+            container::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const container::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    typedef types::integral<field_type<option::big_endian>, std::uint8_t> size_type;
+    typedef types::string<field_type<option::big_endian>, option::sequence_size_field_prefix<size_type>,
+                          option::memory_resource_storage>
+        string_type;
+    typedef types::bundle<field_type<option::big_endian>,
+                          std::tuple<types::integral<field_type<option::big_endian>, std::uint16_t>, string_type>>
+        elem_type;
+    typedef types::array_list<field_type<option::big_endian>, elem_type, option::sequence_size_field_prefix<size_type>,
+                              option::memory_resource_storage>
+        list_type;
+    typedef types::array_list<field_type<option::big_endian>, std::uint8_t,
+                              option::sequence_size_field_prefix<size_type>, option::memory_resource_storage>
+        raw_type;
+    typedef types::bundle<field_type<option::big_endian>, std::tuple<string_type, list_type, raw_type>> testing_type;
+
+    static_assert(std::is_same<string_type::value_type, container::resource_string>::value, "Invalid storage type");
+    static_assert(std::is_same<raw_type::value_type, container::resource_vector<std::uint8_t>>::value,
+                  "Invalid storage type");
+
+    static const std::vector<std::uint8_t> Buf = {
+        0x5, 'h', 'e', 'l', 'l', 'o',                                                         // string
+        0x3,                                                                                   // list size
+        0x0, 0x1, 0x16, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',  // elem 1
+        'o', 'p', 'q', 'r', 's', 't', 'u', 'v',                                                // elem 1 continued
+        0x0, 0x2, 0x0,                                                                         // elem 2
+        0x1, 0x0, 0x1, 'z',                                                                    // elem 3
+        0x4, 0x1, 0x2, 0x3, 0x4                                                                // raw data
+    };
+
+    counting_resource upstream;
+    container::monotonic_buffer_resource arena(4096U, &upstream);
+    {
+        container::memory_resource_scope scope(arena);
+        BOOST_CHECK(container::memory_resource_scope::current() == &arena);
+
+        testing_type field;
+        auto readIter = Buf.begin();
+        auto es = field.read(readIter, Buf.size());
+        BOOST_CHECK(es == status_type::success);
+        BOOST_CHECK(field.length() == Buf.size());
+
+        auto &members = field.value();
+        BOOST_CHECK(std::get<0>(members).value() == "hello");
+        BOOST_CHECK(std::get<0>(members).value().get_allocator().resource() == &arena);
+
+        auto &list = std::get<1>(members).value();
+        BOOST_CHECK(list.get_allocator().resource() == &arena);
+        BOOST_REQUIRE(list.size() == 3U);
+        BOOST_CHECK(std::get<0>(list[0].value()).value() == 1U);
+        BOOST_CHECK(std::get<1>(list[0].value()).value() == "abcdefghijklmnopqrstuv");
+        BOOST_CHECK(std::get<1>(list[0].value()).value().get_allocator().resource() == &arena);
+        BOOST_CHECK(std::get<1>(list[1].value()).value().empty());
+        BOOST_CHECK(std::get<0>(list[2].value()).value() == 0x100);
+        BOOST_CHECK(std::get<1>(list[2].value()).value() == "z");
+
+        auto &raw = std::get<2>(members).value();
+        BOOST_CHECK(raw.get_allocator().resource() == &arena);
+        BOOST_CHECK(raw.size() == 4U);
+        BOOST_CHECK(raw[3] == 0x4);
+
+        // All the storage is allocated from the single arena block
+        BOOST_CHECK(upstream.allocations_ == 1U);
+
+        std::vector<std::uint8_t> outBuf(Buf.size());
+        auto writeIter = outBuf.begin();
+        es = field.write(writeIter, outBuf.size());
+        BOOST_CHECK(es == status_type::success);
+        BOOST_CHECK(outBuf == Buf);
+    }
+    BOOST_CHECK(container::memory_resource_scope::current() == container::new_delete_resource());
+    arena.release();
+
+    // The resource is bound when the field is read, not when it is created
+    {
+        testing_type field;
+        BOOST_CHECK(std::get<1>(field.value()).value().get_allocator().resource()
+                    == container::new_delete_resource());
+        {
+            container::memory_resource_scope scope(arena);
+            auto readIter = Buf.begin();
+            BOOST_CHECK(field.read(readIter, Buf.size()) == status_type::success);
+        }
+
+        auto &list = std::get<1>(field.value()).value();
+        BOOST_CHECK(std::get<0>(field.value()).value().get_allocator().resource() == &arena);
+        BOOST_CHECK(list.get_allocator().resource() == &arena);
+        BOOST_CHECK(std::get<2>(field.value()).value().get_allocator().resource() == &arena);
+        BOOST_REQUIRE(list.size() == 3U);
+        BOOST_CHECK(std::get<1>(list[0].value()).value().get_allocator().resource() == &arena);
+
+        auto readIter = Buf.begin();
+        BOOST_CHECK(field.read(readIter, Buf.size()) == status_type::success);
+        BOOST_CHECK(std::get<1>(field.value()).value().get_allocator().resource()
+                    == container::new_delete_resource());
+        BOOST_CHECK(std::get<1>(std::get<1>(field.value()).value()[0].value()).value().get_allocator().resource()
+                    == container::new_delete_resource());
+    }
+    arena.release();
+
+    string_type field;
+    BOOST_CHECK(field.value().get_allocator().resource() == container::new_delete_resource());
+    field.value() = "some string";
+    BOOST_CHECK(field.length() == 12U);
+}
+
+BOOST_AUTO_TEST_CASE(test114) {
+    typedef types::integral<field_type<option::big_endian>, std::uint8_t> size_type;
+    typedef types::string<field_type<option::big_endian>, option::sequence_size_field_prefix<size_type>,
+                          option::small_buffer_storage<8>>
+        string_type;
+    typedef types::array_list<field_type<option::big_endian>, std::uint16_t,
+                              option::sequence_size_field_prefix<size_type>, option::small_buffer_storage<4>>
+        list_type;
+
+    static_assert(std::is_same<string_type::value_type, container::small_string<8>>::value, "Invalid storage type");
+    static_assert(std::is_same<list_type::value_type, container::small_vector<std::uint16_t, 4>>::value,
+                  "Invalid storage type");
+
+    string_type str;
+    static const char ShortBuf[] = {0x5, 'h', 'e', 'l', 'l', 'o'};
+    auto readIter = &ShortBuf[0];
+    auto es = str.read(readIter, sizeof(ShortBuf));
+    BOOST_CHECK(es == status_type::success);
+    BOOST_CHECK(str.value() == "hello");
+    BOOST_CHECK(str.value().inlined());
+    write_read_field(str, &ShortBuf[0], sizeof(ShortBuf));
+
+    static const char LongBuf[] = {0xa, 'h', 'e', 'l', 'l', 'o', 'w', 'o', 'r', 'l', 'd'};
+    readIter = &LongBuf[0];
+    es = str.read(readIter, sizeof(LongBuf));
+    BOOST_CHECK(es == status_type::success);
+    BOOST_CHECK(str.value() == "helloworld");
+    BOOST_CHECK(!str.value().inlined());
+    write_read_field(str, &LongBuf[0], sizeof(LongBuf));
+
+    list_type list;
+    static const char ListBuf[] = {0x3, 0x0, 0x1, 0x0, 0x2, 0x0, 0x3};
+    readIter = &ListBuf[0];
+    es = list.read(readIter, sizeof(ListBuf));
+    BOOST_CHECK(es == status_type::success);
+    BOOST_CHECK(list.value().size() == 3U);
+    BOOST_CHECK(list.value().inlined());
+    BOOST_CHECK(list.value()[2] == 3U);
+    write_read_field(list, &ListBuf[0], sizeof(ListBuf));
+
+    for (std::uint16_t idx = 0U; idx < 100U; ++idx) {
+        list.value().push_back(idx);
+    }
+    BOOST_CHECK(!list.value().inlined());
+    BOOST_CHECK(list.length() == 1U + (103U * sizeof(std::uint16_t)));
+    BOOST_CHECK(list.value()[102] == 99U);
+
+    list.value().resize(2U);
+    list.value().shrink_to_fit();
+    BOOST_CHECK(list.value().inlined());
+    BOOST_CHECK(list.value()[1] == 2U);
+}
+
+BOOST_AUTO_TEST_CASE(test115) {
+    typedef types::integral<field_type<option::big_endian>, std::uint8_t> size_type;
+    typedef types::array_list<field_type<option::big_endian>, std::uint32_t, option::orig_data_view> list_type;
+    typedef types::array_list<field_type<option::little_endian>, std::uint16_t,
+                              option::sequence_size_field_prefix<size_type>, option::orig_data_view>
+        prefixed_list_type;
+    typedef types::float_value<field_type<option::big_endian>, float> float_type;
+    typedef types::array_list<field_type<option::big_endian>, float_type, option::orig_data_view> float_list_type;
+
+    static_assert(std::is_same<list_type::value_type,
+                               container::endian_array_view<std::uint32_t, endian::big_endian>>::value,
+                  "Expected to be endian array view");
+    static_assert(std::is_same<float_list_type::value_type,
+                               container::endian_array_view<float_type, endian::big_endian, float>>::value,
+                  "Expected to be endian array view");
+
+    static const char Buf[] = {0x01, 0x02, 0x03, 0x04, 0x0a, 0x0b, 0x0c, 0x0d};
+    list_type list;
+    auto readIter = &Buf[0];
+    auto es = list.read(readIter, sizeof(Buf));
+    BOOST_CHECK(es == status_type::success);
+    BOOST_CHECK(readIter == &Buf[0] + sizeof(Buf));
+    BOOST_CHECK(list.value().raw_data() == reinterpret_cast<const std::uint8_t *>(&Buf[0]));
+    BOOST_CHECK(list.value().size() == 2U);
+    BOOST_CHECK(list.length() == sizeof(Buf));
+    BOOST_CHECK(list.value()[0] == 0x01020304U);
+    BOOST_CHECK(list.value().back() == 0x0a0b0c0dU);
+    std::vector<std::uint32_t> values(list.value().begin(), list.value().end());
+    BOOST_CHECK((values == std::vector<std::uint32_t> {0x01020304U, 0x0a0b0c0dU}));
+    write_read_field(list, &Buf[0], sizeof(Buf));
+
+    char outBuf[sizeof(Buf)] = {0};
+    auto writeIter = &outBuf[0];
+    es = list.write(writeIter, sizeof(outBuf));
+    BOOST_CHECK(es == status_type::success);
+    BOOST_CHECK(writeIter == &outBuf[0] + sizeof(outBuf));
+    BOOST_CHECK(std::equal(&Buf[0], &Buf[0] + sizeof(Buf), &outBuf[0]));
+
+    writeIter = &outBuf[0];
+    es = list.write(writeIter, sizeof(outBuf) - 1U);
+    BOOST_CHECK(es == status_type::buffer_overflow);
+
+    readIter = &Buf[0];
+    es = list.read(readIter, sizeof(Buf) - 1U);
+    BOOST_CHECK(es == status_type::not_enough_data);
+
+    static const char PrefixedBuf[] = {0x3, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01};
+    prefixed_list_type prefixedList;
+    readIter = &PrefixedBuf[0];
+    es = prefixedList.read(readIter, sizeof(PrefixedBuf));
+    BOOST_CHECK(es == status_type::success);
+    BOOST_CHECK(prefixedList.value().size() == 3U);
+    BOOST_CHECK(prefixedList.value()[0] == 1U);
+    BOOST_CHECK(prefixedList.value()[2] == 0x100U);
+    write_read_field(prefixedList, &PrefixedBuf[0], sizeof(PrefixedBuf));
+
+    static const char FloatBuf[] = {0x3f, static_cast<char>(0xc0), 0x0, 0x0, static_cast<char>(0xc0), 0x0, 0x0, 0x0};
+    float_list_type floatList;
+    readIter = &FloatBuf[0];
+    es = floatList.read(readIter, sizeof(FloatBuf));
+    BOOST_CHECK(es == status_type::success);
+    BOOST_CHECK(floatList.valid());
+    BOOST_CHECK(fpEquals(floatList.value()[0].value(), 1.5f));
+    BOOST_CHECK(fpEquals(floatList.value()[1].value(), -2.0f));
+    float floats[2] = {0};
+    BOOST_CHECK(floatList.value().copy(&floats[0], 2U) == 2U);
+    BOOST_CHECK(fpEquals(floats[1], -2.0f));
+    write_read_field(floatList, &FloatBuf[0], sizeof(FloatBuf));
+}
+
+BOOST_AUTO_TEST_CASE(test116) {
+    typedef field_type<option::big_endian> field_base;
+    typedef types::bundle<field_base,
+                          std::tuple<types::integral<field_base, std::uint16_t>, types::integral<field_base, std::uint8_t>>>
+        elem_type;
+    typedef types::integral<field_base, std::uint8_t> size_type;
+    typedef types::array_list<field_base, elem_type, option::sequence_size_field_prefix<size_type>,
+                              option::lazy_elements_view<true>>
+        list_type;
+    typedef types::array_list<field_base, elem_type, option::lazy_elements_view<>> plain_list_type;
+
+    static_assert(std::is_same<list_type::value_type, container::lazy_array_view<elem_type, true>>::value,
+                  "Expected to be lazy array view");
+    static_assert(std::is_same<plain_list_type::value_type, container::lazy_array_view<elem_type, false>>::value,
+                  "Expected to be lazy array view");
+
+    typedef types::bundle<field_base,
+                          std::tuple<types::integral<field_base, std::uint16_t>,
+                                     types::integral<field_base, std::uint8_t, option::valid_num_value_range<0, 5>,
+                                                     option::fail_on_invalid<>>>>
+        failing_elem_type;
+    static_assert(types::detail::array_list_elem_is_lazy_decodable<elem_type>::value, "Expected to be decodable");
+    static_assert(!types::detail::array_list_elem_is_lazy_decodable<failing_elem_type>::value,
+                  "Expected not to be decodable");
+    static_assert(!types::detail::array_list_elem_is_lazy_decodable<std::uint8_t>::value,
+                  "Expected not to be decodable");
+
+    static const char Buf[] = {0x3, 0x0, 0x1, 0x2, 0x0, 0x3, 0x4, 0x0, 0x5, 0x6};
+    list_type list;
+    auto readIter = &Buf[0];
+    auto es = list.read(readIter, sizeof(Buf));
+    BOOST_CHECK(es == status_type::success);
+    BOOST_CHECK(readIter == &Buf[0] + sizeof(Buf));
+    BOOST_CHECK(list.value().size() == 3U);
+    BOOST_CHECK(list.length() == sizeof(Buf));
+    BOOST_CHECK(std::get<0>(list.value()[1].value()).value() == 3U);
+    BOOST_CHECK(std::get<1>(list.value().back().value()).value() == 6U);
+    BOOST_CHECK(list.value().cached_count() == 0U);
+    write_read_field(list, &Buf[0], sizeof(Buf));
+
+    std::get<1>(list.value().modify(1U).value()).value() = 0x7;
+    BOOST_CHECK(list.value().cached_count() == 1U);
+    BOOST_CHECK(std::get<1>(list.value()[1].value()).value() == 7U);
+    static const char UpdatedBuf[] = {0x3, 0x0, 0x1, 0x2, 0x0, 0x3, 0x7, 0x0, 0x5, 0x6};
+    write_read_field(list, &UpdatedBuf[0], sizeof(UpdatedBuf));
+
+    auto elems = list.value().materialize();
+    BOOST_CHECK(elems.size() == 3U);
+    BOOST_CHECK(elems[1] == list.value()[1]);
+    BOOST_CHECK(std::get<0>(elems[2].value()).value() == 5U);
+
+    list.value().clear_cache();
+    BOOST_CHECK(std::get<1>(list.value()[1].value()).value() == 4U);
+
+    plain_list_type plainList;
+    readIter = &Buf[1];
+    es = plainList.read(readIter, sizeof(Buf) - 1U);
+    BOOST_CHECK(es == status_type::success);
+    BOOST_CHECK(plainList.value().size() == 3U);
+    BOOST_CHECK(plainList.value().raw_data() == reinterpret_cast<const std::uint8_t *>(&Buf[1]));
+
+    char outBuf[sizeof(Buf) - 1U] = {0};
+    auto writeIter = &outBuf[0];
+    es = plainList.write(writeIter, sizeof(outBuf));
+    BOOST_CHECK(es == status_type::success);
+    BOOST_CHECK(std::equal(&outBuf[0], &outBuf[0] + sizeof(outBuf), &Buf[1]));
+
+    writeIter = &outBuf[0];
+    es = plainList.write(writeIter, sizeof(outBuf) - 1U);
+    BOOST_CHECK(es == status_type::buffer_overflow);
+
+    readIter = &Buf[1];
+    es = plainList.read(readIter, sizeof(Buf) - 2U);
+    BOOST_CHECK(es == status_type::not_enough_data);
+}
+
 BOOST_AUTO_TEST_SUITE_END()